@@ -0,0 +1,150 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/logger.h"
+
+#include <string>
+
+namespace libcellml {
+
+/**
+ * @brief The CompiledModelCache class.
+ *
+ * The CompiledModelCache class is for compiling the C code generated by a
+ * @c Generator into a shared library and for caching that shared library on
+ * disk, so that a model which has already been compiled, whether by this
+ * process or by another one, does not need to be compiled again.
+ */
+class LIBCELLML_EXPORT CompiledModelCache: public Logger
+{
+public:
+    using InitializeStatesAndConstantsMethod = void (*)(double *states, double *variables); /**< Type definition for the initializeStatesAndConstants() method. */
+    using ComputeComputedConstantsMethod = void (*)(double *variables); /**< Type definition for the computeComputedConstants() method. */
+    using ComputeRatesMethod = void (*)(double voi, double *states, double *rates, double *variables); /**< Type definition for the computeRates() method. */
+    using ComputeVariablesMethod = void (*)(double voi, double *states, double *rates, double *variables); /**< Type definition for the computeVariables() method. */
+
+    /**
+     * @brief The Methods struct.
+     *
+     * The compute methods of a compiled model. All of them are @c nullptr if
+     * the model could not be compiled.
+     */
+    struct Methods
+    {
+        InitializeStatesAndConstantsMethod initializeStatesAndConstants = nullptr; /**< The initializeStatesAndConstants() method. */
+        ComputeComputedConstantsMethod computeComputedConstants = nullptr; /**< The computeComputedConstants() method. */
+        ComputeRatesMethod computeRates = nullptr; /**< The computeRates() method. */
+        ComputeVariablesMethod computeVariables = nullptr; /**< The computeVariables() method. */
+    };
+
+    ~CompiledModelCache() override; /**< Destructor */
+    CompiledModelCache(const CompiledModelCache &rhs) = delete; /**< Copy constructor */
+    CompiledModelCache(CompiledModelCache &&rhs) noexcept = delete; /**< Move constructor */
+    CompiledModelCache &operator=(CompiledModelCache rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Create a @c CompiledModelCache object.
+     *
+     * Factory method to create a @c CompiledModelCache.  Create a
+     * compiled model cache with::
+     *
+     *   CompiledModelCachePtr compiledModelCache = libcellml::CompiledModelCache::create();
+     *
+     * @return A smart pointer to a @c CompiledModelCache object.
+     */
+    static CompiledModelCachePtr create() noexcept;
+
+    /**
+     * @brief Set the cache directory.
+     *
+     * Set the directory in which compiled models are stored. The directory
+     * is created, only accessible to the current user, if it does not already
+     * exist. If no cache directory is set then a @c libcellml directory in the
+     * cache directory of the current user is used, i.e.
+     * @c $XDG_CACHE_HOME/libcellml or @c ~/.cache/libcellml (or
+     * @c libcellml in the @c LOCALAPPDATA directory on Windows).
+     *
+     * A shared library in the cache directory is only loaded if it, the cache
+     * directory and the directory of the shared library belong to the current
+     * user and cannot be modified by other users.
+     *
+     * @param directory The @c std::string cache directory to set.
+     */
+    void setCacheDirectory(const std::string &directory);
+
+    /**
+     * @brief Get the cache directory.
+     *
+     * Get the directory in which compiled models are stored.
+     *
+     * @return The @c std::string cache directory.
+     */
+    std::string cacheDirectory() const;
+
+    /**
+     * @brief Set the compiler command.
+     *
+     * Set the command used to compile a model into a shared library. The
+     * command must contain the @c <INPUT> and @c <OUTPUT> placeholders, which
+     * are replaced with the path of the C file to compile and the path of the
+     * shared library to create, respectively.
+     *
+     * @param command The @c std::string compiler command to set.
+     */
+    void setCompilerCommand(const std::string &command);
+
+    /**
+     * @brief Get the compiler command.
+     *
+     * Get the command used to compile a model into a shared library.
+     *
+     * @return The @c std::string compiler command.
+     */
+    std::string compilerCommand() const;
+
+    /**
+     * @brief Get the compute methods for the model processed by a @c Generator.
+     *
+     * Look up, using its fingerprint, the shared library for the model
+     * processed by @p generator in the cache directory. If there is no such
+     * shared library then the code generated by @p generator is compiled
+     * using the compiler command. The shared library is then loaded and its
+     * compute methods are returned. The shared library remains loaded for as
+     * long as this @c CompiledModelCache exists.
+     *
+     * The @c GeneratorProfile of @p generator must generate double precision
+     * C code with an interface, which is saved as @c model.h next to the
+     * implementation.
+     *
+     * If the methods cannot be retrieved then an error is logged and all the
+     * returned methods are @c nullptr.
+     *
+     * @param generator The @c Generator that has processed the model.
+     *
+     * @return The @c Methods of the compiled model.
+     */
+    Methods methods(const GeneratorPtr &generator);
+
+private:
+    CompiledModelCache(); /**< Constructor */
+
+    struct CompiledModelCacheImpl;
+    CompiledModelCacheImpl *mPimpl;
+};
+
+} // namespace libcellml
@@ -114,7 +114,9 @@ public:
     /**
      * @brief Add a variable by reference as part of this component.
      *
-     * Add a variable by reference as part of the given component.
+     * Add a variable by reference as part of the given component. If the
+     * given variable already belongs to a component then it is removed from
+     * that component first.
      *
      * @sa removeVariable
      *
@@ -378,6 +380,9 @@ private:
     explicit Component(const std::string &name);
 
     bool doAddComponent(const ComponentPtr &component) override;
+    void invalidateNameIndices() override;
+
+    friend class ComponentMath; /**< Internal access to the parsed math of this component. */
 
     struct ComponentImpl; /**< Forward declaration for pImpl idiom. */
     ComponentImpl *mPimpl; /**< Private member to implementation pointer */
@@ -304,9 +304,21 @@ protected:
      */
     virtual bool doAddComponent(const ComponentPtr &component);
 
+    /**
+     * @brief Invalidate the name indices of this entity.
+     *
+     * Invalidate the indices used to look up, by name, the entities owned by
+     * this entity. This is called when one of those entities gets renamed.
+     * Derived classes that own other kinds of named entities must also
+     * invalidate the indices of those entities.
+     */
+    virtual void invalidateNameIndices();
+
     ComponentEntity(); /**< ComponentEntity Constructor. */
 
 private:
+    friend class NamedEntity; /**< Lets a renamed entity invalidate the name indices of its owner. */
+
     struct ComponentEntityImpl; /**< Forward declaration for pImpl idiom. */
     ComponentEntityImpl *mPimpl; /**< Private member to implementation pointer */
 };
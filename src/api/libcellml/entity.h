@@ -110,10 +110,36 @@ public:
      */
     bool hasAncestor(const EntityPtr &entity) const;
 
+    /**
+     * @brief Get the revision of this entity.
+     *
+     * Get the revision at which this entity, or any of its descendants, was
+     * last created or modified. Revisions are shared by all the entities and
+     * only ever increase, so an entity whose revision is greater than a
+     * revision that was previously retrieved, from this or any other entity,
+     * has been modified since.
+     *
+     * The revision of a model is therefore the revision at which anything in
+     * it was last modified.
+     *
+     * @return The revision of this entity.
+     */
+    size_t revision() const;
+
 protected:
     Entity(); /**< Constructor */
 
+    /**
+     * @brief Mark this entity as modified.
+     *
+     * Give this entity a new revision, which it also gives to all of its
+     * ancestors.
+     */
+    void markAsModified();
+
 private:
+    friend class ImportedEntity; /**< ImportedEntity marks the entity that it is part of as modified. */
+
     struct EntityImpl;
     EntityImpl *mPimpl;
 };
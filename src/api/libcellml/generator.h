@@ -104,6 +104,16 @@ public:
         UNSUITABLY_CONSTRAINED
     };
 
+    enum class Method
+    {
+        INITIALIZE_STATES_AND_CONSTANTS,
+        COMPUTE_COMPUTED_CONSTANTS,
+        COMPUTE_RATES,
+        COMPUTE_VARIABLES,
+        COMPUTE_ROOTS,
+        APPLY_RESETS
+    };
+
     ~Generator() override; /**< Destructor */
     Generator(const Generator &rhs) = delete; /**< Copy constructor */
     Generator(Generator &&rhs) noexcept = delete; /**< Move constructor */
@@ -144,6 +154,13 @@ public:
      *
      * Process the @c Model using this @c Generator.
      *
+     * If the @c Model is the one that was last processed by this
+     * @c Generator and its structure (i.e. its components, variables,
+     * equations, connections and resets) has not been modified since then,
+     * then the existing analysis of the @c Model is reused. In that case, only
+     * the code of the methods affected by a modification of the initial value
+     * of a variable is regenerated.
+     *
      * @param model The @c Model to process.
      */
     void processModel(const ModelPtr &model);
@@ -207,6 +224,34 @@ public:
      */
     GeneratorVariablePtr variable(size_t index) const;
 
+    /**
+     * @brief Get the fingerprint of the @c Model.
+     *
+     * Return a SHA-1 based fingerprint of the equations and variables of the
+     * @c Model processed by this @c Generator, combined with its
+     * @c GeneratorProfile. Two generators with the same fingerprint generate
+     * the same code. If no valid @c Model has been processed then the empty
+     * string is returned.
+     *
+     * @return The fingerprint.
+     */
+    std::string fingerprint() const;
+
+    /**
+     * @brief Test if the code of @p method has been modified.
+     *
+     * Test if the code of @p method has been modified by the last processing
+     * of the @c Model. If the @c Model is processed for the first time, or
+     * if its structure has been modified, then the code of all the methods is
+     * considered to have been modified.
+     *
+     * @param method The @c Method to test.
+     *
+     * @return @c true if the code of @p method has been modified, @c false
+     * otherwise.
+     */
+    bool isMethodModified(Method method) const;
+
     /**
      * @brief Get the interface code for the @c Model.
      *
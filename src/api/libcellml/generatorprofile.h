@@ -35,7 +35,15 @@ public:
     enum class Profile
     {
         C,
-        PYTHON
+        PYTHON,
+        C_STATIC,
+        PYTHON_NUMPY
+    };
+
+    enum class Precision
+    {
+        SINGLE,
+        DOUBLE
     };
 
     ~GeneratorProfile(); /**< Destructor */
@@ -2121,6 +2129,8 @@ public:
      * constant.
      *
      * Set this @c std::string for the interface of the state count constant.
+     * The string may contain the <STATE_COUNT> tag, which will be replaced
+     * with the number of states in the model.
      *
      * @param interfaceStateCountString The @c std::string to use for the
      * interface of the state count constant.
@@ -2169,6 +2179,8 @@ public:
      * constant.
      *
      * Set this @c std::string for the interface of the variable count constant.
+     * The string may contain the <VARIABLE_COUNT> tag, which will be replaced
+     * with the number of variables in the model.
      *
      * @param interfaceVariableCountString The @c std::string to use for the
      * interface of the variable count constant.
@@ -2200,6 +2212,108 @@ public:
      */
     void setImplementationVariableCountString(const std::string &implementationVariableCountString);
 
+    /**
+     * @brief Get the @c std::string for the interface of the root count
+     * constant.
+     *
+     * Return the @c std::string for the interface of the root count constant.
+     *
+     * @return The @c std::string for the interface of the root count constant.
+     */
+    std::string interfaceRootCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the root count
+     * constant.
+     *
+     * Set this @c std::string for the interface of the root count constant,
+     * which is only generated for a model that has resets. The string may
+     * contain the <ROOT_COUNT> tag, which will be replaced with the number of
+     * resets in the model.
+     *
+     * @param interfaceRootCountString The @c std::string to use for the
+     * interface of the root count constant.
+     */
+    void setInterfaceRootCountString(const std::string &interfaceRootCountString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the root count
+     * constant.
+     *
+     * Return the @c std::string for the implementation of the root count
+     * constant.
+     *
+     * @return The @c std::string for the implementation of the root count
+     * constant.
+     */
+    std::string implementationRootCountString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the root count
+     * constant.
+     *
+     * Set this @c std::string for the implementation of the root count
+     * constant, which is only generated for a model that has resets. To be
+     * useful, the string should contain the <ROOT_COUNT> tag, which will be
+     * replaced with the number of resets in the model.
+     *
+     * @param implementationRootCountString The @c std::string to use for the
+     * implementation of the root count constant.
+     */
+    void setImplementationRootCountString(const std::string &implementationRootCountString);
+
+    /**
+     * @brief Get the @c std::string for the interface of the model instance
+     * type.
+     *
+     * Return the @c std::string for the interface of the model instance type.
+     *
+     * @return The @c std::string for the interface of the model instance type.
+     */
+    std::string interfaceModelInstanceTypeString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface of the model instance
+     * type.
+     *
+     * Set this @c std::string for the interface of the model instance type,
+     * i.e. a data structure that holds the states and variables of one
+     * instance of the model. To be useful, the string should contain the
+     * <STATE_COUNT> and <VARIABLE_COUNT> tags, which will be replaced with the
+     * number of states and variables in the model (or one if there are none).
+     *
+     * @param interfaceModelInstanceTypeString The @c std::string to use for the
+     * interface of the model instance type.
+     */
+    void setInterfaceModelInstanceTypeString(const std::string &interfaceModelInstanceTypeString);
+
+    /**
+     * @brief Get the @c std::string for the implementation of the model
+     * instance type.
+     *
+     * Return the @c std::string for the implementation of the model instance
+     * type.
+     *
+     * @return The @c std::string for the implementation of the model instance
+     * type.
+     */
+    std::string implementationModelInstanceTypeString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation of the model
+     * instance type.
+     *
+     * Set this @c std::string for the implementation of the model instance
+     * type, i.e. a data structure that holds the states and variables of one
+     * instance of the model. To be useful, the string should contain the
+     * <STATE_COUNT> and <VARIABLE_COUNT> tags, which will be replaced with the
+     * number of states and variables in the model (or one if there are none).
+     *
+     * @param implementationModelInstanceTypeString The @c std::string to use
+     * for the implementation of the model instance type.
+     */
+    void setImplementationModelInstanceTypeString(const std::string &implementationModelInstanceTypeString);
+
     /**
      * @brief Get the @c std::string for the data structure for the variable
      * type object.
@@ -2622,6 +2736,200 @@ public:
      */
     void setVariablesArrayString(const std::string &variablesArrayString);
 
+    /**
+     * @brief Get the @c std::string for the name of the roots array.
+     *
+     * Return the @c std::string for the name of the roots array.
+     *
+     * @return The @c std::string for the name of the roots array.
+     */
+    std::string rootsArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the roots array.
+     *
+     * Set this @c std::string for the name of the roots array, i.e. the array
+     * in which the value of the root function of each reset is computed.
+     *
+     * @param rootsArrayString The @c std::string to use for the name of the
+     * roots array.
+     */
+    void setRootsArrayString(const std::string &rootsArrayString);
+
+    /**
+     * @brief Get the @c std::string for the name of the roots found array.
+     *
+     * Return the @c std::string for the name of the roots found array.
+     *
+     * @return The @c std::string for the name of the roots found array.
+     */
+    std::string rootsFoundArrayString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of the roots found array.
+     *
+     * Set this @c std::string for the name of the roots found array, i.e. the
+     * array which tells, for each reset, whether its root function has been
+     * found to be zero and, therefore, whether it must be applied.
+     *
+     * @param rootsFoundArrayString The @c std::string to use for the name of
+     * the roots found array.
+     */
+    void setRootsFoundArrayString(const std::string &rootsFoundArrayString);
+
+    /**
+     * @brief Get the @c std::string for the declaration of a reset value.
+     *
+     * Return the @c std::string for the declaration of a reset value.
+     *
+     * @return The @c std::string for the declaration of a reset value.
+     */
+    std::string resetValueDeclarationString() const;
+
+    /**
+     * @brief Set the @c std::string for the declaration of a reset value.
+     *
+     * Set this @c std::string for the declaration of a reset value, i.e. the
+     * temporary in which the new value of a state is computed before any state
+     * gets reset. To be useful, the string should contain the <INDEX> tag,
+     * which will be replaced with the index of the reset value.
+     *
+     * @param resetValueDeclarationString The @c std::string to use for the
+     * declaration of a reset value.
+     */
+    void setResetValueDeclarationString(const std::string &resetValueDeclarationString);
+
+    /**
+     * @brief Get the @c std::string for the name of a reset value.
+     *
+     * Return the @c std::string for the name of a reset value.
+     *
+     * @return The @c std::string for the name of a reset value.
+     */
+    std::string resetValueString() const;
+
+    /**
+     * @brief Set the @c std::string for the name of a reset value.
+     *
+     * Set this @c std::string for the name of a reset value, as declared using
+     * the reset value declaration string. To be useful, the string should
+     * contain the <INDEX> tag, which will be replaced with the index of the
+     * reset value.
+     *
+     * @param resetValueString The @c std::string to use for the name of a
+     * reset value.
+     */
+    void setResetValueString(const std::string &resetValueString);
+
+    /**
+     * @brief Get the @c std::string for the type of the states array.
+     *
+     * Return the @c std::string for the type of the elements of the states
+     * (and rates) array.
+     *
+     * @return The @c std::string for the type of the states array.
+     */
+    std::string statesTypeString() const;
+
+    /**
+     * @brief Set the @c std::string for the type of the states array.
+     *
+     * Set this @c std::string for the type of the elements of the states (and
+     * rates) array. It replaces the <STATES_TYPE> tag in the generated code.
+     *
+     * @param statesTypeString The @c std::string to use for the type of the
+     * states array.
+     */
+    void setStatesTypeString(const std::string &statesTypeString);
+
+    /**
+     * @brief Get the @c std::string for the type of the variables array.
+     *
+     * Return the @c std::string for the type of the elements of the variables
+     * array.
+     *
+     * @return The @c std::string for the type of the variables array.
+     */
+    std::string variablesTypeString() const;
+
+    /**
+     * @brief Set the @c std::string for the type of the variables array.
+     *
+     * Set this @c std::string for the type of the elements of the variables
+     * array. It replaces the <VARIABLES_TYPE> tag in the generated code.
+     *
+     * @param variablesTypeString The @c std::string to use for the type of
+     * the variables array.
+     */
+    void setVariablesTypeString(const std::string &variablesTypeString);
+
+    /**
+     * @brief Get the @c std::string for the compute type.
+     *
+     * Return the @c std::string for the type used for computations, i.e. the
+     * type of the variable of integration and of the helper functions.
+     *
+     * @return The @c std::string for the compute type.
+     */
+    std::string computeTypeString() const;
+
+    /**
+     * @brief Set the @c std::string for the compute type.
+     *
+     * Set this @c std::string for the type used for computations, i.e. the
+     * type of the variable of integration and of the helper functions. It
+     * replaces the <COMPUTE_TYPE> tag in the generated code.
+     *
+     * @param computeTypeString The @c std::string to use for the compute type.
+     */
+    void setComputeTypeString(const std::string &computeTypeString);
+
+    /**
+     * @brief Get the @c Precision of computations.
+     *
+     * Return the @c Precision of computations, as last set for this
+     * @c GeneratorProfile or, by default, @c Precision::DOUBLE.
+     *
+     * @return The @c Precision of computations.
+     */
+    Precision computePrecision() const;
+
+    /**
+     * @brief Set the @c Precision of computations.
+     *
+     * Set, in one go, everything that depends on the precision of
+     * computations, i.e. the compute type (e.g. @c float), the suffix of a
+     * number (e.g. @c f), the mathematical functions (e.g. @c expf) and the
+     * helper functions (e.g. @c sec()). The type of the states and variables
+     * arrays is left as is, so that storage and computations can use
+     * different precisions. This has no effect on a Python profile, which
+     * always computes in double precision.
+     *
+     * @param precision The @c Precision of computations to use.
+     */
+    void setComputePrecision(Precision precision);
+
+    /**
+     * @brief Get the @c std::string for the suffix of a number.
+     *
+     * Return the @c std::string for the suffix of a number.
+     *
+     * @return The @c std::string for the suffix of a number.
+     */
+    std::string numberSuffixString() const;
+
+    /**
+     * @brief Set the @c std::string for the suffix of a number.
+     *
+     * Set this @c std::string for the suffix of a number, e.g. "f" to get
+     * single precision numbers in C. The suffix is also added to the true,
+     * false, e and pi constants.
+     *
+     * @param numberSuffixString The @c std::string to use for the suffix of a
+     * number.
+     */
+    void setNumberSuffixString(const std::string &numberSuffixString);
+
     /**
      * @brief Get the @c std::string for returning a created array.
      *
@@ -2636,7 +2944,9 @@ public:
      *
      * Set this @c std::string for returning a created array. To be useful, the
      * string should contain the <ARRAY_SIZE> tag, which will be replaced with
-     * the size of the array to be created.
+     * the size of the array to be created. The string may also contain the
+     * <ARRAY_TYPE> tag, which will be replaced with the type of the array to
+     * be created.
      *
      * @param returnCreatedArrayString The @c std::string to use for returning
      * a created array.
@@ -2953,6 +3263,91 @@ public:
      */
     void setImplementationComputeVariablesMethodString(const std::string &implementationComputeVariablesMethodString);
 
+    /**
+     * @brief Get the @c std::string for the interface to compute roots.
+     *
+     * Return the @c std::string for the interface to compute roots.
+     *
+     * @return The @c std::string for the interface to compute roots.
+     */
+    std::string interfaceComputeRootsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to compute roots.
+     *
+     * Set this @c std::string for the interface to compute roots, which is
+     * only generated for a model that has resets.
+     *
+     * @param interfaceComputeRootsMethodString The @c std::string to use for
+     * the interface to compute roots.
+     */
+    void setInterfaceComputeRootsMethodString(const std::string &interfaceComputeRootsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to compute roots.
+     *
+     * Return the @c std::string for the implementation to compute roots.
+     *
+     * @return The @c std::string for the implementation to compute roots.
+     */
+    std::string implementationComputeRootsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to compute roots.
+     *
+     * Set this @c std::string for the implementation to compute roots, which
+     * is only generated for a model that has resets. The root function of a
+     * reset is the difference between its test variable and its test value,
+     * i.e. it is zero when the reset must be applied.
+     *
+     * @param implementationComputeRootsMethodString The @c std::string to use
+     * for the implementation to compute roots.
+     */
+    void setImplementationComputeRootsMethodString(const std::string &implementationComputeRootsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the interface to apply resets.
+     *
+     * Return the @c std::string for the interface to apply resets.
+     *
+     * @return The @c std::string for the interface to apply resets.
+     */
+    std::string interfaceApplyResetsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the interface to apply resets.
+     *
+     * Set this @c std::string for the interface to apply resets, which is only
+     * generated for a model that has resets.
+     *
+     * @param interfaceApplyResetsMethodString The @c std::string to use for the
+     * interface to apply resets.
+     */
+    void setInterfaceApplyResetsMethodString(const std::string &interfaceApplyResetsMethodString);
+
+    /**
+     * @brief Get the @c std::string for the implementation to apply resets.
+     *
+     * Return the @c std::string for the implementation to apply resets.
+     *
+     * @return The @c std::string for the implementation to apply resets.
+     */
+    std::string implementationApplyResetsMethodString() const;
+
+    /**
+     * @brief Set the @c std::string for the implementation to apply resets.
+     *
+     * Set this @c std::string for the implementation to apply resets, which
+     * is only generated for a model that has resets. A state is reset using
+     * the reset value of its reset with the lowest order amongst those whose
+     * root has been found. All the reset values are computed before any state
+     * gets reset.
+     *
+     * @param implementationApplyResetsMethodString The @c std::string to use
+     * for the implementation to apply resets.
+     */
+    void setImplementationApplyResetsMethodString(const std::string &implementationApplyResetsMethodString);
+
     /**
      * @brief Get the @c std::string for an empty method.
      *
@@ -99,6 +99,8 @@ protected:
     ImportedEntity(); /**< Constructor */
 
 private:
+    void importModified(); /**< Mark the entity that this imported entity is part of as modified. */
+
     struct ImportedEntityImpl; /**< Forward declaration for pImpl idiom. */
     ImportedEntityImpl *mPimpl; /**< Private member to implementation pointer. */
 };
@@ -0,0 +1,192 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/exportdefinitions.h"
+#include "libcellml/types.h"
+
+#include <string>
+
+namespace libcellml {
+
+/**
+ * @brief The ImportLibrary class.
+ *
+ * The ImportLibrary class is for sharing the models imported by other models.
+ * An imported model is parsed the first time that it is needed and is then
+ * shared by all the import sources that refer to it, in the same or in other
+ * models, for as long as the library exists. Models are identified by the
+ * location that the library's @c ImportResolver gives to their URL, so that,
+ * with the default resolver, different paths to the same file result in the
+ * same model.
+ *
+ * Imports are resolved one level of the import graph at a time: the
+ * documents imported at a given level which are not yet in the library are
+ * fetched and parsed, concurrently if several threads are allowed (see
+ * setThreadCount()), and only then are import sources given their model, in
+ * the order in which they are found, so that the result does not depend on
+ * the number of threads used.
+ *
+ * Since imported models are shared, they should be regarded as read-only.
+ */
+class LIBCELLML_EXPORT ImportLibrary
+{
+public:
+    ~ImportLibrary(); /**< Destructor */
+    ImportLibrary(const ImportLibrary &rhs) = delete; /**< Copy constructor */
+    ImportLibrary(ImportLibrary &&rhs) noexcept = delete; /**< Move constructor */
+    ImportLibrary &operator=(ImportLibrary rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Create an @c ImportLibrary object.
+     *
+     * Factory method to create an @c ImportLibrary.  Create an
+     * import library with::
+     *
+     *   ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+     *
+     * @return A smart pointer to an @c ImportLibrary object.
+     */
+    static ImportLibraryPtr create() noexcept;
+
+    /**
+     * @brief Resolve all imports in the given @p model.
+     *
+     * Resolve all @c Component and @c Units imports in @p model, and in the
+     * models it imports, using the models held by this library. The
+     * documents which are not yet in this library are fetched using the
+     * import resolver and parsed, concurrently if allowed by
+     * setThreadCount(), and added to it. The @p baseFile is used to locate the source
+     * models relative to @p model.
+     *
+     * If the import resolver throws an exception, the first one thrown is
+     * rethrown once all the threads are done. The imports resolved until then
+     * remain resolved, but the documents that were fetched at the level of the
+     * import graph where the exception was thrown are not added to this
+     * library.
+     *
+     * @sa Model::resolveImports
+     *
+     * @param model The @c ModelPtr whose imports are to be resolved.
+     * @param baseFile The @c std::string location of @p model.
+     */
+    void resolveImports(const ModelPtr &model, const std::string &baseFile);
+
+    /**
+     * @brief Get the model at the given @p url.
+     *
+     * Get the model parsed from the document at the given @p url. The first
+     * time that a document is needed, it is fetched using the import resolver
+     * and parsed, and the imports of the resulting model are resolved using
+     * this library. After that, the same model is returned for as long as it
+     * is in this library.
+     *
+     * @param url The @c std::string URL of the document, e.g. its path.
+     *
+     * @return The @c ModelPtr parsed from the document, or @c nullptr if the
+     * document cannot be fetched.
+     */
+    ModelPtr model(const std::string &url);
+
+    /**
+     * @brief Test whether this library has the model at the given @p url.
+     *
+     * Test whether the model at the given @p url has already been parsed and
+     * is in this library.
+     *
+     * @param url The @c std::string URL of the document, e.g. its path.
+     *
+     * @return @c true if this library has the model at @p url, @c false
+     * otherwise.
+     */
+    bool hasModel(const std::string &url) const;
+
+    /**
+     * @brief Get the number of models in this library.
+     *
+     * Get the number of models in this library.
+     *
+     * @return The number of models.
+     */
+    size_t modelCount() const;
+
+    /**
+     * @brief Remove all the models from this library.
+     *
+     * Remove all the models from this library, so that files get parsed
+     * again the next time that they are needed. Import sources that
+     * already refer to a model keep it.
+     */
+    void removeAllModels();
+
+    /**
+     * @brief Set the import resolver.
+     *
+     * Set the @c ImportResolver used to locate and fetch the documents
+     * imported by models, e.g. to serve them from memory rather than from
+     * local disk. The resolver may be called from several threads at once if
+     * more than one thread is allowed, see setThreadCount().
+     * Models already in this library are kept, so the resolver should be set
+     * before any model is added to it.
+     *
+     * @param importResolver The @c ImportResolverPtr to use, or @c nullptr to
+     * use the default resolver, which reads files from local disk.
+     */
+    void setImportResolver(const ImportResolverPtr &importResolver);
+
+    /**
+     * @brief Get the import resolver.
+     *
+     * Get the @c ImportResolver used to locate and fetch documents.
+     *
+     * @return The @c ImportResolverPtr used by this library.
+     */
+    ImportResolverPtr importResolver() const;
+
+    /**
+     * @brief Set the maximum number of threads used to parse files.
+     *
+     * Set the maximum number of threads used to fetch and parse the documents
+     * imported at a given level of the import graph. By default, only the
+     * calling thread is used, so that resolving imports never spawns threads
+     * unless asked to.
+     *
+     * @param threads The maximum number of threads, or @c 0 to use as many
+     * threads as there are hardware threads.
+     */
+    void setThreadCount(size_t threads);
+
+    /**
+     * @brief Get the maximum number of threads used to parse files.
+     *
+     * Get the maximum number of threads used to parse files.
+     *
+     * @sa setThreadCount
+     *
+     * @return The maximum number of threads, @c 0 meaning as many threads as
+     * there are hardware threads.
+     */
+    size_t threadCount() const;
+
+private:
+    ImportLibrary(); /**< Constructor */
+
+    struct ImportLibraryImpl; /**< Forward declaration for pImpl idiom. */
+    ImportLibraryImpl *mPimpl; /**< Private member to implementation pointer. */
+};
+
+} // namespace libcellml
@@ -0,0 +1,115 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/exportdefinitions.h"
+#include "libcellml/types.h"
+
+#include <memory>
+#include <string>
+
+namespace libcellml {
+
+/**
+ * @brief The ImportResolver class.
+ *
+ * The ImportResolver class is for locating and fetching the documents
+ * imported by models. By default, imported documents are files on local
+ * disk, located relative to the document that imports them. Documents can be
+ * fetched from elsewhere, e.g. from memory, an archive or a preloaded bundle,
+ * by deriving from this class and overriding location() and fetch().
+ *
+ * An import resolver may be used by several threads at the same time, so
+ * location() and fetch() must be thread safe. An exception thrown by either
+ * of them is passed on to the caller which is resolving imports, e.g. of
+ * ImportLibrary::resolveImports(), once all the threads are done.
+ */
+class LIBCELLML_EXPORT ImportResolver
+{
+public:
+    /**
+     * @brief The Buffer struct.
+     *
+     * A view of the contents of a fetched document. The contents are parsed
+     * in place, i.e. without being copied, and remain valid for as long as
+     * @c owner, if any, is alive.
+     */
+    struct Buffer
+    {
+        bool found = false; /**< Whether the document could be fetched. */
+        const char *data = nullptr; /**< The contents of the document, which need not be null terminated. */
+        size_t size = 0; /**< The size of the contents of the document. */
+        std::shared_ptr<const void> owner; /**< The owner of the contents of the document. */
+    };
+
+    virtual ~ImportResolver(); /**< Destructor */
+    ImportResolver(const ImportResolver &rhs) = delete; /**< Copy constructor */
+    ImportResolver(ImportResolver &&rhs) noexcept = delete; /**< Move constructor */
+    ImportResolver &operator=(ImportResolver rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Create an @c ImportResolver object.
+     *
+     * Factory method to create an @c ImportResolver which fetches documents
+     * from local disk.  Create an import resolver with::
+     *
+     *   ImportResolverPtr importResolver = libcellml::ImportResolver::create();
+     *
+     * @return A smart pointer to an @c ImportResolver object.
+     */
+    static ImportResolverPtr create() noexcept;
+
+    /**
+     * @brief Get the location of an imported document.
+     *
+     * Get the location of the document referred to by @p url in the document
+     * at location @p base. Two URLs referring to the same document must
+     * result in the same location, which is used to identify the document
+     * and as the base of the documents that it imports.
+     *
+     * By default, @p url is taken to be relative to the directory of
+     * @p base, and the location is the canonical form of the resulting path,
+     * i.e. its absolute form with any symbolic link and any @c . or @c ..
+     * component resolved, if the file exists.
+     *
+     * @param url The @c std::string URL of the imported document.
+     * @param base The @c std::string location of the importing document.
+     *
+     * @return The @c std::string location of the imported document.
+     */
+    virtual std::string location(const std::string &url, const std::string &base) const;
+
+    /**
+     * @brief Fetch the document at the given @p location.
+     *
+     * Fetch the contents of the document at the given @p location, as
+     * returned by location().
+     *
+     * By default, the file at @p location is memory mapped.
+     *
+     * @param location The @c std::string location of the document.
+     *
+     * @return The @c Buffer for the contents of the document, which is not
+     * found if the document cannot be fetched.
+     */
+    virtual Buffer fetch(const std::string &location) const;
+
+protected:
+    ImportResolver(); /**< Constructor */
+};
+
+} // namespace libcellml
@@ -68,7 +68,8 @@ public:
     /**
      * @brief Add a child units to this model.
      *
-     * Add a copy of the given units as a child units of this model.
+     * Add the given units as a child units of this model. If the given units
+     * already belongs to a model then it is removed from that model first.
      *
      * @param units The units to add.
      */
@@ -300,12 +301,49 @@ public:
      *
      * Resolve all @c Component and @c Units imports by loading the models
      * from local disk through relative URLs.  The @p baseFile is used to determine
-     * the full path to the source model relative to this one.
+     * the full path to the source model relative to this one.  A file which
+     * is imported several times is only parsed once, and all its imports
+     * share the same model.
      *
      * @param baseFile The @c std::string location on local disk of the source @c Model.
      */
     void resolveImports(const std::string &baseFile);
 
+    /**
+     * @brief Resolve all imports in this model using an @c ImportLibrary.
+     *
+     * Resolve all @c Component and @c Units imports using the models held
+     * by @p importLibrary, which parses a model the first time that it is
+     * needed. A file which is imported several times, whether by this model,
+     * by the models it imports or by models resolved using the same
+     * @p importLibrary, is therefore only parsed once and all its imports
+     * share the same model. The @p baseFile is used to determine the full
+     * path to the source model relative to this one.
+     *
+     * @param baseFile The @c std::string location on local disk of the source @c Model.
+     * @param importLibrary The @c ImportLibraryPtr holding the imported models.
+     */
+    void resolveImports(const std::string &baseFile, const ImportLibraryPtr &importLibrary);
+
+    /**
+     * @brief Resolve all imports in this model using an @c ImportResolver.
+     *
+     * Resolve all @c Component and @c Units imports using the documents
+     * located and fetched by @p importResolver rather than read from local
+     * disk, e.g. to resolve imports from an in-memory bundle of documents.
+     * A document which is imported several times is only fetched and parsed
+     * once, and all its imports share the same model. The @p baseFile is
+     * the location of this model, relative to which @p importResolver
+     * locates the source models.
+     *
+     * @sa ImportLibrary::setImportResolver
+     *
+     * @param baseFile The @c std::string location of the source @c Model.
+     * @param importResolver The @c ImportResolverPtr used to locate and
+     * fetch the imported documents.
+     */
+    void resolveImports(const std::string &baseFile, const ImportResolverPtr &importResolver);
+
     /**
      * @brief Test if this model has unresolved imports.
      *
@@ -319,8 +357,10 @@ public:
      * @brief Create a clone of this model.
      *
      * Creates a full separate copy of this model.  The component
-     * hierarchy and variable equivalence maps will also be copied
-     * from this model to the destination model.
+     * hierarchy and variable equivalence maps, including their mapping
+     * and connection ids, will also be copied from this model to the
+     * destination model.  Variables which use the units of this model
+     * use the corresponding units of the destination model.
      *
      * @return a new @c ModelPtr to the cloned model.
      */
@@ -344,6 +384,7 @@ private:
     explicit Model(const std::string &name); /**< Constructor with std::string parameter*/
 
     bool doAddComponent(const ComponentPtr &component) override;
+    void invalidateNameIndices() override;
 
     struct ModelImpl; /**< Forward declaration for pImpl idiom. */
     ModelImpl *mPimpl; /**< Private member to implementation pointer */
@@ -22,6 +22,7 @@ limitations under the License.
 #include "libcellml/units.h"
 
 #include <string>
+#include <vector>
 
 namespace libcellml {
 
@@ -29,10 +30,26 @@ namespace libcellml {
  * @brief The Parser class.
  *
  * The Parser class is for representing a CellML Parser.
+ *
+ * Separate @c Parser objects can be used concurrently, e.g. one per thread
+ * of a thread pool, but a given @c Parser object must not be used by several
+ * threads at the same time.
  */
 class LIBCELLML_EXPORT Parser: public Logger
 {
 public:
+    /**
+     * @brief The ParsedModel struct.
+     *
+     * The result of parsing one of the files given to parseModels(), i.e. the
+     * model parsed from that file and the errors found while parsing it.
+     */
+    struct ParsedModel
+    {
+        ModelPtr model; /**< The parsed model, @c nullptr if the file could not be opened. */
+        std::vector<ErrorPtr> errors; /**< The errors found while parsing the file. */
+    };
+
     ~Parser() override; /**< Destructor */
     Parser(const Parser &rhs) = delete; /**< Copy constructor */
     Parser(Parser &&rhs) noexcept = delete; /**< Move constructor */
@@ -62,6 +79,144 @@ public:
      */
     ModelPtr parseModel(const std::string &input);
 
+    /**
+     * @brief Create and populate a new model from a buffer.
+     *
+     * Creates and populates a new model pointer by parsing CellML
+     * entities and attributes from the @p size bytes of @p data. The buffer
+     * is parsed as is, i.e. without being copied, and need not be null
+     * terminated. A buffer larger than @c INT_MAX bytes cannot be parsed and
+     * results in an error.
+     *
+     * @param data The buffer to parse into a model.
+     * @param size The size of the buffer.
+     *
+     * @return The new @c ModelPtr deserialised from the buffer.
+     */
+    ModelPtr parseModel(const char *data, size_t size);
+
+    /**
+     * @brief Create and populate a new model from a file.
+     *
+     * Creates and populates a new model pointer by parsing CellML
+     * entities and attributes from the file at @p path. The file is memory
+     * mapped and parsed directly, i.e. without its contents being copied.
+     *
+     * If the file cannot be opened then an error is logged and @c nullptr is
+     * returned.
+     *
+     * @param path The path of the file to parse into a model.
+     *
+     * @return The new @c ModelPtr deserialised from the file, or @c nullptr
+     * if the file cannot be opened.
+     */
+    ModelPtr parseModelFromFile(const std::string &path);
+
+    /**
+     * @brief Create and populate new models from several files, in parallel.
+     *
+     * Creates and populates a new model for each of the files in @p paths,
+     * using up to @p threads threads. Each thread parses files using its own
+     * @c Parser, which has the same settings as this one, and takes the next
+     * file from its own share of @p paths or, once that share is exhausted,
+     * steals one from the share of another thread. This keeps all threads
+     * busy even when some files take much longer to parse than others.
+     *
+     * The errors found while parsing a file are returned with the model
+     * parsed from that file rather than logged in this @c Parser, whose
+     * errors are left untouched.
+     *
+     * @param paths The paths of the files to parse into models.
+     * @param threads The maximum number of threads to use, or @c 0 to use as
+     * many threads as there are hardware threads.
+     *
+     * @return The @c ParsedModel for each of the files, in the same order as
+     * @p paths.
+     */
+    std::vector<ParsedModel> parseModels(const std::vector<std::string> &paths, size_t threads = 0);
+
+    /**
+     * @brief Create and populate a new model from a binary snapshot.
+     *
+     * Creates and populates a new model pointer from the binary @p snapshot
+     * created using Printer::printModelSnapshot().
+     *
+     * If @p snapshot is not a valid snapshot or was created using an
+     * unsupported version of the snapshot format then an error is logged and
+     * @c nullptr is returned.
+     *
+     * @param snapshot The snapshot to load into a model.
+     *
+     * @return The new @c ModelPtr loaded from the snapshot, or @c nullptr if
+     * the snapshot cannot be loaded.
+     */
+    ModelPtr parseModelSnapshot(const std::string &snapshot);
+
+    /**
+     * @brief Create and populate a new model from a binary snapshot buffer.
+     *
+     * Creates and populates a new model pointer from the binary snapshot
+     * held in the @p size bytes of @p data. The snapshot is read in place,
+     * i.e. without being copied.
+     *
+     * @sa parseModelSnapshot(const std::string &)
+     *
+     * @param data The snapshot to load into a model.
+     * @param size The size of the snapshot.
+     *
+     * @return The new @c ModelPtr loaded from the snapshot, or @c nullptr if
+     * the snapshot cannot be loaded.
+     */
+    ModelPtr parseModelSnapshot(const char *data, size_t size);
+
+    /**
+     * @brief Create and populate a new model from a binary snapshot file.
+     *
+     * Creates and populates a new model pointer from the binary snapshot
+     * saved in the file at @p path. The file is memory mapped and read in
+     * place, i.e. without its contents being copied.
+     *
+     * If the file cannot be opened or does not hold a snapshot that can be
+     * loaded then an error is logged and @c nullptr is returned.
+     *
+     * @param path The path of the snapshot file to load into a model.
+     *
+     * @return The new @c ModelPtr loaded from the snapshot file, or
+     * @c nullptr if the snapshot file cannot be loaded.
+     */
+    ModelPtr parseModelSnapshotFromFile(const std::string &path);
+
+    /**
+     * @brief Set whether models are parsed in streaming mode.
+     *
+     * By default, the whole XML document is loaded in memory before a model
+     * gets populated from it. In streaming mode, the model is populated while
+     * the XML document is being read, one child of the model element at a
+     * time, and only the subtree of that child is ever held in memory. This
+     * considerably reduces the peak memory needed to parse a large model,
+     * which is then proportional to the size of its largest component rather
+     * than to the size of the whole document.
+     *
+     * Both modes result in the same model and the same errors for a well
+     * formed XML document. For a malformed XML document, the errors reported
+     * by libxml2 may differ and, in streaming mode, the model may have been
+     * partially populated.
+     *
+     * @param streaming Whether models are parsed in streaming mode.
+     */
+    void setStreaming(bool streaming);
+
+    /**
+     * @brief Test whether models are parsed in streaming mode.
+     *
+     * Test whether models are parsed in streaming mode.
+     *
+     * @sa setStreaming
+     *
+     * @return @c true if models are parsed in streaming mode, @c false otherwise.
+     */
+    bool isStreaming() const;
+
 private:
     Parser(); /**< Constructor */
 
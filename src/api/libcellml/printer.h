@@ -60,6 +60,27 @@ public:
      */
     std::string printModel(const ModelPtr &model) const;
 
+    /**
+     * @brief Serialise the @c Model to a binary snapshot.
+     *
+     * Serialise the given @p model to a versioned binary snapshot, which can
+     * be read back using Parser::parseModelSnapshot() or
+     * Parser::parseModelSnapshotFromFile(). A snapshot holds the same
+     * information as the CellML representation of @p model, but it can be
+     * loaded much faster since it does not need to be parsed. Models
+     * imported by @p model are not part of the snapshot, only their import
+     * sources are, so a snapshot is best suited to a flattened model.
+     *
+     * A snapshot uses the byte order of the machine on which it was
+     * created and can only be read on a machine with the same byte order.
+     *
+     * @param model The @c Model to serialise.
+     *
+     * @return The @c std::string of bytes holding the snapshot of the
+     * @c Model, or an empty string if @p model is @c nullptr.
+     */
+    std::string printModelSnapshot(const ModelPtr &model) const;
+
 private:
     Printer(); /**< Constructor */
 
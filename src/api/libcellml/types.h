@@ -21,6 +21,8 @@ limitations under the License.
 namespace libcellml {
 
 // General classes.
+class CompiledModelCache; /**< Forward declaration of CompiledModelCache class. */
+using CompiledModelCachePtr = std::shared_ptr<CompiledModelCache>; /**< Type definition for shared compiled model cache pointer. */
 class Error; /**< Forward declaration of Error class. */
 using ErrorPtr = std::shared_ptr<Error>; /**< Type definition for shared error pointer. */
 class Generator; /**< Forward declaration of Generator class. */
@@ -29,6 +31,10 @@ class GeneratorProfile; /**< Forward declaration of GeneratorProfile class. */
 using GeneratorProfilePtr = std::shared_ptr<GeneratorProfile>; /**< Type definition for shared generator variable pointer. */
 class GeneratorVariable; /**< Forward declaration of GeneratorVariable class. */
 using GeneratorVariablePtr = std::shared_ptr<GeneratorVariable>; /**< Type definition for shared generator variable pointer. */
+class ImportLibrary; /**< Forward declaration of ImportLibrary class. */
+using ImportLibraryPtr = std::shared_ptr<ImportLibrary>; /**< Type definition for shared import library pointer. */
+class ImportResolver; /**< Forward declaration of ImportResolver class. */
+using ImportResolverPtr = std::shared_ptr<ImportResolver>; /**< Type definition for shared import resolver pointer. */
 class Logger; /**< Forward declaration of Parser class. */
 using LoggerPtr = std::shared_ptr<Logger>; /**< Type definition for shared parser pointer. */
 class Parser; /**< Forward declaration of Parser class. */
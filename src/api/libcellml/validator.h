@@ -32,6 +32,19 @@ namespace libcellml {
 class LIBCELLML_EXPORT Validator: public Logger
 {
 public:
+    /**
+     * @brief The kind of MathML validation.
+     *
+     * The kind of validation used to check that the MathML of a model is
+     * valid: either against the W3C MathML DTD, or natively, i.e. against the
+     * subset of MathML supported by CellML 2.0.
+     */
+    enum class MathMLValidation
+    {
+        DTD, /**< Validate MathML against the W3C MathML DTD. */
+        NATIVE /**< Validate MathML against the subset of MathML supported by CellML 2.0. */
+    };
+
     ~Validator() override; /**< Destructor */
     Validator(const Validator &rhs) = delete; /**< Copy constructor */
     Validator(Validator &&rhs) noexcept = delete; /**< Move constructor */
@@ -59,6 +72,60 @@ public:
      */
     void validateModel(const ModelPtr &model);
 
+    /**
+     * @brief Set the kind of MathML validation.
+     *
+     * Set the kind of validation used to check the MathML of a model. With
+     * @c MathMLValidation::DTD, the MathML is validated against the W3C MathML
+     * DTD. With @c MathMLValidation::NATIVE, the MathML is validated, in a
+     * single pass over its tree, against the structure of the subset of MathML
+     * supported by CellML 2.0, i.e. the number of arguments of each operator,
+     * the placement of @c bvar, @c degree and @c logbase elements, the
+     * structure of @c piecewise elements, and the @c type of @c cn elements.
+     * Errors then include the line number, within the math, of the offending
+     * element. The default is @c MathMLValidation::DTD.
+     *
+     * @param mathmlValidation The @c MathMLValidation to use.
+     */
+    void setMathMLValidation(MathMLValidation mathmlValidation);
+
+    /**
+     * @brief Get the kind of MathML validation.
+     *
+     * Get the kind of validation used to check the MathML of a model.
+     *
+     * @return The @c MathMLValidation used.
+     */
+    MathMLValidation mathmlValidation() const;
+
+    /**
+     * @brief Set whether validation is incremental.
+     *
+     * Set whether this @c Validator keeps, between calls to validateModel(),
+     * the errors found in the components, units and connections of the model
+     * it last validated. With incremental validation, only the entities that
+     * have been modified since the last validation, as well as the entities
+     * that depend on them, are validated again, but the errors are the same,
+     * and in the same order, as with a full validation. This is meant for
+     * repeatedly validating a model while it is being edited. Incremental
+     * validation is off by default.
+     *
+     * @sa Entity::revision
+     *
+     * @param incremental Whether validation is incremental.
+     */
+    void setIncremental(bool incremental);
+
+    /**
+     * @brief Test whether validation is incremental.
+     *
+     * Test whether this @c Validator keeps the errors found in the model it
+     * last validated, so as to only validate again what has been modified.
+     *
+     * @return @c true if validation is incremental, @c false otherwise.
+     */
+    bool isIncremental() const;
+
 private:
     Validator(); /**< Constructor */
 
@@ -31,7 +31,7 @@ If `math` is an empty string, math will be removed from the component.";
 "Clears the math from this component.";
 
 %feature("docstring") libcellml::Component::addVariable
-"Adds variable `variable` to this component.";
+"Adds variable `variable` to this component, removing it from the component it belonged to, if any.";
 
 %feature("docstring") libcellml::Component::variable
 "Returns a Variable from this component, specified by name or index.
@@ -32,6 +32,10 @@ unset).";
 %feature("docstring") libcellml::Entity::setParent
 "Set the parent of the entity to the given entity.  This should ostensibly be a Model or a Component.";
 
+%feature("docstring") libcellml::Entity::revision
+"Returns the revision at which this entity, or any of its descendants, was last
+created or modified.";
+
 %{
 #include "libcellml/entity.h"
 #include "libcellml/model.h"
@@ -32,7 +32,8 @@
 
 %feature("docstring") libcellml::Generator::processModel
 "Process the :class:`Model` given, analysing, and
-preparing for code generation.";
+preparing for code generation. The existing analysis is reused if the :class:`Model`
+was the last one processed and its structure has not been modified since.";
 
 %feature("docstring") libcellml::Generator::modelType
 "Return the :enum:`ModelType` of the :class:`Model` that has been processed.";
@@ -52,6 +53,12 @@ preparing for code generation.";
 %feature("docstring") libcellml::Generator::variable
 "Return the variable at the given index from the variable array.";
 
+%feature("docstring") libcellml::Generator::fingerprint
+"Return the fingerprint of the :class:`Model` processed, which identifies the code that would be generated.";
+
+%feature("docstring") libcellml::Generator::isMethodModified
+"Test if the code of the given :enum:`Method` has been modified by the last processing of the :class:`Model`.";
+
 %feature("docstring") libcellml::Generator::interfaceCode
 "Return the interface code for the :class:`Model` processed.";
 
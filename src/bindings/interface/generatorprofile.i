@@ -661,7 +661,9 @@ libCellML used respectively.";
 "Return the string for the interface of the state count constant.";
 
 %feature("docstring") libcellml::GeneratorProfile::setInterfaceStateCountString
-"Set the string for the interface of the state count constant.";
+"Set the string for the interface of the state count constant. The string
+may contain the <STATE_COUNT> tag, which will be replaced with the number of
+states in the model.";
 
 %feature("docstring") libcellml::GeneratorProfile::implementationStateCountString
 "Return the string for the implementation of the state count constant.";
@@ -675,7 +677,9 @@ which will be replaced with the number of states in the model.";
 "Return the string for the interface of the variable count constant.";
 
 %feature("docstring") libcellml::GeneratorProfile::setInterfaceVariableCountString
-"Set the string for the interface of the variable count constant.";
+"Set the string for the interface of the variable count constant. The string
+may contain the <VARIABLE_COUNT> tag, which will be replaced with the number of
+variables in the model.";
 
 %feature("docstring") libcellml::GeneratorProfile::implementationVariableCountString
 "Return the string for the implementation of the variable count constant.";
@@ -685,6 +689,38 @@ which will be replaced with the number of states in the model.";
 constant. To be useful, the string should contain the <VARIABLE_COUNT>
 tag, which will be replaced with the number of states in the model.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceRootCountString
+"Return the string for the interface of the root count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceRootCountString
+"Set the string for the interface of the root count constant, which is only
+generated for a model that has resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationRootCountString
+"Return the string for the implementation of the root count constant.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationRootCountString
+"Set the string for the implementation of the root count constant, which is
+only generated for a model that has resets. To be useful, the string should
+contain the <ROOT_COUNT> tag, which will be replaced with the number of resets
+in the model.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceModelInstanceTypeString
+"Return the string for the interface of the model instance type.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceModelInstanceTypeString
+"Set the string for the interface of the model instance type. To be useful,
+the string should contain the <STATE_COUNT> and <VARIABLE_COUNT> tags, which
+will be replaced with the number of states and variables in the model.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationModelInstanceTypeString
+"Return the string for the implementation of the model instance type.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationModelInstanceTypeString
+"Set the string for the implementation of the model instance type. To be
+useful, the string should contain the <STATE_COUNT> and <VARIABLE_COUNT> tags,
+which will be replaced with the number of states and variables in the model.";
+
 %feature("docstring") libcellml::GeneratorProfile::variableTypeObjectString
 "Return the string for the data structure for the variable type object.";
 
@@ -830,13 +866,72 @@ with the name of the component, name and units of a variable.";
 %feature("docstring") libcellml::GeneratorProfile::setVariablesArrayString
 "Set the string for the name of the variables array.";
 
+%feature("docstring") libcellml::GeneratorProfile::rootsArrayString
+"Return the string for the name of the roots array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRootsArrayString
+"Set the string for the name of the roots array.";
+
+%feature("docstring") libcellml::GeneratorProfile::rootsFoundArrayString
+"Return the string for the name of the roots found array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setRootsFoundArrayString
+"Set the string for the name of the roots found array.";
+
+%feature("docstring") libcellml::GeneratorProfile::resetValueDeclarationString
+"Return the string for the declaration of a reset value.";
+
+%feature("docstring") libcellml::GeneratorProfile::setResetValueDeclarationString
+"Set the string for the declaration of a reset value. To be useful, the string should contain the <INDEX> tag,
+which will be replaced with the index of the reset value.";
+
+%feature("docstring") libcellml::GeneratorProfile::resetValueString
+"Return the string for the name of a reset value.";
+
+%feature("docstring") libcellml::GeneratorProfile::setResetValueString
+"Set the string for the name of a reset value. To be useful, the string should contain the <INDEX> tag, which
+will be replaced with the index of the reset value.";
+
+%feature("docstring") libcellml::GeneratorProfile::statesTypeString
+"Return the string for the type of the elements of the states and rates arrays.";
+
+%feature("docstring") libcellml::GeneratorProfile::setStatesTypeString
+"Set the string for the type of the elements of the states and rates arrays.";
+
+%feature("docstring") libcellml::GeneratorProfile::variablesTypeString
+"Return the string for the type of the elements of the variables array.";
+
+%feature("docstring") libcellml::GeneratorProfile::setVariablesTypeString
+"Set the string for the type of the elements of the variables array.";
+
+%feature("docstring") libcellml::GeneratorProfile::computeTypeString
+"Return the string for the type used for computations.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputeTypeString
+"Set the string for the type used for computations.";
+
+%feature("docstring") libcellml::GeneratorProfile::computePrecision
+"Return the precision used for computations.";
+
+%feature("docstring") libcellml::GeneratorProfile::setComputePrecision
+"Set the precision used for computations, updating the compute type, number suffix and mathematical functions
+accordingly.";
+
+%feature("docstring") libcellml::GeneratorProfile::numberSuffixString
+"Return the string for the suffix of numerical constants.";
+
+%feature("docstring") libcellml::GeneratorProfile::setNumberSuffixString
+"Set the string for the suffix of numerical constants, e.g. \"f\" for single
+precision C code.";
+
 %feature("docstring") libcellml::GeneratorProfile::returnCreatedArrayString
 "Return the string for returning a created array.";
 
 %feature("docstring") libcellml::GeneratorProfile::setReturnCreatedArrayString
 "Set the string for returning a created array. To be useful, the
 string should contain the <ARRAY_SIZE> tag, which will be replaced with
-the size of the array to be created.";
+the size of the array to be created, and it may contain the <ARRAY_TYPE> tag,
+which will be replaced with the type of the elements of the array.";
 
 %feature("docstring") libcellml::GeneratorProfile::interfaceCreateStatesArrayMethodString
 "Return the string for the interface to create the states array.";
@@ -931,6 +1026,30 @@ be replaced with some code to create the variables array.";
 %feature("docstring") libcellml::GeneratorProfile::setImplementationComputeVariablesMethodString
 "Set the string for the implementation to compute variables.";
 
+%feature("docstring") libcellml::GeneratorProfile::interfaceComputeRootsMethodString
+"Return the string for the interface to compute roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceComputeRootsMethodString
+"Set the string for the interface to compute roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationComputeRootsMethodString
+"Return the string for the implementation to compute roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationComputeRootsMethodString
+"Set the string for the implementation to compute roots.";
+
+%feature("docstring") libcellml::GeneratorProfile::interfaceApplyResetsMethodString
+"Return the string for the interface to apply resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setInterfaceApplyResetsMethodString
+"Set the string for the interface to apply resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::implementationApplyResetsMethodString
+"Return the string for the implementation to apply resets.";
+
+%feature("docstring") libcellml::GeneratorProfile::setImplementationApplyResetsMethodString
+"Set the string for the implementation to apply resets.";
+
 %feature("docstring") libcellml::GeneratorProfile::emptyMethodString
 "Return the string for an empty method.";
 
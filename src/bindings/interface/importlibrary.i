@@ -0,0 +1,49 @@
+%module(package="libcellml") importlibrary
+
+#define LIBCELLML_EXPORT
+
+%include <std_string.i>
+
+%import "createconstructor.i"
+%import "types.i"
+
+%feature("docstring") libcellml::ImportLibrary
+"Shares the models imported by other models, so that an imported file is only parsed once.";
+
+%feature("docstring") libcellml::ImportLibrary::resolveImports
+"Resolves all imports in the given :class:`Model`, using the models held by this library. The files which are not
+yet in this library are parsed and added to it. The ``baseFile`` is the location of the given model.";
+
+%feature("docstring") libcellml::ImportLibrary::model
+"Returns the :class:`Model` parsed from the file at the given URL, parsing the file and resolving its imports the
+first time that it is needed, or `None` if the file cannot be read.";
+
+%feature("docstring") libcellml::ImportLibrary::hasModel
+"Tests whether the model at the given URL is in this library.";
+
+%feature("docstring") libcellml::ImportLibrary::modelCount
+"Returns the number of models in this library.";
+
+%feature("docstring") libcellml::ImportLibrary::removeAllModels
+"Removes all the models from this library.";
+
+%feature("docstring") libcellml::ImportLibrary::setThreadCount
+"Sets the maximum number of threads used to parse the files imported at a given level of the import graph, `0`
+meaning as many threads as there are hardware threads. By default, only the calling thread is used.";
+
+%feature("docstring") libcellml::ImportLibrary::threadCount
+"Returns the maximum number of threads used to parse files.";
+
+// Import resolvers are C++ only: a resolver implemented in Python would get
+// called from the threads resolving imports.
+%ignore libcellml::ImportLibrary::setImportResolver;
+%ignore libcellml::ImportLibrary::importResolver;
+
+%{
+#include "libcellml/importlibrary.h"
+%}
+
+%create_constructor(ImportLibrary)
+
+%include "libcellml/types.h"
+%include "libcellml/importlibrary.h"
@@ -12,7 +12,7 @@
 "Represents a CellML model.";
 
 %feature("docstring") libcellml::Model::addUnits
-"Add a copy of the given Units to this model.";
+"Add the given Units to this model, removing it from the model it belonged to, if any.";
 
 %feature("docstring") libcellml::Model::units
 "Returns a Units object from this Model, specified by index or name.
@@ -53,7 +53,12 @@ Only the first matching Units is removed and returned.";
 
 Resolves all :class:`Component` and :class:`Units` imports by loading the
 models from local disk through relative urls. The ``baseFile`` is used to
-determine the full path to the source model relative to this one.";
+determine the full path to the source model relative to this one. If an
+:class:`ImportLibrary` is given, the imported models are taken from it, so that
+a file imported several times is only parsed once.";
+
+// Import resolvers are C++ only, see importlibrary.i.
+%ignore libcellml::Model::resolveImports(const std::string &baseFile, const ImportResolverPtr &importResolver);
 
 %feature("docstring") libcellml::Model::hasUnresolvedImports
 "Tests if this model has unresolved imports.";
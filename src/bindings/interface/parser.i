@@ -15,6 +15,88 @@
 %feature("docstring") libcellml::Parser::parseModel
 "Parses a string and returns a :class:`Model`.";
 
+%feature("docstring") libcellml::Parser::parseModelFromFile
+"Parses the file at the given path and returns a :class:`Model`, or `None` if the file cannot be opened.";
+
+%ignore libcellml::Parser::parseModel(const char *data, size_t size);
+%ignore libcellml::Parser::ParsedModel;
+
+%feature("docstring") libcellml::Parser::parseModels
+"Parses the files at the given paths, concurrently using up to the given number of threads (`0` meaning as many
+threads as there are hardware threads), and returns, for each file, a tuple holding the :class:`Model` parsed from
+it, or `None` if the file cannot be opened, and the list of :class:`Error` found while parsing it.";
+
+%typemap(in) const std::vector<std::string> &paths (std::vector<std::string> temp) {
+    PyObject *iterator = PyObject_GetIter($input);
+    if (iterator == nullptr) {
+        SWIG_exception_fail(SWIG_TypeError, "in method '$symname', argument $argnum must be an iterable of strings");
+    }
+    PyObject *item;
+    while ((item = PyIter_Next(iterator)) != nullptr) {
+        Py_ssize_t size = 0;
+        const char *path = PyUnicode_Check(item) ? PyUnicode_AsUTF8AndSize(item, &size) : nullptr;
+        if (path != nullptr) {
+            temp.emplace_back(path, size_t(size));
+        }
+        Py_DECREF(item);
+        if (path == nullptr) {
+            Py_DECREF(iterator);
+            SWIG_exception_fail(SWIG_TypeError, "in method '$symname', argument $argnum must be an iterable of strings");
+        }
+    }
+    Py_DECREF(iterator);
+    if (PyErr_Occurred() != nullptr) {
+        SWIG_fail;
+    }
+    $1 = &temp;
+}
+
+%typemap(out) std::vector<libcellml::Parser::ParsedModel> parseModels {
+    $result = PyList_New(Py_ssize_t($1.size()));
+    for (size_t i = 0; i < $1.size(); ++i) {
+        const libcellml::Parser::ParsedModel &parsedModel = $1[i];
+        PyObject *model = Py_None;
+        if (parsedModel.model != nullptr) {
+            model = SWIG_NewPointerObj(SWIG_as_voidptr(new std::shared_ptr<  libcellml::Model >(parsedModel.model)), $descriptor(std::shared_ptr<  libcellml::Model > *), SWIG_POINTER_OWN);
+        } else {
+            Py_INCREF(model);
+        }
+        PyObject *errors = PyList_New(Py_ssize_t(parsedModel.errors.size()));
+        for (size_t j = 0; j < parsedModel.errors.size(); ++j) {
+            PyList_SET_ITEM(errors, Py_ssize_t(j), SWIG_NewPointerObj(SWIG_as_voidptr(new std::shared_ptr<  libcellml::Error >(parsedModel.errors[j])), $descriptor(std::shared_ptr<  libcellml::Error > *), SWIG_POINTER_OWN));
+        }
+        PyList_SET_ITEM($result, Py_ssize_t(i), Py_BuildValue("(NN)", model, errors));
+    }
+}
+
+%feature("docstring") libcellml::Parser::parseModelSnapshot
+"Loads the given binary model snapshot, as a `bytes` object, and returns a :class:`Model`, or `None` if the snapshot
+cannot be loaded.";
+
+%feature("docstring") libcellml::Parser::parseModelSnapshotFromFile
+"Loads the binary model snapshot saved in the file at the given path and returns a :class:`Model`, or `None` if the
+snapshot file cannot be loaded.";
+
+%ignore libcellml::Parser::parseModelSnapshot(const char *data, size_t size);
+
+// A snapshot is binary data, so it is given as bytes rather than as a string.
+%typemap(in) const std::string &snapshot (std::string temp) {
+    char *data = nullptr;
+    Py_ssize_t size = 0;
+    if (!PyBytes_Check($input) || (PyBytes_AsStringAndSize($input, &data, &size) == -1)) {
+        SWIG_exception_fail(SWIG_TypeError, "in method '$symname', argument $argnum must be bytes");
+    }
+    temp.assign(data, size_t(size));
+    $1 = &temp;
+}
+
+%feature("docstring") libcellml::Parser::setStreaming
+"Sets whether models are parsed in streaming mode, i.e. populated while their XML document is being read,
+one child of the model element at a time, which reduces the peak memory needed to parse a large model.";
+
+%feature("docstring") libcellml::Parser::isStreaming
+"Tests whether models are parsed in streaming mode.";
+
 %{
 #include "libcellml/parser.h"
 %}
@@ -15,6 +15,16 @@
 %feature("docstring") libcellml::Printer::printModel
 "Serialises the given :class:`Model` to an XML string.";
 
+%feature("docstring") libcellml::Printer::printModelSnapshot
+"Serialises the given :class:`Model` to a versioned binary snapshot, as a `bytes` object, which can be loaded back
+using :meth:`Parser.parseModelSnapshot`.";
+
+// A snapshot is binary data, so it is returned as bytes rather than as a
+// string.
+%typemap(out) std::string printModelSnapshot {
+    $result = PyBytes_FromStringAndSize($1.data(), Py_ssize_t($1.size()));
+}
+
 %{
 #include "libcellml/printer.h"
 %}
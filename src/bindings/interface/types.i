@@ -11,6 +11,7 @@ Only meant to be included, shouldn't be passed to cmake as a module!
 %shared_ptr(libcellml::Error)
 %shared_ptr(libcellml::Generator)
 %shared_ptr(libcellml::GeneratorProfile)
+%shared_ptr(libcellml::ImportLibrary)
 %shared_ptr(libcellml::ImportSource)
 %shared_ptr(libcellml::ImportedEntity)
 %shared_ptr(libcellml::Logger)
@@ -74,12 +75,38 @@ Only meant to be included, shouldn't be passed to cmake as a module!
   }
 }
 
+%typemap(in) libcellml::Generator::Method (int val, int ecode) {
+  ecode = SWIG_AsVal(int)($input, &val);
+  if (!SWIG_IsOK(ecode)) {
+    %argument_fail(ecode, "$type", $symname, $argnum);
+  } else {
+    if (val < %static_cast(libcellml::Generator::Method::INITIALIZE_STATES_AND_CONSTANTS, int) || %static_cast(libcellml::Generator::Method::APPLY_RESETS, int) < val) {
+      %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
+    }
+    $1 = %static_cast(val,$basetype);
+  }
+}
+
+// New profiles are appended to GeneratorProfile::Profile, so PYTHON_NUMPY is
+// its last value.
 %typemap(in) libcellml::GeneratorProfile::Profile (int val, int ecode) {
   ecode = SWIG_AsVal(int)($input, &val);
   if (!SWIG_IsOK(ecode)) {
     %argument_fail(ecode, "$type", $symname, $argnum);
   } else {
-    if (val < %static_cast(libcellml::GeneratorProfile::Profile::C, int) || %static_cast(libcellml::GeneratorProfile::Profile::PYTHON, int) < val) {
+    if (val < %static_cast(libcellml::GeneratorProfile::Profile::C, int) || %static_cast(libcellml::GeneratorProfile::Profile::PYTHON_NUMPY, int) < val) {
+      %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
+    }
+    $1 = %static_cast(val,$basetype);
+  }
+}
+
+%typemap(in) libcellml::GeneratorProfile::Precision (int val, int ecode) {
+  ecode = SWIG_AsVal(int)($input, &val);
+  if (!SWIG_IsOK(ecode)) {
+    %argument_fail(ecode, "$type", $symname, $argnum);
+  } else {
+    if (val < %static_cast(libcellml::GeneratorProfile::Precision::SINGLE, int) || %static_cast(libcellml::GeneratorProfile::Precision::DOUBLE, int) < val) {
       %argument_fail(ecode, "$type is not a valid value for the enumeration.", $symname, $argnum);
     }
     $1 = %static_cast(val,$basetype);
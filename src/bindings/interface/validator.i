@@ -13,6 +13,21 @@
 "Validate the given `model` and its encapsulated entities using the CellML 2.0
 Specification. Any errors will be logged in the `Validator`.";
 
+%feature("docstring") libcellml::Validator::setMathMLValidation
+"Set the kind of validation used to check the MathML of a model, i.e. against
+the W3C MathML DTD or natively against the subset of MathML supported by
+CellML 2.0.";
+
+%feature("docstring") libcellml::Validator::mathmlValidation
+"Get the kind of validation used to check the MathML of a model.";
+
+%feature("docstring") libcellml::Validator::setIncremental
+"Set whether validation is incremental, i.e. whether only the entities that
+have been modified since the last validation of a model are validated again.";
+
+%feature("docstring") libcellml::Validator::isIncremental
+"Test whether validation is incremental.";
+
 %{
 #include "libcellml/validator.h"
 %}
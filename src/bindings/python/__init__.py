@@ -12,6 +12,7 @@ from libcellml.error import Error
 from libcellml.generator import Generator
 from libcellml.generator import GeneratorVariable
 from libcellml.generatorprofile import GeneratorProfile
+from libcellml.importlibrary import ImportLibrary
 from libcellml.importsource import ImportSource
 from libcellml.model import Model
 from libcellml.parser import Parser
@@ -62,9 +63,27 @@ convert(Generator, 'ModelType', [
     'OVERCONSTRAINED',
     'UNSUITABLY_CONSTRAINED',
     ])
+convert(Generator, 'Method', [
+    'INITIALIZE_STATES_AND_CONSTANTS',
+    'COMPUTE_COMPUTED_CONSTANTS',
+    'COMPUTE_RATES',
+    'COMPUTE_VARIABLES',
+    'COMPUTE_ROOTS',
+    'APPLY_RESETS',
+    ])
 convert(GeneratorProfile, 'Profile', [
     'C',
     'PYTHON',
+    'C_STATIC',
+    'PYTHON_NUMPY',
+    ])
+convert(GeneratorProfile, 'Precision', [
+    'SINGLE',
+    'DOUBLE',
+    ])
+convert(Validator, 'MathMLValidation', [
+    'DTD',
+    'NATIVE',
     ])
 convert(Variable, 'InterfaceType', [
     'NONE',
@@ -0,0 +1,506 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/compiledmodelcache.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#ifdef _WIN32
+#    include <direct.h>
+#    include <process.h>
+#    include <windows.h>
+#else
+#    include <dlfcn.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#include "libcellml/generator.h"
+#include "libcellml/generatorprofile.h"
+#include "utilities.h"
+
+namespace libcellml {
+
+#ifdef _WIN32
+using LibraryHandle = HMODULE;
+
+static const std::string SHARED_LIBRARY_EXTENSION = ".dll";
+static const std::string DEFAULT_COMPILER_COMMAND = "cl /nologo /LD /O2 <INPUT> /Fe<OUTPUT>";
+#else
+using LibraryHandle = void *;
+
+#    ifdef __APPLE__
+static const std::string SHARED_LIBRARY_EXTENSION = ".dylib";
+#    else
+static const std::string SHARED_LIBRARY_EXTENSION = ".so";
+#    endif
+static const std::string DEFAULT_COMPILER_COMMAND = "cc -shared -fPIC -O2 -o <OUTPUT> <INPUT> -lm";
+#endif
+
+/**
+ * @brief The CompiledModelCache::CompiledModelCacheImpl struct.
+ *
+ * The private implementation for the CompiledModelCache class.
+ */
+struct CompiledModelCache::CompiledModelCacheImpl
+{
+    CompiledModelCache *mCompiledModelCache = nullptr;
+
+    std::string mCacheDirectory;
+    std::string mCompilerCommand = DEFAULT_COMPILER_COMMAND;
+
+    std::map<std::string, LibraryHandle> mLibraries;
+
+    void addError(const std::string &description);
+
+    std::string cacheDirectory() const;
+
+    bool isPrivateDirectory(const std::string &directory);
+    bool compileLibrary(const GeneratorPtr &generator,
+                        const std::string &modelDirectory,
+                        const std::string &library);
+    bool compileLibrary(const GeneratorPtr &generator,
+                        const std::string &interface,
+                        const std::string &implementation,
+                        const std::string &temporaryLibrary,
+                        const std::string &library);
+    LibraryHandle loadLibrary(const GeneratorPtr &generator,
+                              const std::string &key);
+};
+
+static bool fileExists(const std::string &fileName)
+{
+    std::ifstream file(fileName);
+
+    return file.good();
+}
+
+static bool writeFile(const std::string &fileName, const std::string &contents)
+{
+    std::ofstream file(fileName, std::ios_base::binary);
+
+    file << contents;
+
+    return file.good();
+}
+
+static bool makeDirectory(const std::string &directory)
+{
+    // Create the given directory and any of its missing parents, making sure
+    // that only the current user can access the ones that we create.
+
+    for (size_t i = 1; i <= directory.size(); ++i) {
+        if ((i == directory.size()) || (directory[i] == '/') || (directory[i] == '\\')) {
+            std::string subDirectory = directory.substr(0, i);
+
+#ifdef _WIN32
+            _mkdir(subDirectory.c_str());
+#else
+            mkdir(subDirectory.c_str(), 0700);
+#endif
+        }
+    }
+
+#ifdef _WIN32
+    struct _stat info = {};
+
+    return (_stat(directory.c_str(), &info) == 0) && ((info.st_mode & _S_IFDIR) != 0);
+#else
+    struct stat info = {};
+
+    return (stat(directory.c_str(), &info) == 0) && S_ISDIR(info.st_mode);
+#endif
+}
+
+static bool isPrivate(const std::string &path, bool directory)
+{
+    // Check that the given file or directory belongs to the current user and
+    // that no one else can modify it, so that no one else can get us to load
+    // a shared library of theirs.
+    // Note: on Windows, we rely on the cache directory being in the profile of
+    //       the current user, which other users cannot access by default.
+
+#ifdef _WIN32
+    (void)path;
+    (void)directory;
+
+    return true;
+#else
+    struct stat info = {};
+
+    if ((lstat(path.c_str(), &info) != 0)
+        || (directory && !S_ISDIR(info.st_mode))
+        || (!directory && !S_ISREG(info.st_mode))) {
+        return false;
+    }
+
+    return (info.st_uid == geteuid())
+           && ((info.st_mode & (S_IWGRP | S_IWOTH)) == 0);
+#endif
+}
+
+static std::string uniqueSuffix()
+{
+    // Return a suffix that is unique to this process and, within it, to this
+    // call, so that neither another process nor another of our threads can
+    // use the same temporary file names as us.
+
+    static std::atomic<size_t> counter(0);
+
+#ifdef _WIN32
+    return std::to_string(_getpid()) + "." + std::to_string(++counter);
+#else
+    return std::to_string(getpid()) + "." + std::to_string(++counter);
+#endif
+}
+
+static void removeDirectory(const std::string &directory)
+{
+#ifdef _WIN32
+    _rmdir(directory.c_str());
+#else
+    rmdir(directory.c_str());
+#endif
+}
+
+static std::string quotedPath(const std::string &path)
+{
+    return "\"" + path + "\"";
+}
+
+static void *librarySymbol(LibraryHandle library, const std::string &name)
+{
+#ifdef _WIN32
+    return reinterpret_cast<void *>(GetProcAddress(library, name.c_str()));
+#else
+    return dlsym(library, name.c_str());
+#endif
+}
+
+static void closeLibrary(LibraryHandle library)
+{
+#ifdef _WIN32
+    FreeLibrary(library);
+#else
+    dlclose(library);
+#endif
+}
+
+void CompiledModelCache::CompiledModelCacheImpl::addError(const std::string &description)
+{
+    ErrorPtr err = Error::create();
+
+    err->setDescription(description);
+    err->setKind(Error::Kind::GENERATOR);
+
+    mCompiledModelCache->addError(err);
+}
+
+std::string CompiledModelCache::CompiledModelCacheImpl::cacheDirectory() const
+{
+    if (!mCacheDirectory.empty()) {
+        return mCacheDirectory;
+    }
+
+    // Use a cache directory that belongs to the current user rather than one
+    // in the system's temporary directory, which other users can write to.
+
+#ifdef _WIN32
+    const char *cacheDirectory = std::getenv("LOCALAPPDATA");
+
+    if ((cacheDirectory != nullptr) && (*cacheDirectory != '\0')) {
+        return std::string(cacheDirectory) + "/libcellml";
+    }
+
+    const char *temporaryDirectory = std::getenv("TEMP");
+
+    return std::string((temporaryDirectory != nullptr) ? temporaryDirectory : ".") + "/libcellml";
+#else
+    const char *cacheDirectory = std::getenv("XDG_CACHE_HOME");
+
+    if ((cacheDirectory != nullptr) && (*cacheDirectory == '/')) {
+        return std::string(cacheDirectory) + "/libcellml";
+    }
+
+    const char *homeDirectory = std::getenv("HOME");
+
+    if ((homeDirectory != nullptr) && (*homeDirectory == '/')) {
+        return std::string(homeDirectory) + "/.cache/libcellml";
+    }
+
+    // There is no home directory, so fall back to a directory in the system's
+    // temporary directory that is specific to the current user. Whether it
+    // really belongs to the current user gets checked before it is used.
+
+    const char *temporaryDirectory = std::getenv("TMPDIR");
+
+    return std::string((temporaryDirectory != nullptr) ? temporaryDirectory : "/tmp") + "/libcellml-" + std::to_string(geteuid());
+#endif
+}
+
+bool CompiledModelCache::CompiledModelCacheImpl::isPrivateDirectory(const std::string &directory)
+{
+    if (!makeDirectory(directory)) {
+        addError("Cache directory '" + directory + "' could not be created.");
+
+        return false;
+    }
+
+    if (!isPrivate(directory, true)) {
+        addError("Cache directory '" + directory + "' does not belong to the current user or can be modified by other users.");
+
+        return false;
+    }
+
+    return true;
+}
+
+bool CompiledModelCache::CompiledModelCacheImpl::compileLibrary(const GeneratorPtr &generator,
+                                                                const std::string &modelDirectory,
+                                                                const std::string &library)
+{
+    // Save the generated code to a temporary directory of our own and compile
+    // it to a temporary shared library, which we then rename, so that neither
+    // another process nor another of our threads ever sees partially written
+    // files of ours.
+
+    std::string temporaryDirectory = modelDirectory + "/" + uniqueSuffix() + ".tmp";
+
+    if (!makeDirectory(temporaryDirectory)) {
+        addError("Cache directory '" + temporaryDirectory + "' could not be created.");
+
+        return false;
+    }
+
+    std::string interface = temporaryDirectory + "/model.h";
+    std::string implementation = temporaryDirectory + "/model.c";
+    std::string temporaryLibrary = temporaryDirectory + "/model" + SHARED_LIBRARY_EXTENSION;
+    bool res = compileLibrary(generator, interface, implementation, temporaryLibrary, library);
+
+    std::remove(interface.c_str());
+    std::remove(implementation.c_str());
+    std::remove(temporaryLibrary.c_str());
+
+    removeDirectory(temporaryDirectory);
+
+    return res;
+}
+
+bool CompiledModelCache::CompiledModelCacheImpl::compileLibrary(const GeneratorPtr &generator,
+                                                                const std::string &interface,
+                                                                const std::string &implementation,
+                                                                const std::string &temporaryLibrary,
+                                                                const std::string &library)
+{
+    if (!writeFile(interface, generator->interfaceCode())
+        || !writeFile(implementation, generator->implementationCode())) {
+        addError("The generated code could not be saved to '" + implementation + "'.");
+
+        return false;
+    }
+
+    std::string command = mCompilerCommand;
+    size_t inputPos = command.find("<INPUT>");
+
+    if (inputPos != std::string::npos) {
+        command.replace(inputPos, 7, quotedPath(implementation));
+    }
+
+    size_t outputPos = command.find("<OUTPUT>");
+
+    if (outputPos != std::string::npos) {
+        command.replace(outputPos, 8, quotedPath(temporaryLibrary));
+    }
+
+    if ((inputPos == std::string::npos) || (outputPos == std::string::npos)) {
+        addError("Compiler command '" + mCompilerCommand + "' does not contain both the <INPUT> and <OUTPUT> placeholders.");
+
+        return false;
+    }
+
+    if ((std::system(command.c_str()) != 0) || !fileExists(temporaryLibrary)) {
+        addError("Compiler command '" + command + "' failed.");
+
+        return false;
+    }
+
+#ifndef _WIN32
+    // Make sure that no one else can modify our shared library, whatever the
+    // umask of the current user.
+
+    chmod(temporaryLibrary.c_str(), 0700);
+#endif
+
+    if (std::rename(temporaryLibrary.c_str(), library.c_str()) != 0) {
+        // Another process may have compiled the same model in the meantime,
+        // in which case we can use its shared library.
+
+        if (!fileExists(library)) {
+            addError("Shared library '" + library + "' could not be created.");
+
+            return false;
+        }
+    }
+
+    return true;
+}
+
+LibraryHandle CompiledModelCache::CompiledModelCacheImpl::loadLibrary(const GeneratorPtr &generator,
+                                                                      const std::string &key)
+{
+    auto iter = mLibraries.find(key);
+
+    if (iter != mLibraries.end()) {
+        return iter->second;
+    }
+
+    // Only use a shared library that we or another process of the current
+    // user have compiled, i.e. one in directories that only the current user
+    // can modify.
+
+    std::string modelDirectory = cacheDirectory() + "/" + key;
+    std::string library = modelDirectory + "/model" + SHARED_LIBRARY_EXTENSION;
+
+    if (!isPrivateDirectory(cacheDirectory())
+        || !isPrivateDirectory(modelDirectory)
+        || (!fileExists(library)
+            && !compileLibrary(generator, modelDirectory, library))) {
+        return nullptr;
+    }
+
+    if (!isPrivate(library, false)) {
+        addError("Shared library '" + library + "' does not belong to the current user or can be modified by other users.");
+
+        return nullptr;
+    }
+
+#ifdef _WIN32
+    LibraryHandle handle = LoadLibraryA(library.c_str());
+#else
+    LibraryHandle handle = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+#endif
+
+    if (handle == nullptr) {
+        addError("Shared library '" + library + "' could not be loaded.");
+
+        return nullptr;
+    }
+
+    mLibraries[key] = handle;
+
+    return handle;
+}
+
+CompiledModelCache::CompiledModelCache()
+    : mPimpl(new CompiledModelCacheImpl())
+{
+    mPimpl->mCompiledModelCache = this;
+}
+
+CompiledModelCache::~CompiledModelCache()
+{
+    for (const auto &library : mPimpl->mLibraries) {
+        closeLibrary(library.second);
+    }
+
+    delete mPimpl;
+}
+
+CompiledModelCachePtr CompiledModelCache::create() noexcept
+{
+    return std::shared_ptr<CompiledModelCache> {new CompiledModelCache {}};
+}
+
+void CompiledModelCache::setCacheDirectory(const std::string &directory)
+{
+    mPimpl->mCacheDirectory = directory;
+}
+
+std::string CompiledModelCache::cacheDirectory() const
+{
+    return mPimpl->cacheDirectory();
+}
+
+void CompiledModelCache::setCompilerCommand(const std::string &command)
+{
+    mPimpl->mCompilerCommand = command;
+}
+
+std::string CompiledModelCache::compilerCommand() const
+{
+    return mPimpl->mCompilerCommand;
+}
+
+CompiledModelCache::Methods CompiledModelCache::methods(const GeneratorPtr &generator)
+{
+    Methods res;
+
+    if ((generator == nullptr) || generator->fingerprint().empty()) {
+        mPimpl->addError("The generator has not processed a valid model.");
+
+        return res;
+    }
+
+    GeneratorProfilePtr profile = generator->profile();
+
+    if ((profile->profile() != GeneratorProfile::Profile::C)
+        || !profile->hasInterface()
+        || (profile->statesTypeString() != "double")
+        || (profile->variablesTypeString() != "double")
+        || (profile->computeTypeString() != "double")) {
+        mPimpl->addError("The generator profile does not generate double precision C code with an interface.");
+
+        return res;
+    }
+
+    // The compiler command is part of our key since different compiler
+    // commands may result in different shared libraries.
+
+    std::string key = sha1(std::vector<std::string> {generator->fingerprint(), mPimpl->mCompilerCommand});
+    LibraryHandle library = mPimpl->loadLibrary(generator, key);
+
+    if (library == nullptr) {
+        return res;
+    }
+
+    void *initializeStatesAndConstants = librarySymbol(library, "initializeStatesAndConstants");
+    void *computeComputedConstants = librarySymbol(library, "computeComputedConstants");
+    void *computeRates = librarySymbol(library, "computeRates");
+    void *computeVariables = librarySymbol(library, "computeVariables");
+
+    if ((initializeStatesAndConstants == nullptr)
+        || (computeComputedConstants == nullptr)
+        || (computeRates == nullptr)
+        || (computeVariables == nullptr)) {
+        mPimpl->addError("The compiled model does not provide all the compute methods.");
+
+        return res;
+    }
+
+    res.initializeStatesAndConstants = reinterpret_cast<InitializeStatesAndConstantsMethod>(initializeStatesAndConstants);
+    res.computeComputedConstants = reinterpret_cast<ComputeComputedConstantsMethod>(computeComputedConstants);
+    res.computeRates = reinterpret_cast<ComputeRatesMethod>(computeRates);
+    res.computeVariables = reinterpret_cast<ComputeVariablesMethod>(computeVariables);
+
+    return res;
+}
+
+} // namespace libcellml
@@ -17,6 +17,7 @@ limitations under the License.
 #include "libcellml/component.h"
 
 #include <algorithm>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -24,10 +25,29 @@ limitations under the License.
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
 
+#include "componentmath.h"
+#include "nameindex.h"
 #include "utilities.h"
 
 namespace libcellml {
 
+/**
+ * @brief The ComponentMathData struct.
+ *
+ * The math of a component, together with its parsed form once it has been
+ * needed. Math data is shared between a component and its clones, and is
+ * never modified once shared: a component that modifies its math gets its own
+ * math data, i.e. math data is copied on write.
+ */
+struct ComponentMathData
+{
+    std::string mMath; /**< The math string. */
+    XmlDocPtr mParsedMath; /**< The parsed math, if it has been needed. */
+    std::mutex mParsedMathMutex; /**< The mutex guarding the parsing of the math. */
+};
+
+using ComponentMathDataPtr = std::shared_ptr<ComponentMathData>; /**< Type definition for shared math data. */
+
 /**
  * @brief The Component::ComponentImpl struct.
  *
@@ -37,9 +57,10 @@ namespace libcellml {
  */
 struct Component::ComponentImpl
 {
-    std::string mMath;
+    ComponentMathDataPtr mMathData;
     std::vector<ResetPtr> mResets;
     std::vector<VariablePtr> mVariables;
+    NameIndex<Variable> mVariableIndex;
 
     std::vector<ResetPtr>::iterator findReset(const ResetPtr &reset);
     std::vector<VariablePtr>::iterator findVariable(const std::string &name);
@@ -48,8 +69,7 @@ struct Component::ComponentImpl
 
 std::vector<VariablePtr>::iterator Component::ComponentImpl::findVariable(const std::string &name)
 {
-    return std::find_if(mVariables.begin(), mVariables.end(),
-                        [=](const VariablePtr &v) -> bool { return v->name() == name; });
+    return mVariableIndex.find(mVariables, name);
 }
 
 std::vector<VariablePtr>::iterator Component::ComponentImpl::findVariable(const VariablePtr &variable)
@@ -81,6 +101,9 @@ Component::~Component()
         for (const auto &variable : mPimpl->mVariables) {
             variable->removeParent();
         }
+        for (const auto &reset : mPimpl->mResets) {
+            reset->removeParent();
+        }
     }
     delete mPimpl;
 }
@@ -113,6 +136,12 @@ bool Component::doAddComponent(const ComponentPtr &component)
     return ComponentEntity::doAddComponent(component);
 }
 
+void Component::invalidateNameIndices()
+{
+    ComponentEntity::invalidateNameIndices();
+    mPimpl->mVariableIndex.invalidate();
+}
+
 void Component::setSourceComponent(const ImportSourcePtr &importSource, const std::string &name)
 {
     setImportSource(importSource);
@@ -121,34 +150,84 @@ void Component::setSourceComponent(const ImportSourcePtr &importSource, const st
 
 void Component::appendMath(const std::string &math)
 {
-    mPimpl->mMath.append(math);
+    if ((mPimpl->mMathData != nullptr) && (mPimpl->mMathData.use_count() == 1)) {
+        mPimpl->mMathData->mMath.append(math);
+        mPimpl->mMathData->mParsedMath = nullptr;
+        markAsModified();
+    } else {
+        setMath(Component::math() + math);
+    }
 }
 
 std::string Component::math() const
 {
-    return mPimpl->mMath;
+    return (mPimpl->mMathData != nullptr) ? mPimpl->mMathData->mMath : std::string();
 }
 
 void Component::setMath(const std::string &math)
 {
-    mPimpl->mMath = math;
+    if (math.empty()) {
+        mPimpl->mMathData = nullptr;
+    } else {
+        mPimpl->mMathData = std::make_shared<ComponentMathData>();
+        mPimpl->mMathData->mMath = math;
+    }
+    markAsModified();
 }
 
 void Component::removeMath()
 {
-    mPimpl->mMath.clear();
+    mPimpl->mMathData = nullptr;
+    markAsModified();
+}
+
+XmlDocPtr ComponentMath::parsedMath(const ComponentPtr &component)
+{
+    ComponentMathDataPtr mathData = component->mPimpl->mMathData;
+
+    if (mathData == nullptr) {
+        return nullptr;
+    }
+
+    // Parse the math of the given component, unless it has already been
+    // parsed, possibly for another component sharing the same math. The lock
+    // ensures that concurrent readers (e.g. a validator and a generator) do
+    // not parse the math at the same time.
+
+    std::lock_guard<std::mutex> lock(mathData->mParsedMathMutex);
+
+    if (mathData->mParsedMath == nullptr) {
+        mathData->mParsedMath = std::make_shared<XmlDoc>();
+        mathData->mParsedMath->parse(mathData->mMath);
+    }
+
+    return mathData->mParsedMath;
+}
+
+void ComponentMath::shareMath(const Component &source, const ComponentPtr &component)
+{
+    component->mPimpl->mMathData = source.mPimpl->mMathData;
 }
 
 void Component::addVariable(const VariablePtr &variable)
 {
+    auto owner = std::dynamic_pointer_cast<Component>(variable->parent());
+    if (owner != nullptr) {
+        owner->removeVariable(variable);
+    }
     mPimpl->mVariables.push_back(variable);
+    mPimpl->mVariableIndex.append(mPimpl->mVariables);
     variable->setParent(shared_from_this());
+    markAsModified();
 }
 
 bool Component::removeVariable(size_t index)
 {
     if (index < mPimpl->mVariables.size()) {
+        VariablePtr variable = mPimpl->mVariables.at(index);
         mPimpl->mVariables.erase(mPimpl->mVariables.begin() + int64_t(index));
+        mPimpl->mVariableIndex.erase(mPimpl->mVariables, variable);
+        markAsModified();
         return true;
     }
 
@@ -159,7 +238,10 @@ bool Component::removeVariable(const std::string &name)
 {
     auto result = mPimpl->findVariable(name);
     if (result != mPimpl->mVariables.end()) {
+        VariablePtr variable = *result;
         mPimpl->mVariables.erase(result);
+        mPimpl->mVariableIndex.erase(mPimpl->mVariables, variable);
+        markAsModified();
         return true;
     }
 
@@ -171,7 +253,9 @@ bool Component::removeVariable(const VariablePtr &variable)
     auto result = mPimpl->findVariable(variable);
     if (result != mPimpl->mVariables.end()) {
         mPimpl->mVariables.erase(result);
+        mPimpl->mVariableIndex.erase(mPimpl->mVariables, variable);
         variable->removeParent();
+        markAsModified();
         return true;
     }
 
@@ -184,6 +268,8 @@ void Component::removeAllVariables()
         variable->removeParent();
     }
     mPimpl->mVariables.clear();
+    mPimpl->mVariableIndex.invalidate();
+    markAsModified();
 }
 
 VariablePtr Component::variable(size_t index) const
@@ -197,12 +283,7 @@ VariablePtr Component::variable(size_t index) const
 
 VariablePtr Component::variable(const std::string &name) const
 {
-    auto result = mPimpl->findVariable(name);
-    if (result != mPimpl->mVariables.end()) {
-        return *result;
-    }
-
-    return nullptr;
+    return mPimpl->mVariableIndex.item(mPimpl->mVariables, name);
 }
 
 VariablePtr Component::takeVariable(size_t index)
@@ -233,18 +314,22 @@ bool Component::hasVariable(const VariablePtr &variable) const
 
 bool Component::hasVariable(const std::string &name) const
 {
-    return mPimpl->findVariable(name) != mPimpl->mVariables.end();
+    return mPimpl->mVariableIndex.item(mPimpl->mVariables, name) != nullptr;
 }
 
 void Component::addReset(const ResetPtr &reset)
 {
     mPimpl->mResets.push_back(reset);
+    reset->setParent(shared_from_this());
+    markAsModified();
 }
 
 bool Component::removeReset(size_t index)
 {
     if (index < mPimpl->mResets.size()) {
+        mPimpl->mResets.at(index)->removeParent();
         mPimpl->mResets.erase(mPimpl->mResets.begin() + int64_t(index));
+        markAsModified();
         return true;
     }
 
@@ -255,7 +340,9 @@ bool Component::removeReset(const ResetPtr &reset)
 {
     auto result = mPimpl->findReset(reset);
     if (result != mPimpl->mResets.end()) {
+        reset->removeParent();
         mPimpl->mResets.erase(result);
+        markAsModified();
         return true;
     }
 
@@ -264,7 +351,11 @@ bool Component::removeReset(const ResetPtr &reset)
 
 void Component::removeAllResets()
 {
+    for (const auto &reset : mPimpl->mResets) {
+        reset->removeParent();
+    }
     mPimpl->mResets.clear();
+    markAsModified();
 }
 
 ResetPtr Component::reset(size_t index) const
@@ -286,59 +377,11 @@ bool Component::hasReset(const ResetPtr &reset) const
     return mPimpl->findReset(reset) != mPimpl->mResets.end();
 }
 
-size_t getVariableIndexInComponent(const std::shared_ptr<const Component> &component, const VariablePtr &variable)
-{
-    size_t index = 0;
-    bool found = false;
-    while (index < component->variableCount() && !found) {
-        if (component->variable(index) == variable) {
-            found = true;
-        } else {
-            ++index;
-        }
-    }
-
-    return index;
-}
-
 ComponentPtr Component::clone() const
 {
-    auto c = create();
-
-    c->setId(id());
-    c->setName(name());
-    c->setMath(math());
-
-    c->setImportSource(importSource());
-    c->setImportReference(importReference());
-
-    for (size_t index = 0; index < variableCount(); ++index) {
-        auto v = variable(index);
-        c->addVariable(v->clone());
-    }
-
-    for (size_t index = 0; index < resetCount(); ++index) {
-        auto r = reset(index);
-        auto rClone = r->clone();
-        c->addReset(rClone);
-        size_t variableIndex = getVariableIndexInComponent(shared_from_this(), r->variable());
-        if (variableIndex < variableCount()) {
-            auto v = c->variable(variableIndex);
-            rClone->setVariable(v);
-        }
-        size_t testVariableIndex = getVariableIndexInComponent(shared_from_this(), r->testVariable());
-        if (testVariableIndex < variableCount()) {
-            auto v = c->variable(testVariableIndex);
-            rClone->setTestVariable(v);
-        }
-    }
-
-    for (size_t index = 0; index < componentCount(); ++index) {
-        auto cChild = component(index);
-        c->addComponent(cChild->clone());
-    }
+    VariableCopyMap variableCopies;
 
-    return c;
+    return cloneComponent(*this, UnitsCopyMap(), variableCopies);
 }
 
 } // namespace libcellml
@@ -18,11 +18,15 @@ limitations under the License.
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 #include "libcellml/component.h"
 #include "libcellml/units.h"
 
+#include "nameindex.h"
+
 namespace libcellml {
 
 /**
@@ -34,17 +38,27 @@ namespace libcellml {
  */
 struct ComponentEntity::ComponentEntityImpl
 {
+    ComponentEntity *mComponentEntity = nullptr;
     std::vector<ComponentPtr> mComponents;
+    NameIndex<Component> mComponentIndex;
     std::string mEncapsulationId;
 
+    std::mutex mEncapsulatedComponentIndexMutex;
+    std::unordered_map<std::string, ComponentPtr> mEncapsulatedComponentIndex;
+    bool mEncapsulatedComponentIndexValid = false;
+
     std::vector<ComponentPtr>::iterator findComponent(const std::string &name);
     std::vector<ComponentPtr>::iterator findComponent(const ComponentPtr &component);
+
+    void eraseComponent(std::vector<ComponentPtr>::iterator position);
+    void componentsModified();
+    void invalidateEncapsulatedComponentIndices();
+    ComponentPtr encapsulatedComponent(const std::string &name);
 };
 
 std::vector<ComponentPtr>::iterator ComponentEntity::ComponentEntityImpl::findComponent(const std::string &name)
 {
-    return std::find_if(mComponents.begin(), mComponents.end(),
-                        [=](const ComponentPtr &c) -> bool { return c->name() == name; });
+    return mComponentIndex.find(mComponents, name);
 }
 
 std::vector<ComponentPtr>::iterator ComponentEntity::ComponentEntityImpl::findComponent(const ComponentPtr &component)
@@ -53,10 +67,83 @@ std::vector<ComponentPtr>::iterator ComponentEntity::ComponentEntityImpl::findCo
                         [=](const ComponentPtr &c) -> bool { return c == component; });
 }
 
+void ComponentEntity::ComponentEntityImpl::eraseComponent(std::vector<ComponentPtr>::iterator position)
+{
+    ComponentPtr component = *position;
+    mComponents.erase(position);
+    mComponentIndex.erase(mComponents, component);
+    invalidateEncapsulatedComponentIndices();
+    mComponentEntity->markAsModified();
+}
+
+void ComponentEntity::ComponentEntityImpl::componentsModified()
+{
+    mComponentIndex.invalidate();
+    invalidateEncapsulatedComponentIndices();
+    mComponentEntity->markAsModified();
+}
+
+void ComponentEntity::ComponentEntityImpl::invalidateEncapsulatedComponentIndices()
+{
+    // The components encapsulated by this entity are also encapsulated by all
+    // of its ancestors.
+
+    ComponentEntity *componentEntity = mComponentEntity;
+    while (componentEntity != nullptr) {
+        {
+            std::lock_guard<std::mutex> lock(componentEntity->mPimpl->mEncapsulatedComponentIndexMutex);
+            componentEntity->mPimpl->mEncapsulatedComponentIndex.clear();
+            componentEntity->mPimpl->mEncapsulatedComponentIndexValid = false;
+        }
+        componentEntity = dynamic_cast<ComponentEntity *>(componentEntity->parent().get());
+    }
+}
+
+/**
+ * @brief Index the components encapsulated by the given @p componentEntity.
+ *
+ * Index the components encapsulated by the given @p componentEntity in the
+ * order in which ComponentEntity::component() looks for them, i.e. the direct
+ * children of an entity come before the components they encapsulate.
+ *
+ * @param componentEntity The @c ComponentEntity to index.
+ * @param index The index to which the components are to be added.
+ */
+static void indexEncapsulatedComponents(const ComponentEntity *componentEntity,
+                                        std::unordered_map<std::string, ComponentPtr> &index)
+{
+    for (size_t i = 0; i < componentEntity->componentCount(); ++i) {
+        ComponentPtr component = componentEntity->component(i);
+        index.emplace(component->name(), component);
+    }
+    for (size_t i = 0; i < componentEntity->componentCount(); ++i) {
+        indexEncapsulatedComponents(componentEntity->component(i).get(), index);
+    }
+}
+
+ComponentPtr ComponentEntity::ComponentEntityImpl::encapsulatedComponent(const std::string &name)
+{
+    std::lock_guard<std::mutex> lock(mEncapsulatedComponentIndexMutex);
+    if (!mEncapsulatedComponentIndexValid) {
+        indexEncapsulatedComponents(mComponentEntity, mEncapsulatedComponentIndex);
+        mEncapsulatedComponentIndexValid = true;
+    }
+    auto iter = mEncapsulatedComponentIndex.find(name);
+    if ((iter != mEncapsulatedComponentIndex.end()) && (iter->second->name() != name)) {
+        // A component has been renamed without us being told about it, so
+        // play it safe.
+        mEncapsulatedComponentIndex.clear();
+        indexEncapsulatedComponents(mComponentEntity, mEncapsulatedComponentIndex);
+        iter = mEncapsulatedComponentIndex.find(name);
+    }
+    return (iter != mEncapsulatedComponentIndex.end()) ? iter->second : nullptr;
+}
+
 // Interface class Model implementation
 ComponentEntity::ComponentEntity()
     : mPimpl(new ComponentEntityImpl())
 {
+    mPimpl->mComponentEntity = this;
 }
 
 ComponentEntity::~ComponentEntity()
@@ -72,6 +159,9 @@ bool ComponentEntity::addComponent(const ComponentPtr &component)
 bool ComponentEntity::doAddComponent(const ComponentPtr &component)
 {
     mPimpl->mComponents.push_back(component);
+    mPimpl->mComponentIndex.append(mPimpl->mComponents);
+    mPimpl->invalidateEncapsulatedComponentIndices();
+    markAsModified();
     return true;
 }
 
@@ -80,7 +170,7 @@ bool ComponentEntity::removeComponent(const std::string &name, bool searchEncaps
     bool status = false;
     auto result = mPimpl->findComponent(name);
     if (result != mPimpl->mComponents.end()) {
-        mPimpl->mComponents.erase(result);
+        mPimpl->eraseComponent(result);
         status = true;
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !status; ++i) {
@@ -95,7 +185,7 @@ bool ComponentEntity::removeComponent(size_t index)
 {
     bool status = false;
     if (index < mPimpl->mComponents.size()) {
-        mPimpl->mComponents.erase(mPimpl->mComponents.begin() + int64_t(index));
+        mPimpl->eraseComponent(mPimpl->mComponents.begin() + int64_t(index));
         status = true;
     }
 
@@ -107,7 +197,7 @@ bool ComponentEntity::removeComponent(const ComponentPtr &component, bool search
     bool status = false;
     auto result = mPimpl->findComponent(component);
     if (result != mPimpl->mComponents.end()) {
-        mPimpl->mComponents.erase(result);
+        mPimpl->eraseComponent(result);
         status = true;
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !status; ++i) {
@@ -121,6 +211,7 @@ bool ComponentEntity::removeComponent(const ComponentPtr &component, bool search
 void ComponentEntity::removeAllComponents()
 {
     mPimpl->mComponents.clear();
+    mPimpl->componentsModified();
 }
 
 size_t ComponentEntity::componentCount() const
@@ -131,13 +222,10 @@ size_t ComponentEntity::componentCount() const
 bool ComponentEntity::containsComponent(const std::string &name, bool searchEncapsulated) const
 {
     bool status = false;
-    auto result = mPimpl->findComponent(name);
-    if (result != mPimpl->mComponents.end()) {
+    if (mPimpl->mComponentIndex.item(mPimpl->mComponents, name) != nullptr) {
         status = true;
     } else if (searchEncapsulated) {
-        for (size_t i = 0; i < componentCount() && !status; ++i) {
-            status = component(i)->containsComponent(name, searchEncapsulated);
-        }
+        status = mPimpl->encapsulatedComponent(name) != nullptr;
     }
 
     return status;
@@ -170,14 +258,9 @@ ComponentPtr ComponentEntity::component(size_t index) const
 
 ComponentPtr ComponentEntity::component(const std::string &name, bool searchEncapsulated) const
 {
-    ComponentPtr foundComponent = nullptr;
-    auto result = mPimpl->findComponent(name);
-    if (result != mPimpl->mComponents.end()) {
-        foundComponent = *result;
-    } else if (searchEncapsulated) {
-        for (size_t i = 0; i < componentCount() && !foundComponent; ++i) {
-            foundComponent = component(i)->component(name, searchEncapsulated);
-        }
+    ComponentPtr foundComponent = mPimpl->mComponentIndex.item(mPimpl->mComponents, name);
+    if ((foundComponent == nullptr) && searchEncapsulated) {
+        foundComponent = mPimpl->encapsulatedComponent(name);
     }
 
     return foundComponent;
@@ -188,7 +271,7 @@ ComponentPtr ComponentEntity::takeComponent(size_t index)
     ComponentPtr component = nullptr;
     if (index < mPimpl->mComponents.size()) {
         component = mPimpl->mComponents.at(index);
-        mPimpl->mComponents.erase(mPimpl->mComponents.begin() + int64_t(index));
+        mPimpl->eraseComponent(mPimpl->mComponents.begin() + int64_t(index));
         component->removeParent();
     }
 
@@ -201,7 +284,7 @@ ComponentPtr ComponentEntity::takeComponent(const std::string &name, bool search
     auto result = mPimpl->findComponent(name);
     if (result != mPimpl->mComponents.end()) {
         foundComponent = *result;
-        mPimpl->mComponents.erase(result);
+        mPimpl->eraseComponent(result);
         foundComponent->removeParent();
     } else if (searchEncapsulated) {
         for (size_t i = 0; i < componentCount() && !foundComponent; ++i) {
@@ -215,10 +298,13 @@ ComponentPtr ComponentEntity::takeComponent(const std::string &name, bool search
 bool ComponentEntity::replaceComponent(size_t index, const ComponentPtr &component)
 {
     bool status = false;
-    ComponentEntityPtr oldComponent = ComponentEntity::component(index);
-    if (removeComponent(index)) {
-        mPimpl->mComponents.insert(mPimpl->mComponents.begin() + int64_t(index), component);
+    if (index < mPimpl->mComponents.size()) {
+        ComponentPtr oldComponent = mPimpl->mComponents.at(index);
+        mPimpl->mComponents.at(index) = component;
+        mPimpl->mComponentIndex.replace(oldComponent, component);
+        mPimpl->invalidateEncapsulatedComponentIndices();
         component->setParent(oldComponent->parent());
+        markAsModified();
         status = true;
     }
 
@@ -252,6 +338,7 @@ bool ComponentEntity::replaceComponent(const ComponentPtr &oldComponent, const C
 void ComponentEntity::setEncapsulationId(const std::string &id)
 {
     mPimpl->mEncapsulationId = id;
+    markAsModified();
 }
 
 std::string ComponentEntity::encapsulationId() const
@@ -259,4 +346,10 @@ std::string ComponentEntity::encapsulationId() const
     return mPimpl->mEncapsulationId;
 }
 
+void ComponentEntity::invalidateNameIndices()
+{
+    mPimpl->mComponentIndex.invalidate();
+    mPimpl->invalidateEncapsulatedComponentIndices();
+}
+
 } // namespace libcellml
@@ -0,0 +1,64 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include "libcellml/types.h"
+
+#include "xmldoc.h"
+
+namespace libcellml {
+
+/**
+ * @brief The ComponentMath class.
+ *
+ * The ComponentMath class gives internal access to the parsed form of the
+ * math of a @c Component. The math is parsed the first time that it is
+ * needed and the resulting document is cached on the component until its
+ * math gets modified, so that the validator and the generator do not need to
+ * parse it over and over again. The math and its parsed form are shared with
+ * the clones of the component, until either modifies its math.
+ */
+class ComponentMath
+{
+public:
+    /**
+     * @brief Get the parsed math of the given @p component.
+     *
+     * Get the XML document resulting from parsing the math of the given
+     * @p component, including any error raised while parsing it. The
+     * document is shared and must not be modified.
+     *
+     * @param component The @c ComponentPtr for which we want the parsed math.
+     *
+     * @return The @c XmlDocPtr for the math of @p component, or @c nullptr if
+     * @p component has no math.
+     */
+    static XmlDocPtr parsedMath(const ComponentPtr &component);
+
+    /**
+     * @brief Share the math of the given @p source with @p component.
+     *
+     * Make @p component use the same math as @p source, and the same parsed
+     * form of it, without copying either.
+     *
+     * @param source The @c Component whose math is to be shared.
+     * @param component The @c ComponentPtr which is to share that math.
+     */
+    static void shareMath(const Component &source, const ComponentPtr &component);
+};
+
+} // namespace libcellml
@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "libcellml/entity.h"
 
+#include <atomic>
+
 #include "libcellml/component.h"
 #include "libcellml/componententity.h"
 
@@ -23,6 +25,21 @@ namespace libcellml {
 
 using EntityWeakPtr = std::weak_ptr<Entity>; /**< Type definition for weak entity pointer. */
 
+/**
+ * @brief Get a new revision.
+ *
+ * Get a new revision, i.e. one that is greater than any revision that has been
+ * handed out so far.
+ *
+ * @return A new revision.
+ */
+static size_t newRevision()
+{
+    static std::atomic<size_t> revision(0);
+
+    return ++revision;
+}
+
 /**
  * @brief The Entity::EntityImpl struct.
  *
@@ -32,6 +49,7 @@ struct Entity::EntityImpl
 {
     EntityWeakPtr mParent; /**< Pointer to parent. */
     std::string mId; /**< String document identifier for this entity. */
+    size_t mRevision = newRevision(); /**< Revision at which this entity, or any of its descendants, was last modified. */
 };
 
 Entity::Entity()
@@ -48,6 +66,7 @@ Entity::~Entity()
 void Entity::setId(const std::string &id)
 {
     mPimpl->mId = id;
+    markAsModified();
 }
 
 std::string Entity::id() const
@@ -94,4 +113,20 @@ bool Entity::hasAncestor(const EntityPtr &entity) const
     return hasAncestor;
 }
 
+size_t Entity::revision() const
+{
+    return mPimpl->mRevision;
+}
+
+void Entity::markAsModified()
+{
+    auto revision = newRevision();
+    mPimpl->mRevision = revision;
+    EntityPtr parent = mPimpl->mParent.lock();
+    while (parent != nullptr) {
+        parent->mPimpl->mRevision = revision;
+        parent = parent->mPimpl->mParent.lock();
+    }
+}
+
 } // namespace libcellml
@@ -19,17 +19,21 @@ limitations under the License.
 #include <algorithm>
 #include <limits>
 #include <list>
+#include <map>
 #include <regex>
+#include <set>
 #include <sstream>
 #include <vector>
 
 #include "libcellml/component.h"
 #include "libcellml/generatorprofile.h"
 #include "libcellml/model.h"
+#include "libcellml/reset.h"
 #include "libcellml/units.h"
 #include "libcellml/validator.h"
 #include "libcellml/variable.h"
 #include "libcellml/version.h"
+#include "componentmath.h"
 #include "utilities.h"
 #include "xmldoc.h"
 
@@ -523,6 +527,20 @@ bool GeneratorEquation::check(size_t &equationOrder, size_t &stateIndex,
     return relevantCheck;
 }
 
+struct GeneratorReset;
+using GeneratorResetPtr = std::shared_ptr<GeneratorReset>;
+
+struct GeneratorReset
+{
+    int mOrder = 0;
+
+    VariablePtr mVariable;
+    GeneratorInternalVariablePtr mInternalVariable;
+
+    GeneratorEquationAstPtr mRootAst;
+    GeneratorEquationAstPtr mResetValueAst;
+};
+
 /**
  * @brief The Generator::GeneratorImpl struct.
  *
@@ -536,6 +554,7 @@ struct Generator::GeneratorImpl
 
     std::list<GeneratorInternalVariablePtr> mInternalVariables;
     std::list<GeneratorEquationPtr> mEquations;
+    std::vector<GeneratorResetPtr> mResets;
 
     VariablePtr mVoi;
     std::vector<VariablePtr> mStates;
@@ -570,6 +589,18 @@ struct Generator::GeneratorImpl
     bool mNeedAcsch = false;
     bool mNeedAcoth = false;
 
+    std::weak_ptr<Model> mModel;
+    size_t mModelRevision = 0;
+    std::vector<EntityPtr> mModelEntities;
+    std::vector<std::string> mModelStructure;
+    std::vector<std::string> mInitialValues;
+
+    std::set<Generator::Method> mModifiedMethods;
+
+    std::string mMethodsCodeProfileContents;
+    std::vector<std::string> mMethodsCodeInitialValues;
+    std::map<Generator::Method, std::string> mMethodsCode;
+
     bool hasValidModel() const;
 
     size_t mathmlChildCount(const XmlNodePtr &node) const;
@@ -585,14 +616,29 @@ struct Generator::GeneratorImpl
     static bool compareEquationsByVariable(const GeneratorEquationPtr &equation1,
                                            const GeneratorEquationPtr &equation2);
 
+    static bool compareResetsByOrder(const GeneratorResetPtr &reset1,
+                                     const GeneratorResetPtr &reset2);
+
     void processNode(const XmlNodePtr &node, GeneratorEquationAstPtr &ast,
                      const GeneratorEquationAstPtr &astParent,
                      const ComponentPtr &component,
                      const GeneratorEquationPtr &equation);
     GeneratorEquationPtr processNode(const XmlNodePtr &node,
                                      const ComponentPtr &component);
+    bool processResetMath(const std::string &math, GeneratorEquationAstPtr &ast,
+                          const GeneratorEquationAstPtr &astParent,
+                          const ComponentPtr &component);
+    void processReset(const ResetPtr &reset, const ComponentPtr &component);
     void processComponent(const ComponentPtr &component);
     void processEquationAst(const GeneratorEquationAstPtr &ast);
+    void addComponentStructure(const ComponentPtr &component,
+                               std::vector<EntityPtr> &entities,
+                               std::vector<std::string> &structure) const;
+    void modelStructure(const ModelPtr &model,
+                        std::vector<EntityPtr> &entities,
+                        std::vector<std::string> &structure) const;
+    std::vector<std::string> initialValues() const;
+    bool reuseAnalysis(const ModelPtr &model);
     void processModel(const ModelPtr &model);
 
     bool isRelationalOperator(const GeneratorEquationAstPtr &ast) const;
@@ -610,13 +656,21 @@ struct Generator::GeneratorImpl
 
     std::string replace(std::string string, const std::string &from,
                         const std::string &to);
+    std::string replaceAll(std::string string, const std::string &from,
+                           const std::string &to);
+    std::string replaceTypes(const std::string &code);
 
     void updateVariableInfoSizes(size_t &componentSize, size_t &nameSize,
                                  size_t &unitsSize,
                                  const VariablePtr &variable);
 
+    std::string profileContents() const;
     bool modifiedProfile() const;
 
+    void addAstFingerprint(std::vector<std::string> &contents,
+                           const GeneratorEquationAstPtr &ast) const;
+    std::string fingerprint() const;
+
     void addOriginCommentCode(std::string &code);
 
     void addInterfaceHeaderCode(std::string &code);
@@ -627,6 +681,9 @@ struct Generator::GeneratorImpl
 
     void addStateAndVariableCountCode(std::string &code,
                                       bool interface = false);
+    void addRootCountCode(std::string &code, bool interface = false);
+
+    void addModelInstanceTypeCode(std::string &code, bool interface = false);
 
     void addVariableTypeObjectCode(std::string &code);
 
@@ -647,7 +704,8 @@ struct Generator::GeneratorImpl
     void addArithmeticFunctionsCode(std::string &code);
     void addTrigonometricFunctionsCode(std::string &code);
 
-    std::string generateCreateArrayCode(size_t arraySize);
+    std::string generateCreateArrayCode(size_t arraySize,
+                                        const std::string &arrayType);
 
     void addInterfaceCreateDeleteArrayMethodsCode(std::string &code);
     void addImplementationCreateStatesArrayMethodCode(std::string &code);
@@ -686,6 +744,11 @@ struct Generator::GeneratorImpl
                                                  std::vector<GeneratorEquationPtr> &remainingEquations);
     void addImplementationComputeVariablesMethodCode(std::string &code,
                                                      std::vector<GeneratorEquationPtr> &remainingEquations);
+    void addImplementationComputeRootsMethodCode(std::string &code);
+    void addImplementationApplyResetsMethodCode(std::string &code);
+
+    void updateMethodsCode();
+    void addMethodCode(std::string &code, Generator::Method method);
 };
 
 bool Generator::GeneratorImpl::hasValidModel() const
@@ -1121,19 +1184,106 @@ GeneratorEquationPtr Generator::GeneratorImpl::processNode(const XmlNodePtr &nod
     return equation;
 }
 
-void Generator::GeneratorImpl::processComponent(const ComponentPtr &component)
+bool Generator::GeneratorImpl::processResetMath(const std::string &math,
+                                                GeneratorEquationAstPtr &ast,
+                                                const GeneratorEquationAstPtr &astParent,
+                                                const ComponentPtr &component)
 {
-    // Retrieve the math string associated with the given component and process
-    // it, one equation at a time.
+    // Process the given math string, which must consist of exactly one MathML
+    // expression. The variables used by the expression are tracked by a
+    // throwaway equation since a reset is not an equation.
 
     XmlDocPtr xmlDoc = std::make_shared<XmlDoc>();
-    std::string math = component->math();
 
-    if (!math.empty()) {
-        xmlDoc->parseMathML(math);
+    xmlDoc->parseMathML(math);
+
+    XmlNodePtr mathNode = xmlDoc->rootNode();
+    XmlNodePtr expressionNode;
+
+    if (mathNode == nullptr) {
+        return false;
+    }
+
+    for (XmlNodePtr node = mathNode->firstChild(); node != nullptr; node = node->next()) {
+        if (node->isMathmlElement()) {
+            if (expressionNode != nullptr) {
+                return false;
+            }
+
+            expressionNode = node;
+        }
+    }
+
+    if (expressionNode == nullptr) {
+        return false;
+    }
+
+    processNode(expressionNode, ast, astParent, component, std::make_shared<GeneratorEquation>());
+
+    return ast != nullptr;
+}
+
+void Generator::GeneratorImpl::processReset(const ResetPtr &reset,
+                                            const ComponentPtr &component)
+{
+    // Make sure that the given reset is complete and, if so, keep track of
+    // it. Its root function (i.e. the difference between its test variable and
+    // its test value) is zero when the reset must be applied.
+
+    std::string modelName = entityName(owningModel(component));
+    VariablePtr variable = reset->variable();
+    VariablePtr testVariable = reset->testVariable();
+
+    if ((variable == nullptr) || (testVariable == nullptr)
+        || reset->testValue().empty() || reset->resetValue().empty()) {
+        ErrorPtr err = Error::create();
+
+        err->setDescription("Reset in component '" + component->name()
+                            + "' of model '" + modelName
+                            + "' must have a variable, a test variable, a test value and a reset value.");
+        err->setKind(Error::Kind::GENERATOR);
+
+        mGenerator->addError(err);
+
+        return;
+    }
+
+    GeneratorResetPtr generatorReset = std::make_shared<GeneratorReset>();
+
+    generatorReset->mOrder = reset->order();
+    generatorReset->mVariable = variable;
+    generatorReset->mInternalVariable = generatorVariable(variable);
+    generatorReset->mRootAst = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::MINUS, nullptr);
+    generatorReset->mRootAst->mLeft = std::make_shared<GeneratorEquationAst>(GeneratorEquationAst::Type::CI, testVariable, generatorReset->mRootAst);
+
+    if (!processResetMath(reset->testValue(), generatorReset->mRootAst->mRight, generatorReset->mRootAst, component)
+        || !processResetMath(reset->resetValue(), generatorReset->mResetValueAst, nullptr, component)) {
+        ErrorPtr err = Error::create();
+
+        err->setDescription("The test value and the reset value of reset in component '" + component->name()
+                            + "' of model '" + modelName
+                            + "' must each consist of a single MathML expression.");
+        err->setKind(Error::Kind::GENERATOR);
+
+        mGenerator->addError(err);
+
+        return;
+    }
+
+    mResets.push_back(generatorReset);
+}
+
+void Generator::GeneratorImpl::processComponent(const ComponentPtr &component)
+{
+    // Retrieve the parsed math associated with the given component and process
+    // it, one equation at a time. (The math is not validated against the
+    // MathML DTD, so the model should have been validated beforehand. Any
+    // MathML element that we do not support is simply ignored.)
 
-        XmlNodePtr mathNode = xmlDoc->rootNode();
+    XmlDocPtr xmlDoc = ComponentMath::parsedMath(component);
+    XmlNodePtr mathNode = (xmlDoc != nullptr) ? xmlDoc->rootNode() : nullptr;
 
+    if (mathNode != nullptr) {
         for (XmlNodePtr node = mathNode->firstChild(); node != nullptr; node = node->next()) {
             if (node->isMathmlElement()) {
                 processNode(node, component);
@@ -1141,6 +1291,12 @@ void Generator::GeneratorImpl::processComponent(const ComponentPtr &component)
         }
     }
 
+    // Process the given component's resets.
+
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        processReset(component->reset(i), component);
+    }
+
     // Go through the given component's variables and make sure that everything
     // makes sense.
 
@@ -1323,8 +1479,145 @@ bool Generator::GeneratorImpl::compareEquationsByVariable(const GeneratorEquatio
     return compareVariablesByTypeAndIndex(equation1->mVariable, equation2->mVariable);
 }
 
+bool Generator::GeneratorImpl::compareResetsByOrder(const GeneratorResetPtr &reset1,
+                                                    const GeneratorResetPtr &reset2)
+{
+    return reset1->mOrder < reset2->mOrder;
+}
+
+void Generator::GeneratorImpl::addComponentStructure(const ComponentPtr &component,
+                                                     std::vector<EntityPtr> &entities,
+                                                     std::vector<std::string> &structure) const
+{
+    // Add everything about the given component that can affect our analysis
+    // or the code we generate, except for the initial value of its variables,
+    // which only matters to the extent that it is set or not. Entities (i.e.
+    // components and variables) are tracked by identity, so that replacing one
+    // of them with an identical copy is also detected.
+
+    entities.push_back(component);
+
+    structure.push_back(component->name());
+    structure.push_back(component->math());
+    structure.push_back(std::to_string(component->variableCount()));
+
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        VariablePtr variable = component->variable(i);
+
+        entities.push_back(variable);
+
+        structure.push_back(variable->name());
+        structure.push_back((variable->units() != nullptr) ? variable->units()->name() : "");
+        structure.push_back(variable->initialValue().empty() ? "false" : "true");
+        structure.push_back(std::to_string(variable->equivalentVariableCount()));
+
+        for (size_t j = 0; j < variable->equivalentVariableCount(); ++j) {
+            entities.push_back(variable->equivalentVariable(j));
+        }
+    }
+
+    structure.push_back(std::to_string(component->resetCount()));
+
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        ResetPtr reset = component->reset(i);
+
+        entities.push_back(reset->variable());
+        entities.push_back(reset->testVariable());
+
+        structure.push_back(std::to_string(reset->order()));
+        structure.push_back(reset->testValue());
+        structure.push_back(reset->resetValue());
+    }
+
+    structure.push_back(std::to_string(component->componentCount()));
+
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        addComponentStructure(component->component(i), entities, structure);
+    }
+}
+
+void Generator::GeneratorImpl::modelStructure(const ModelPtr &model,
+                                              std::vector<EntityPtr> &entities,
+                                              std::vector<std::string> &structure) const
+{
+    entities.clear();
+    structure = {model->name(), std::to_string(model->componentCount())};
+
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        addComponentStructure(model->component(i), entities, structure);
+    }
+}
+
+std::vector<std::string> Generator::GeneratorImpl::initialValues() const
+{
+    // Return the initial values of our states and constants, i.e. the only
+    // values that we read from the model when generating code.
+
+    std::vector<std::string> res;
+
+    for (const auto &internalVariable : mInternalVariables) {
+        if ((internalVariable->mType == GeneratorInternalVariable::Type::STATE)
+            || (internalVariable->mType == GeneratorInternalVariable::Type::CONSTANT)) {
+            res.push_back(internalVariable->mVariable->initialValue());
+        }
+    }
+
+    return res;
+}
+
+bool Generator::GeneratorImpl::reuseAnalysis(const ModelPtr &model)
+{
+    // We can only reuse our analysis if it is that of the given model and if
+    // it is valid.
+
+    if (!hasValidModel() || (mModel.lock() != model)) {
+        return false;
+    }
+
+    // Nothing needs to be done if the model hasn't been modified since we last
+    // processed it.
+
+    mModifiedMethods.clear();
+
+    if (model->revision() == mModelRevision) {
+        return true;
+    }
+
+    // The model has been modified, so check whether its structure is still
+    // the same. If so, then only the initial value of some of its variables
+    // may have been modified, which only affects the code of our
+    // initializeStatesAndConstants() method.
+
+    std::vector<EntityPtr> entities;
+    std::vector<std::string> structure;
+
+    modelStructure(model, entities, structure);
+
+    if ((entities != mModelEntities) || (structure != mModelStructure)) {
+        return false;
+    }
+
+    std::vector<std::string> initialValues = GeneratorImpl::initialValues();
+
+    if (initialValues != mInitialValues) {
+        mInitialValues = initialValues;
+
+        mModifiedMethods.insert(Generator::Method::INITIALIZE_STATES_AND_CONSTANTS);
+    }
+
+    mModelRevision = model->revision();
+
+    return true;
+}
+
 void Generator::GeneratorImpl::processModel(const ModelPtr &model)
 {
+    // Reuse our analysis of the model, if possible.
+
+    if (reuseAnalysis(model)) {
+        return;
+    }
+
     // Reset a few things in case we were to process the model more than once.
     // Note: one would normally process the model only once, so we shouldn't
     //       need to do this, but better be safe than sorry.
@@ -1333,6 +1626,7 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
 
     mInternalVariables.clear();
     mEquations.clear();
+    mResets.clear();
 
     mVoi = nullptr;
     mStates.clear();
@@ -1450,6 +1744,29 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
         }
     }
 
+    // Make sure that our resets only reset states. Any other variable is
+    // computed by our model, so its reset value would get overwritten as soon
+    // as our model gets computed again.
+
+    if (mGenerator->errorCount() == 0) {
+        for (const auto &reset : mResets) {
+            if (reset->mInternalVariable->mType != GeneratorInternalVariable::Type::STATE) {
+                ErrorPtr err = Error::create();
+                ComponentPtr component = std::dynamic_pointer_cast<Component>(reset->mVariable->parent());
+
+                err->setDescription("Variable '" + reset->mVariable->name()
+                                    + "' in component '" + component->name()
+                                    + "' of model '" + owningModel(component)->name()
+                                    + "' is reset, but it is not a state variable.");
+                err->setKind(Error::Kind::GENERATOR);
+
+                mGenerator->addError(err);
+
+                mModelType = Generator::ModelType::INVALID;
+            }
+        }
+    }
+
     // Determine the type of our model, if it hasn't already been categorised as
     // being invalid.
 
@@ -1487,6 +1804,8 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
         mInternalVariables.sort(compareVariablesByTypeAndIndex);
         mEquations.sort(compareEquationsByVariable);
 
+        std::stable_sort(mResets.begin(), mResets.end(), compareResetsByOrder);
+
         for (const auto &internalVariable : mInternalVariables) {
             if (internalVariable->mType == GeneratorInternalVariable::Type::STATE) {
                 mStates.push_back(internalVariable->mVariable);
@@ -1509,6 +1828,34 @@ void Generator::GeneratorImpl::processModel(const ModelPtr &model)
             }
         }
     }
+
+    // Keep track of the model and of its structure, so that we can reuse our
+    // analysis should we be asked to process the model again. Either way, the
+    // code of all our methods is to be (re)generated.
+
+    mModel = model;
+    mModelRevision = model->revision();
+
+    if (hasValidModel()) {
+        modelStructure(model, mModelEntities, mModelStructure);
+
+        mInitialValues = initialValues();
+    } else {
+        mModelEntities.clear();
+        mModelStructure.clear();
+        mInitialValues.clear();
+    }
+
+    mModifiedMethods = {
+        Generator::Method::INITIALIZE_STATES_AND_CONSTANTS,
+        Generator::Method::COMPUTE_COMPUTED_CONSTANTS,
+        Generator::Method::COMPUTE_RATES,
+        Generator::Method::COMPUTE_VARIABLES,
+        Generator::Method::COMPUTE_ROOTS,
+        Generator::Method::APPLY_RESETS,
+    };
+
+    mMethodsCode.clear();
 }
 
 bool Generator::GeneratorImpl::isRelationalOperator(const GeneratorEquationAstPtr &ast) const
@@ -1603,6 +1950,32 @@ std::string Generator::GeneratorImpl::replace(std::string string,
                string.replace(index, from.length(), to);
 }
 
+std::string Generator::GeneratorImpl::replaceAll(std::string string,
+                                                 const std::string &from,
+                                                 const std::string &to)
+{
+    auto index = string.find(from);
+
+    while (index != std::string::npos) {
+        string.replace(index, from.length(), to);
+
+        index = string.find(from, index + to.length());
+    }
+
+    return string;
+}
+
+std::string Generator::GeneratorImpl::replaceTypes(const std::string &code)
+{
+    // Types can be used anywhere in a profile, so we replace them once all the
+    // code has been generated.
+
+    return replaceAll(replaceAll(replaceAll(code,
+                                            "<STATES_TYPE>", mProfile->statesTypeString()),
+                                 "<VARIABLES_TYPE>", mProfile->variablesTypeString()),
+                      "<COMPUTE_TYPE>", mProfile->computeTypeString());
+}
+
 void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
                                                        size_t &nameSize,
                                                        size_t &unitsSize,
@@ -1618,7 +1991,7 @@ void Generator::GeneratorImpl::updateVariableInfoSizes(size_t &componentSize,
     unitsSize = (unitsSize > variableUnitsSize) ? unitsSize : variableUnitsSize;
 }
 
-bool Generator::GeneratorImpl::modifiedProfile() const
+std::string Generator::GeneratorImpl::profileContents() const
 {
     // Whether the profile requires an interface to be generated.
 
@@ -1797,6 +2170,12 @@ bool Generator::GeneratorImpl::modifiedProfile() const
     profileContents += mProfile->interfaceVariableCountString()
                        + mProfile->implementationVariableCountString();
 
+    profileContents += mProfile->interfaceRootCountString()
+                       + mProfile->implementationRootCountString();
+
+    profileContents += mProfile->interfaceModelInstanceTypeString()
+                       + mProfile->implementationModelInstanceTypeString();
+
     profileContents += mProfile->variableTypeObjectString();
 
     profileContents += mProfile->constantVariableTypeString()
@@ -1824,6 +2203,18 @@ bool Generator::GeneratorImpl::modifiedProfile() const
                        + mProfile->ratesArrayString()
                        + mProfile->variablesArrayString();
 
+    profileContents += mProfile->rootsArrayString()
+                       + mProfile->rootsFoundArrayString();
+
+    profileContents += mProfile->resetValueDeclarationString()
+                       + mProfile->resetValueString();
+
+    profileContents += mProfile->statesTypeString()
+                       + mProfile->variablesTypeString()
+                       + mProfile->computeTypeString();
+
+    profileContents += mProfile->numberSuffixString();
+
     profileContents += mProfile->returnCreatedArrayString();
 
     profileContents += mProfile->interfaceCreateStatesArrayMethodString()
@@ -1847,6 +2238,12 @@ bool Generator::GeneratorImpl::modifiedProfile() const
     profileContents += mProfile->interfaceComputeVariablesMethodString()
                        + mProfile->implementationComputeVariablesMethodString();
 
+    profileContents += mProfile->interfaceComputeRootsMethodString()
+                       + mProfile->implementationComputeRootsMethodString();
+
+    profileContents += mProfile->interfaceApplyResetsMethodString()
+                       + mProfile->implementationApplyResetsMethodString();
+
     profileContents += mProfile->emptyMethodString();
 
     profileContents += mProfile->indentString();
@@ -1863,18 +2260,31 @@ bool Generator::GeneratorImpl::modifiedProfile() const
 
     profileContents += mProfile->commandSeparatorString();
 
+    return profileContents;
+}
+
+bool Generator::GeneratorImpl::modifiedProfile() const
+{
     // Compute and check the hash of our profile contents.
 
     bool res = false;
-    std::string profileContentsSha1 = sha1(profileContents);
+    std::string profileContentsSha1 = sha1(profileContents());
 
     switch (mProfile->profile()) {
     case GeneratorProfile::Profile::C:
-        res = profileContentsSha1 != "88b463c76b0bd6bc2c88292b7d5f2a22ec16ab74";
+        res = profileContentsSha1 != "fa9751bef684b014ef8d8e90992a581a537fb39d";
 
         break;
     case GeneratorProfile::Profile::PYTHON:
-        res = profileContentsSha1 != "42d407f85ab07649516b55f7c626553034f892a9";
+        res = profileContentsSha1 != "3ee89c9170ea5bedde2a58d13a05fc4d876b62af";
+
+        break;
+    case GeneratorProfile::Profile::C_STATIC:
+        res = profileContentsSha1 != "fcf1235510d3bef545d8af0e28e34b4fc69a7042";
+
+        break;
+    case GeneratorProfile::Profile::PYTHON_NUMPY:
+        res = profileContentsSha1 != "85418d1b2e2019efb6d52bd94ffa70c7f5198128";
 
         break;
     }
@@ -1882,6 +2292,69 @@ bool Generator::GeneratorImpl::modifiedProfile() const
     return res;
 }
 
+void Generator::GeneratorImpl::addAstFingerprint(std::vector<std::string> &contents,
+                                                 const GeneratorEquationAstPtr &ast) const
+{
+    // Serialise the given AST in pre-order, using an empty entry for a missing
+    // child so that the shape of the AST is unambiguous.
+
+    if (ast == nullptr) {
+        contents.emplace_back();
+
+        return;
+    }
+
+    contents.push_back(std::to_string(int(ast->mType)));
+    contents.push_back(ast->mValue);
+
+    if (ast->mVariable != nullptr) {
+        contents.push_back(entityName(ast->mVariable->parent()));
+        contents.push_back(ast->mVariable->name());
+    }
+
+    addAstFingerprint(contents, ast->mLeft);
+    addAstFingerprint(contents, ast->mRight);
+}
+
+std::string Generator::GeneratorImpl::fingerprint() const
+{
+    // Our fingerprint covers everything that can affect the generated code,
+    // i.e. the version of libCellML, our profile, our variables, our equations
+    // and our resets.
+
+    std::vector<std::string> contents = {versionString(), profileContents()};
+
+    for (const auto &internalVariable : mInternalVariables) {
+        auto variable = internalVariable->mVariable;
+
+        contents.push_back(std::to_string(int(internalVariable->mType)));
+        contents.push_back(std::to_string(internalVariable->mIndex));
+        contents.push_back(entityName(variable->parent()));
+        contents.push_back(variable->name());
+        contents.push_back((variable->units() != nullptr) ? variable->units()->name() : "");
+        contents.push_back(variable->initialValue());
+    }
+
+    for (const auto &equation : mEquations) {
+        contents.push_back(std::to_string(int(equation->mType)));
+        contents.push_back(std::to_string(equation->mOrder));
+        contents.push_back(equation->mIsStateRateBased ? "true" : "false");
+
+        addAstFingerprint(contents, equation->mAst);
+    }
+
+    for (const auto &reset : mResets) {
+        contents.push_back(std::to_string(reset->mOrder));
+        contents.push_back(entityName(reset->mVariable->parent()));
+        contents.push_back(reset->mVariable->name());
+
+        addAstFingerprint(contents, reset->mRootAst);
+        addAstFingerprint(contents, reset->mResetValueAst);
+    }
+
+    return sha1(contents);
+}
+
 void Generator::GeneratorImpl::addOriginCommentCode(std::string &code)
 {
     if (!mProfile->commentString().empty()
@@ -1898,6 +2371,14 @@ void Generator::GeneratorImpl::addOriginCommentCode(std::string &code)
         case GeneratorProfile::Profile::PYTHON:
             profileInformation += "Python";
 
+            break;
+        case GeneratorProfile::Profile::C_STATIC:
+            profileInformation += "static C";
+
+            break;
+        case GeneratorProfile::Profile::PYTHON_NUMPY:
+            profileInformation += "NumPy";
+
             break;
         }
 
@@ -1976,18 +2457,18 @@ void Generator::GeneratorImpl::addStateAndVariableCountCode(std::string &code,
 
     if ((interface && !mProfile->interfaceStateCountString().empty())
         || (!interface && !mProfile->implementationStateCountString().empty())) {
-        stateAndVariableCountCode += interface ?
-                                         mProfile->interfaceStateCountString() :
-                                         replace(mProfile->implementationStateCountString(),
-                                                 "<STATE_COUNT>", std::to_string(mStates.size()));
+        stateAndVariableCountCode += replace(interface ?
+                                                 mProfile->interfaceStateCountString() :
+                                                 mProfile->implementationStateCountString(),
+                                             "<STATE_COUNT>", std::to_string(mStates.size()));
     }
 
     if ((interface && !mProfile->interfaceVariableCountString().empty())
         || (!interface && !mProfile->implementationVariableCountString().empty())) {
-        stateAndVariableCountCode += interface ?
-                                         mProfile->interfaceVariableCountString() :
-                                         replace(mProfile->implementationVariableCountString(),
-                                                 "<VARIABLE_COUNT>", std::to_string(mVariables.size()));
+        stateAndVariableCountCode += replace(interface ?
+                                                 mProfile->interfaceVariableCountString() :
+                                                 mProfile->implementationVariableCountString(),
+                                             "<VARIABLE_COUNT>", std::to_string(mVariables.size()));
     }
 
     if (!stateAndVariableCountCode.empty()) {
@@ -1997,6 +2478,38 @@ void Generator::GeneratorImpl::addStateAndVariableCountCode(std::string &code,
     code += stateAndVariableCountCode;
 }
 
+void Generator::GeneratorImpl::addRootCountCode(std::string &code,
+                                                bool interface)
+{
+    // Only models with resets have roots.
+
+    std::string rootCount = interface ?
+                                mProfile->interfaceRootCountString() :
+                                mProfile->implementationRootCountString();
+
+    if (!mResets.empty() && !rootCount.empty()) {
+        code += replace(rootCount, "<ROOT_COUNT>", std::to_string(mResets.size()));
+    }
+}
+
+void Generator::GeneratorImpl::addModelInstanceTypeCode(std::string &code,
+                                                        bool interface)
+{
+    std::string modelInstanceType = interface ?
+                                        mProfile->interfaceModelInstanceTypeString() :
+                                        mProfile->implementationModelInstanceTypeString();
+
+    if (!modelInstanceType.empty()) {
+        // Note: arrays cannot be empty in C, hence we always make room for at
+        //       least one state and one variable.
+
+        code += "\n"
+                + replace(replace(modelInstanceType,
+                                  "<STATE_COUNT>", std::to_string(std::max(mStates.size(), size_t(1)))),
+                          "<VARIABLE_COUNT>", std::to_string(std::max(mVariables.size(), size_t(1))));
+    }
+}
+
 void Generator::GeneratorImpl::addVariableTypeObjectCode(std::string &code)
 {
     if (!mProfile->variableTypeObjectString().empty()) {
@@ -2412,10 +2925,12 @@ void Generator::GeneratorImpl::addTrigonometricFunctionsCode(std::string &code)
     }
 }
 
-std::string Generator::GeneratorImpl::generateCreateArrayCode(size_t arraySize)
+std::string Generator::GeneratorImpl::generateCreateArrayCode(size_t arraySize,
+                                                              const std::string &arrayType)
 {
-    return replace(mProfile->returnCreatedArrayString(),
-                   "<ARRAY_SIZE>", std::to_string(arraySize));
+    return replaceAll(replace(mProfile->returnCreatedArrayString(),
+                              "<ARRAY_SIZE>", std::to_string(arraySize)),
+                      "<ARRAY_TYPE>", arrayType);
 }
 
 void Generator::GeneratorImpl::addInterfaceCreateDeleteArrayMethodsCode(std::string &code)
@@ -2450,7 +2965,7 @@ void Generator::GeneratorImpl::addImplementationCreateStatesArrayMethodCode(std:
         }
 
         code += replace(mProfile->implementationCreateStatesArrayMethodString(),
-                        "<CODE>", mProfile->indentString() + generateCreateArrayCode(mStates.size()));
+                        "<CODE>", mProfile->indentString() + generateCreateArrayCode(mStates.size(), "<STATES_TYPE>"));
     }
 }
 
@@ -2463,7 +2978,7 @@ void Generator::GeneratorImpl::addImplementationCreateVariablesArrayMethodCode(s
         }
 
         code += replace(mProfile->implementationCreateVariablesArrayMethodString(),
-                        "<CODE>", mProfile->indentString() + generateCreateArrayCode(mVariables.size()));
+                        "<CODE>", mProfile->indentString() + generateCreateArrayCode(mVariables.size(), "<VARIABLES_TYPE>"));
     }
 }
 
@@ -2490,16 +3005,16 @@ std::string Generator::GeneratorImpl::generateMethodBodyCode(const std::string &
 std::string Generator::GeneratorImpl::generateDoubleCode(const std::string &value)
 {
     if (value.find('.') != std::string::npos) {
-        return value;
+        return value + mProfile->numberSuffixString();
     }
 
     size_t ePos = value.find('e');
 
     if (ePos == std::string::npos) {
-        return value + ".0";
+        return value + ".0" + mProfile->numberSuffixString();
     }
 
-    return value.substr(0, ePos) + ".0" + value.substr(ePos);
+    return value.substr(0, ePos) + ".0" + value.substr(ePos) + mProfile->numberSuffixString();
 }
 
 std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr &variable, const GeneratorEquationAstPtr &ast)
@@ -2513,7 +3028,9 @@ std::string Generator::GeneratorImpl::generateVariableNameCode(const VariablePtr
     std::string arrayName;
 
     if (generatorVariable->mType == GeneratorInternalVariable::Type::STATE) {
-        arrayName = ((ast != nullptr) && (ast->mParent.lock()->mType == GeneratorEquationAst::Type::DIFF)) ?
+        GeneratorEquationAstPtr astParent = (ast != nullptr) ? ast->mParent.lock() : nullptr;
+
+        arrayName = ((astParent != nullptr) && (astParent->mType == GeneratorEquationAst::Type::DIFF)) ?
                         mProfile->ratesArrayString() :
                         mProfile->statesArrayString();
     } else {
@@ -3209,19 +3726,19 @@ std::string Generator::GeneratorImpl::generateCode(const GeneratorEquationAstPtr
         // Constants.
 
     case GeneratorEquationAst::Type::TRUE:
-        code = mProfile->trueString();
+        code = mProfile->trueString() + mProfile->numberSuffixString();
 
         break;
     case GeneratorEquationAst::Type::FALSE:
-        code = mProfile->falseString();
+        code = mProfile->falseString() + mProfile->numberSuffixString();
 
         break;
     case GeneratorEquationAst::Type::E:
-        code = mProfile->eString();
+        code = mProfile->eString() + mProfile->numberSuffixString();
 
         break;
     case GeneratorEquationAst::Type::PI:
-        code = mProfile->piString();
+        code = mProfile->piString() + mProfile->numberSuffixString();
 
         break;
     case GeneratorEquationAst::Type::INF:
@@ -3286,6 +3803,11 @@ void Generator::GeneratorImpl::addInterfaceComputeModelMethodsCode(std::string &
         interfaceComputeModelMethodsCode += mProfile->interfaceComputeVariablesMethodString();
     }
 
+    if (!mResets.empty()) {
+        interfaceComputeModelMethodsCode += mProfile->interfaceComputeRootsMethodString()
+                                            + mProfile->interfaceApplyResetsMethodString();
+    }
+
     if (!interfaceComputeModelMethodsCode.empty()) {
         code += "\n";
     }
@@ -3388,6 +3910,164 @@ void Generator::GeneratorImpl::addImplementationComputeVariablesMethodCode(std::
     }
 }
 
+void Generator::GeneratorImpl::addImplementationComputeRootsMethodCode(std::string &code)
+{
+    if (!mResets.empty()
+        && !mProfile->implementationComputeRootsMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        std::string methodBody;
+
+        for (size_t i = 0; i < mResets.size(); ++i) {
+            methodBody += mProfile->indentString()
+                          + mProfile->rootsArrayString() + mProfile->openArrayString() + std::to_string(i) + mProfile->closeArrayString()
+                          + mProfile->assignmentString() + generateCode(mResets[i]->mRootAst)
+                          + mProfile->commandSeparatorString() + "\n";
+        }
+
+        code += replace(mProfile->implementationComputeRootsMethodString(),
+                        "<CODE>", generateMethodBodyCode(methodBody));
+    }
+}
+
+void Generator::GeneratorImpl::addImplementationApplyResetsMethodCode(std::string &code)
+{
+    if (!mResets.empty()
+        && !mProfile->implementationApplyResetsMethodString().empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        // Determine the new value of each state that may get reset, in the
+        // order of its reset with the lowest order. A state takes the reset
+        // value of its active reset with the lowest order, if any, and keeps
+        // its current value otherwise. All the new values are computed before
+        // any state gets reset, so that a reset value only ever depends on the
+        // values from before the resets.
+
+        std::vector<GeneratorInternalVariablePtr> internalVariables;
+
+        for (const auto &reset : mResets) {
+            if (std::find(internalVariables.begin(), internalVariables.end(), reset->mInternalVariable) == internalVariables.end()) {
+                internalVariables.push_back(reset->mInternalVariable);
+            }
+        }
+
+        std::string methodBody;
+
+        for (size_t i = 0; i < internalVariables.size(); ++i) {
+            std::string newValue = generateVariableNameCode(internalVariables[i]->mVariable);
+
+            for (size_t j = mResets.size(); j-- != 0;) {
+                if (mResets[j]->mInternalVariable == internalVariables[i]) {
+                    std::string resetValue = generateCode(mResets[j]->mResetValueAst);
+
+                    if (isPiecewiseStatement(mResets[j]->mResetValueAst)) {
+                        resetValue = "(" + resetValue + ")";
+                    }
+
+                    newValue = generatePiecewiseIfCode(mProfile->rootsFoundArrayString() + mProfile->openArrayString() + std::to_string(j) + mProfile->closeArrayString(),
+                                                       resetValue)
+                               + generatePiecewiseElseCode(newValue);
+                }
+            }
+
+            methodBody += mProfile->indentString()
+                          + replace(mProfile->resetValueDeclarationString(), "<INDEX>", std::to_string(i))
+                          + mProfile->assignmentString() + newValue
+                          + mProfile->commandSeparatorString() + "\n";
+        }
+
+        methodBody += "\n";
+
+        for (size_t i = 0; i < internalVariables.size(); ++i) {
+            methodBody += mProfile->indentString() + generateVariableNameCode(internalVariables[i]->mVariable)
+                          + mProfile->assignmentString()
+                          + replace(mProfile->resetValueString(), "<INDEX>", std::to_string(i))
+                          + mProfile->commandSeparatorString() + "\n";
+        }
+
+        code += replace(mProfile->implementationApplyResetsMethodString(),
+                        "<CODE>", generateMethodBodyCode(methodBody));
+    }
+}
+
+void Generator::GeneratorImpl::updateMethodsCode()
+{
+    // The code of our methods depends on our profile, so regenerate all of it
+    // if our profile has been modified since it was generated.
+
+    std::string profileContents = GeneratorImpl::profileContents();
+
+    if (profileContents != mMethodsCodeProfileContents) {
+        mMethodsCodeProfileContents = profileContents;
+
+        mMethodsCode.clear();
+    }
+
+    // The code of our initializeStatesAndConstants() method also depends on
+    // the initial value of our states and constants, which may have been
+    // modified since it was generated.
+
+    std::vector<std::string> initialValues = GeneratorImpl::initialValues();
+
+    if (initialValues != mMethodsCodeInitialValues) {
+        mMethodsCodeInitialValues = initialValues;
+
+        mMethodsCode.erase(Generator::Method::INITIALIZE_STATES_AND_CONSTANTS);
+    }
+
+    // An equation is only computed by the first of our compute methods that
+    // needs it, so a compute method must be regenerated if one of the compute
+    // methods that precede it is regenerated, except for our
+    // initializeStatesAndConstants() method, which comes first.
+
+    if ((mMethodsCode.find(Generator::Method::COMPUTE_COMPUTED_CONSTANTS) == mMethodsCode.end())
+        || (mMethodsCode.find(Generator::Method::COMPUTE_RATES) == mMethodsCode.end())
+        || (mMethodsCode.find(Generator::Method::COMPUTE_VARIABLES) == mMethodsCode.end())) {
+        mMethodsCode.erase(Generator::Method::INITIALIZE_STATES_AND_CONSTANTS);
+        mMethodsCode.erase(Generator::Method::COMPUTE_COMPUTED_CONSTANTS);
+        mMethodsCode.erase(Generator::Method::COMPUTE_RATES);
+        mMethodsCode.erase(Generator::Method::COMPUTE_VARIABLES);
+    }
+
+    std::vector<GeneratorEquationPtr> remainingEquations {std::begin(mEquations), std::end(mEquations)};
+
+    if (mMethodsCode.find(Generator::Method::INITIALIZE_STATES_AND_CONSTANTS) == mMethodsCode.end()) {
+        addImplementationInitializeStatesAndConstantsMethodCode(mMethodsCode[Generator::Method::INITIALIZE_STATES_AND_CONSTANTS], remainingEquations);
+    }
+
+    if (mMethodsCode.find(Generator::Method::COMPUTE_COMPUTED_CONSTANTS) == mMethodsCode.end()) {
+        addImplementationComputeComputedConstantsMethodCode(mMethodsCode[Generator::Method::COMPUTE_COMPUTED_CONSTANTS], remainingEquations);
+        addImplementationComputeRatesMethodCode(mMethodsCode[Generator::Method::COMPUTE_RATES], remainingEquations);
+        addImplementationComputeVariablesMethodCode(mMethodsCode[Generator::Method::COMPUTE_VARIABLES], remainingEquations);
+    }
+
+    if (mMethodsCode.find(Generator::Method::COMPUTE_ROOTS) == mMethodsCode.end()) {
+        addImplementationComputeRootsMethodCode(mMethodsCode[Generator::Method::COMPUTE_ROOTS]);
+    }
+
+    if (mMethodsCode.find(Generator::Method::APPLY_RESETS) == mMethodsCode.end()) {
+        addImplementationApplyResetsMethodCode(mMethodsCode[Generator::Method::APPLY_RESETS]);
+    }
+}
+
+void Generator::GeneratorImpl::addMethodCode(std::string &code,
+                                             Generator::Method method)
+{
+    const std::string &methodCode = mMethodsCode[method];
+
+    if (!methodCode.empty()) {
+        if (!code.empty()) {
+            code += "\n";
+        }
+
+        code += methodCode;
+    }
+}
+
 Generator::Generator()
     : mPimpl(new GeneratorImpl())
 {
@@ -3490,6 +4170,20 @@ GeneratorVariablePtr Generator::variable(size_t index) const
     return mPimpl->mVariables[index];
 }
 
+std::string Generator::fingerprint() const
+{
+    if (!mPimpl->hasValidModel()) {
+        return {};
+    }
+
+    return mPimpl->fingerprint();
+}
+
+bool Generator::isMethodModified(Method method) const
+{
+    return mPimpl->mModifiedMethods.find(method) != mPimpl->mModifiedMethods.end();
+}
+
 std::string Generator::interfaceCode() const
 {
     if (!mPimpl->hasValidModel() || !mPimpl->mProfile->hasInterface()) {
@@ -3510,9 +4204,15 @@ std::string Generator::interfaceCode() const
 
     mPimpl->addVersionAndLibcellmlVersionCode(res, true);
 
-    // Add code for the interface of the number of states and variables.
+    // Add code for the interface of the number of states, variables and
+    // roots.
 
     mPimpl->addStateAndVariableCountCode(res, true);
+    mPimpl->addRootCountCode(res, true);
+
+    // Add code for the interface of the model instance type.
+
+    mPimpl->addModelInstanceTypeCode(res, true);
 
     // Add code for the variable information related objects.
 
@@ -3535,7 +4235,7 @@ std::string Generator::interfaceCode() const
 
     mPimpl->addInterfaceComputeModelMethodsCode(res);
 
-    return res;
+    return mPimpl->replaceTypes(res);
 }
 
 std::string Generator::implementationCode() const
@@ -3559,9 +4259,15 @@ std::string Generator::implementationCode() const
 
     mPimpl->addVersionAndLibcellmlVersionCode(res);
 
-    // Add code for the implementation of the number of states and variables.
+    // Add code for the implementation of the number of states, variables and
+    // roots.
 
     mPimpl->addStateAndVariableCountCode(res);
+    mPimpl->addRootCountCode(res);
+
+    // Add code for the implementation of the model instance type.
+
+    mPimpl->addModelInstanceTypeCode(res);
 
     // Add code for the variable information related objects.
 
@@ -3589,20 +4295,23 @@ std::string Generator::implementationCode() const
     mPimpl->addImplementationCreateVariablesArrayMethodCode(res);
     mPimpl->addImplementationDeleteArrayMethodCode(res);
 
-    // Add code for the implementation to initialise our states and constants.
+    // Make sure that the code of our methods is up to date. Only the methods
+    // that need it get regenerated.
 
-    std::vector<GeneratorEquationPtr> remainingEquations {std::begin(mPimpl->mEquations), std::end(mPimpl->mEquations)};
+    mPimpl->updateMethodsCode();
 
-    mPimpl->addImplementationInitializeStatesAndConstantsMethodCode(res, remainingEquations);
+    // Add code for the implementation to initialise our states and constants.
+
+    mPimpl->addMethodCode(res, Method::INITIALIZE_STATES_AND_CONSTANTS);
 
     // Add code for the implementation to compute our computed constants.
 
-    mPimpl->addImplementationComputeComputedConstantsMethodCode(res, remainingEquations);
+    mPimpl->addMethodCode(res, Method::COMPUTE_COMPUTED_CONSTANTS);
 
     // Add code for the implementation to compute our rates (and any variables
     // on which they depend).
 
-    mPimpl->addImplementationComputeRatesMethodCode(res, remainingEquations);
+    mPimpl->addMethodCode(res, Method::COMPUTE_RATES);
 
     // Add code for the implementation to compute our variables.
     // Note: this method computes the remaining variables, i.e. the ones not
@@ -3612,9 +4321,15 @@ std::string Generator::implementationCode() const
     //       variables that rely on the value of some states/rates are up to
     //       date.
 
-    mPimpl->addImplementationComputeVariablesMethodCode(res, remainingEquations);
+    mPimpl->addMethodCode(res, Method::COMPUTE_VARIABLES);
 
-    return res;
+    // Add code for the implementation to compute our roots and apply our
+    // resets, should we have resets.
+
+    mPimpl->addMethodCode(res, Method::COMPUTE_ROOTS);
+    mPimpl->addMethodCode(res, Method::APPLY_RESETS);
+
+    return mPimpl->replaceTypes(res);
 }
 
 } // namespace libcellml
@@ -186,6 +186,12 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceVariableCountString;
     std::string mImplementationVariableCountString;
 
+    std::string mInterfaceRootCountString;
+    std::string mImplementationRootCountString;
+
+    std::string mInterfaceModelInstanceTypeString;
+    std::string mImplementationModelInstanceTypeString;
+
     std::string mVariableTypeObjectString;
 
     std::string mConstantVariableTypeString;
@@ -213,6 +219,17 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mRatesArrayString;
     std::string mVariablesArrayString;
 
+    std::string mRootsArrayString;
+    std::string mRootsFoundArrayString;
+    std::string mResetValueDeclarationString;
+    std::string mResetValueString;
+
+    std::string mStatesTypeString;
+    std::string mVariablesTypeString;
+    std::string mComputeTypeString;
+
+    std::string mNumberSuffixString;
+
     std::string mReturnCreatedArrayString;
 
     std::string mInterfaceCreateStatesArrayMethodString;
@@ -236,6 +253,12 @@ struct GeneratorProfile::GeneratorProfileImpl
     std::string mInterfaceComputeVariablesMethodString;
     std::string mImplementationComputeVariablesMethodString;
 
+    std::string mInterfaceComputeRootsMethodString;
+    std::string mImplementationComputeRootsMethodString;
+
+    std::string mInterfaceApplyResetsMethodString;
+    std::string mImplementationApplyResetsMethodString;
+
     std::string mEmptyMethodString;
 
     std::string mIndentString;
@@ -252,14 +275,18 @@ struct GeneratorProfile::GeneratorProfileImpl
 
     std::string mCommandSeparatorString;
 
+    GeneratorProfile::Precision mComputePrecision = GeneratorProfile::Precision::DOUBLE;
+
     void loadProfile(GeneratorProfile::Profile profile);
+    void loadComputePrecision(GeneratorProfile::Precision precision);
 };
 
 void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profile profile)
 {
     mProfile = profile;
 
-    if (profile == GeneratorProfile::Profile::C) {
+    if ((profile == GeneratorProfile::Profile::C)
+        || (profile == GeneratorProfile::Profile::C_STATIC)) {
         // Whether the profile requires an interface to be generated.
 
         mHasInterface = true;
@@ -298,44 +325,23 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mMinusString = "-";
         mTimesString = "*";
         mDivideString = "/";
-        mPowerString = "pow";
-        mSquareRootString = "sqrt";
         mSquareString = "";
-        mAbsoluteValueString = "fabs";
-        mExponentialString = "exp";
-        mNapierianLogarithmString = "log";
-        mCommonLogarithmString = "log10";
-        mCeilingString = "ceil";
-        mFloorString = "floor";
         mMinString = "min";
         mMaxString = "max";
-        mRemString = "fmod";
 
         mHasPowerOperator = false;
 
         // Trigonometric operators.
 
-        mSinString = "sin";
-        mCosString = "cos";
-        mTanString = "tan";
         mSecString = "sec";
         mCscString = "csc";
         mCotString = "cot";
-        mSinhString = "sinh";
-        mCoshString = "cosh";
-        mTanhString = "tanh";
         mSechString = "sech";
         mCschString = "csch";
         mCothString = "coth";
-        mAsinString = "asin";
-        mAcosString = "acos";
-        mAtanString = "atan";
         mAsecString = "asec";
         mAcscString = "acsc";
         mAcotString = "acot";
-        mAsinhString = "asinh";
-        mAcoshString = "acosh";
-        mAtanhString = "atanh";
         mAsechString = "asech";
         mAcschString = "acsch";
         mAcothString = "acoth";
@@ -366,77 +372,16 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mGeqFunctionString = "";
         mAndFunctionString = "";
         mOrFunctionString = "";
-        mXorFunctionString = "double xor(double x, double y)\n"
-                             "{\n"
-                             "    return (x != 0.0) ^ (y != 0.0);\n"
-                             "}\n";
         mNotFunctionString = "";
-        mMinFunctionString = "double min(double x, double y)\n"
+        mMinFunctionString = "<COMPUTE_TYPE> min(<COMPUTE_TYPE> x, <COMPUTE_TYPE> y)\n"
                              "{\n"
                              "    return (x < y)?x:y;\n"
                              "}\n";
-        mMaxFunctionString = "double max(double x, double y)\n"
+        mMaxFunctionString = "<COMPUTE_TYPE> max(<COMPUTE_TYPE> x, <COMPUTE_TYPE> y)\n"
                              "{\n"
                              "    return (x > y)?x:y;\n"
                              "}\n";
 
-        // Trigonometric functions.
-
-        mSecFunctionString = "double sec(double x)\n"
-                             "{\n"
-                             "    return 1.0/cos(x);\n"
-                             "}\n";
-        mCscFunctionString = "double csc(double x)\n"
-                             "{\n"
-                             "    return 1.0/sin(x);\n"
-                             "}\n";
-        mCotFunctionString = "double cot(double x)\n"
-                             "{\n"
-                             "    return 1.0/tan(x);\n"
-                             "}\n";
-        mSechFunctionString = "double sech(double x)\n"
-                              "{\n"
-                              "    return 1.0/cosh(x);\n"
-                              "}\n";
-        mCschFunctionString = "double csch(double x)\n"
-                              "{\n"
-                              "    return 1.0/sinh(x);\n"
-                              "}\n";
-        mCothFunctionString = "double coth(double x)\n"
-                              "{\n"
-                              "    return 1.0/tanh(x);\n"
-                              "}\n";
-        mAsecFunctionString = "double asec(double x)\n"
-                              "{\n"
-                              "    return acos(1.0/x);\n"
-                              "}\n";
-        mAcscFunctionString = "double acsc(double x)\n"
-                              "{\n"
-                              "    return asin(1.0/x);\n"
-                              "}\n";
-        mAcotFunctionString = "double acot(double x)\n"
-                              "{\n"
-                              "    return atan(1.0/x);\n"
-                              "}\n";
-        mAsechFunctionString = "double asech(double x)\n"
-                               "{\n"
-                               "    double oneOverX = 1.0/x;\n"
-                               "\n"
-                               "    return log(oneOverX+sqrt(oneOverX*oneOverX-1.0));\n"
-                               "}\n";
-        mAcschFunctionString = "double acsch(double x)\n"
-                               "{\n"
-                               "    double oneOverX = 1.0/x;\n"
-                               "\n"
-                               "    return log(oneOverX+sqrt(oneOverX*oneOverX+1.0));\n"
-                               "}\n";
-        mAcothFunctionString = "double acoth(double x)\n"
-                               "{\n"
-                               "    double oneOverX = 1.0/x;\n"
-                               "\n"
-                               "    return 0.5*log((1.0+oneOverX)/(1.0-oneOverX));\n"
-                               "}\n";
-
         // Miscellaneous.
 
         mCommentString = "/* <CODE> */\n";
@@ -462,6 +407,12 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceVariableCountString = "extern const size_t VARIABLE_COUNT;\n";
         mImplementationVariableCountString = "const size_t VARIABLE_COUNT = <VARIABLE_COUNT>;\n";
 
+        mInterfaceRootCountString = "extern const size_t ROOT_COUNT;\n";
+        mImplementationRootCountString = "const size_t ROOT_COUNT = <ROOT_COUNT>;\n";
+
+        mInterfaceModelInstanceTypeString = "";
+        mImplementationModelInstanceTypeString = "";
+
         mVariableTypeObjectString = "typedef enum {\n"
                                     "    CONSTANT,\n"
                                     "    COMPUTED_CONSTANT,\n"
@@ -506,49 +457,70 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
 
-        mReturnCreatedArrayString = "return (double *) malloc(<ARRAY_SIZE>*sizeof(double));\n";
+        mRootsArrayString = "roots";
+        mRootsFoundArrayString = "rootsFound";
+
+        mResetValueDeclarationString = "<STATES_TYPE> resetValue<INDEX>";
+        mResetValueString = "resetValue<INDEX>";
 
-        mInterfaceCreateStatesArrayMethodString = "double * createStatesArray();\n";
-        mImplementationCreateStatesArrayMethodString = "double * createStatesArray()\n"
+        mStatesTypeString = "double";
+        mVariablesTypeString = "double";
+
+        mReturnCreatedArrayString = "return (<ARRAY_TYPE> *) malloc(<ARRAY_SIZE>*sizeof(<ARRAY_TYPE>));\n";
+
+        mInterfaceCreateStatesArrayMethodString = "<STATES_TYPE> * createStatesArray();\n";
+        mImplementationCreateStatesArrayMethodString = "<STATES_TYPE> * createStatesArray()\n"
                                                        "{\n"
                                                        "<CODE>"
                                                        "}\n";
 
-        mInterfaceCreateVariablesArrayMethodString = "double * createVariablesArray();\n";
-        mImplementationCreateVariablesArrayMethodString = "double * createVariablesArray()\n"
+        mInterfaceCreateVariablesArrayMethodString = "<VARIABLES_TYPE> * createVariablesArray();\n";
+        mImplementationCreateVariablesArrayMethodString = "<VARIABLES_TYPE> * createVariablesArray()\n"
                                                           "{\n"
                                                           "<CODE>"
                                                           "}\n";
 
-        mInterfaceDeleteArrayMethodString = "void deleteArray(double *array);\n";
-        mImplementationDeleteArrayMethodString = "void deleteArray(double *array)\n"
+        mInterfaceDeleteArrayMethodString = "void deleteArray(void *array);\n";
+        mImplementationDeleteArrayMethodString = "void deleteArray(void *array)\n"
                                                  "{\n"
                                                  "    free(array);\n"
                                                  "}\n";
 
-        mInterfaceInitializeStatesAndConstantsMethodString = "void initializeStatesAndConstants(double *states, double *variables);\n";
-        mImplementationInitializeStatesAndConstantsMethodString = "void initializeStatesAndConstants(double *states, double *variables)\n"
+        mInterfaceInitializeStatesAndConstantsMethodString = "void initializeStatesAndConstants(<STATES_TYPE> *states, <VARIABLES_TYPE> *variables);\n";
+        mImplementationInitializeStatesAndConstantsMethodString = "void initializeStatesAndConstants(<STATES_TYPE> *states, <VARIABLES_TYPE> *variables)\n"
                                                                   "{\n"
                                                                   "<CODE>"
                                                                   "}\n";
 
-        mInterfaceComputeComputedConstantsMethodString = "void computeComputedConstants(double *variables);\n";
-        mImplementationComputeComputedConstantsMethodString = "void computeComputedConstants(double *variables)\n"
+        mInterfaceComputeComputedConstantsMethodString = "void computeComputedConstants(<VARIABLES_TYPE> *variables);\n";
+        mImplementationComputeComputedConstantsMethodString = "void computeComputedConstants(<VARIABLES_TYPE> *variables)\n"
                                                               "{\n"
                                                               "<CODE>"
                                                               "}\n";
 
-        mInterfaceComputeRatesMethodString = "void computeRates(double voi, double *states, double *rates, double *variables);\n";
-        mImplementationComputeRatesMethodString = "void computeRates(double voi, double *states, double *rates, double *variables)\n{\n"
+        mInterfaceComputeRatesMethodString = "void computeRates(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables);\n";
+        mImplementationComputeRatesMethodString = "void computeRates(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables)\n{\n"
                                                   "<CODE>"
                                                   "}\n";
 
-        mInterfaceComputeVariablesMethodString = "void computeVariables(double voi, double *states, double *rates, double *variables);\n";
-        mImplementationComputeVariablesMethodString = "void computeVariables(double voi, double *states, double *rates, double *variables)\n"
+        mInterfaceComputeVariablesMethodString = "void computeVariables(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables);\n";
+        mImplementationComputeVariablesMethodString = "void computeVariables(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables)\n"
                                                       "{\n"
                                                       "<CODE>"
                                                       "}\n";
 
+        mInterfaceComputeRootsMethodString = "void computeRoots(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, <COMPUTE_TYPE> *roots);\n";
+        mImplementationComputeRootsMethodString = "void computeRoots(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, <COMPUTE_TYPE> *roots)\n"
+                                                  "{\n"
+                                                  "<CODE>"
+                                                  "}\n";
+
+        mInterfaceApplyResetsMethodString = "void applyResets(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, int *rootsFound);\n";
+        mImplementationApplyResetsMethodString = "void applyResets(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, int *rootsFound)\n"
+                                                 "{\n"
+                                                 "<CODE>"
+                                                 "}\n";
+
         mEmptyMethodString = "";
 
         mIndentString = "    ";
@@ -564,7 +536,82 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mStringDelimiterString = "\"";
 
         mCommandSeparatorString = ";";
-    } else if (profile == GeneratorProfile::Profile::PYTHON) {
+
+        if (profile == GeneratorProfile::Profile::C_STATIC) {
+            // Sizes known at compile time and a model instance type holding
+            // the states and variables, rather than arrays allocated at run
+            // time.
+
+            mImplementationHeaderString = "#include \"model.h\"\n"
+                                          "\n"
+                                          "#include <math.h>\n";
+
+            mInterfaceStateCountString = "#define STATE_COUNT <STATE_COUNT>\n";
+            mImplementationStateCountString = "";
+
+            mInterfaceVariableCountString = "#define VARIABLE_COUNT <VARIABLE_COUNT>\n";
+            mImplementationVariableCountString = "";
+
+            mInterfaceRootCountString = "#define ROOT_COUNT <ROOT_COUNT>\n";
+            mImplementationRootCountString = "";
+
+            mInterfaceModelInstanceTypeString = "typedef struct {\n"
+                                                "    <STATES_TYPE> states[<STATE_COUNT>];\n"
+                                                "    <VARIABLES_TYPE> variables[<VARIABLE_COUNT>];\n"
+                                                "} ModelInstance;\n";
+
+            mStatesArrayString = "instance->states";
+            mVariablesArrayString = "instance->variables";
+
+            mReturnCreatedArrayString = "";
+
+            mInterfaceCreateStatesArrayMethodString = "";
+            mImplementationCreateStatesArrayMethodString = "";
+
+            mInterfaceCreateVariablesArrayMethodString = "";
+            mImplementationCreateVariablesArrayMethodString = "";
+
+            mInterfaceDeleteArrayMethodString = "";
+            mImplementationDeleteArrayMethodString = "";
+
+            mInterfaceInitializeStatesAndConstantsMethodString = "void initializeStatesAndConstants(ModelInstance *instance);\n";
+            mImplementationInitializeStatesAndConstantsMethodString = "void initializeStatesAndConstants(ModelInstance *instance)\n"
+                                                                      "{\n"
+                                                                      "<CODE>"
+                                                                      "}\n";
+
+            mInterfaceComputeComputedConstantsMethodString = "void computeComputedConstants(ModelInstance *instance);\n";
+            mImplementationComputeComputedConstantsMethodString = "void computeComputedConstants(ModelInstance *instance)\n"
+                                                                  "{\n"
+                                                                  "<CODE>"
+                                                                  "}\n";
+
+            mInterfaceComputeRatesMethodString = "void computeRates(<COMPUTE_TYPE> voi, ModelInstance *instance, <STATES_TYPE> *rates);\n";
+            mImplementationComputeRatesMethodString = "void computeRates(<COMPUTE_TYPE> voi, ModelInstance *instance, <STATES_TYPE> *rates)\n"
+                                                      "{\n"
+                                                      "<CODE>"
+                                                      "}\n";
+
+            mInterfaceComputeVariablesMethodString = "void computeVariables(<COMPUTE_TYPE> voi, ModelInstance *instance, <STATES_TYPE> *rates);\n";
+            mImplementationComputeVariablesMethodString = "void computeVariables(<COMPUTE_TYPE> voi, ModelInstance *instance, <STATES_TYPE> *rates)\n"
+                                                          "{\n"
+                                                          "<CODE>"
+                                                          "}\n";
+
+            mInterfaceComputeRootsMethodString = "void computeRoots(<COMPUTE_TYPE> voi, ModelInstance *instance, <COMPUTE_TYPE> *roots);\n";
+            mImplementationComputeRootsMethodString = "void computeRoots(<COMPUTE_TYPE> voi, ModelInstance *instance, <COMPUTE_TYPE> *roots)\n"
+                                                      "{\n"
+                                                      "<CODE>"
+                                                      "}\n";
+
+            mInterfaceApplyResetsMethodString = "void applyResets(<COMPUTE_TYPE> voi, ModelInstance *instance, int *rootsFound);\n";
+            mImplementationApplyResetsMethodString = "void applyResets(<COMPUTE_TYPE> voi, ModelInstance *instance, int *rootsFound)\n"
+                                                     "{\n"
+                                                     "<CODE>"
+                                                     "}\n";
+        }
+    } else if ((profile == GeneratorProfile::Profile::PYTHON)
+               || (profile == GeneratorProfile::Profile::PYTHON_NUMPY)) {
         // Whether the profile requires an interface to be generated.
 
         mHasInterface = false;
@@ -767,6 +814,12 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mInterfaceVariableCountString = "";
         mImplementationVariableCountString = "VARIABLE_COUNT = <VARIABLE_COUNT>\n";
 
+        mInterfaceRootCountString = "";
+        mImplementationRootCountString = "ROOT_COUNT = <ROOT_COUNT>\n";
+
+        mInterfaceModelInstanceTypeString = "";
+        mImplementationModelInstanceTypeString = "";
+
         mVariableTypeObjectString = "\n"
                                     "class VariableType(Enum):\n"
                                     "    CONSTANT = 1\n"
@@ -803,6 +856,18 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mRatesArrayString = "rates";
         mVariablesArrayString = "variables";
 
+        mRootsArrayString = "roots";
+        mRootsFoundArrayString = "roots_found";
+
+        mResetValueDeclarationString = "reset_value_<INDEX>";
+        mResetValueString = "reset_value_<INDEX>";
+
+        mStatesTypeString = "";
+        mVariablesTypeString = "";
+        mComputeTypeString = "";
+
+        mNumberSuffixString = "";
+
         mReturnCreatedArrayString = "return [nan]*<ARRAY_SIZE>\n";
 
         mInterfaceCreateStatesArrayMethodString = "";
@@ -838,6 +903,16 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
                                                       "def compute_variables(voi, states, rates, variables):\n"
                                                       "<CODE>";
 
+        mInterfaceComputeRootsMethodString = "";
+        mImplementationComputeRootsMethodString = "\n"
+                                                  "def compute_roots(voi, states, variables, roots):\n"
+                                                  "<CODE>";
+
+        mInterfaceApplyResetsMethodString = "";
+        mImplementationApplyResetsMethodString = "\n"
+                                                 "def apply_resets(voi, states, variables, roots_found):\n"
+                                                 "<CODE>";
+
         mEmptyMethodString = "pass\n";
 
         mIndentString = "    ";
@@ -853,7 +928,256 @@ void GeneratorProfile::GeneratorProfileImpl::loadProfile(GeneratorProfile::Profi
         mStringDelimiterString = "\"";
 
         mCommandSeparatorString = "";
+
+        if (profile == GeneratorProfile::Profile::PYTHON_NUMPY) {
+            // States, rates and variables are 2-D NumPy arrays with one
+            // column per cell, so that a single call computes many cells at
+            // once. This means that we must use NumPy's element-wise functions
+            // and np.where() rather than Python's conditional expression.
+
+            mEqFunctionString = "\n"
+                                "def eq_func(x, y):\n"
+                                "    return np.where(x == y, 1.0, 0.0)\n";
+            mNeqFunctionString = "\n"
+                                 "def neq_func(x, y):\n"
+                                 "    return np.where(x != y, 1.0, 0.0)\n";
+            mLtFunctionString = "\n"
+                                "def lt_func(x, y):\n"
+                                "    return np.where(x < y, 1.0, 0.0)\n";
+            mLeqFunctionString = "\n"
+                                 "def leq_func(x, y):\n"
+                                 "    return np.where(x <= y, 1.0, 0.0)\n";
+            mGtFunctionString = "\n"
+                                "def gt_func(x, y):\n"
+                                "    return np.where(x > y, 1.0, 0.0)\n";
+            mGeqFunctionString = "\n"
+                                 "def geq_func(x, y):\n"
+                                 "    return np.where(x >= y, 1.0, 0.0)\n";
+            mAndFunctionString = "\n"
+                                 "def and_func(x, y):\n"
+                                 "    return np.where(np.logical_and(x, y), 1.0, 0.0)\n";
+            mOrFunctionString = "\n"
+                                "def or_func(x, y):\n"
+                                "    return np.where(np.logical_or(x, y), 1.0, 0.0)\n";
+            mXorFunctionString = "\n"
+                                 "def xor_func(x, y):\n"
+                                 "    return np.where(np.logical_xor(x, y), 1.0, 0.0)\n";
+            mNotFunctionString = "\n"
+                                 "def not_func(x):\n"
+                                 "    return np.where(np.logical_not(x), 1.0, 0.0)\n";
+
+            mPowerString = "np.power";
+            mSquareRootString = "np.sqrt";
+            mAbsoluteValueString = "np.fabs";
+            mExponentialString = "np.exp";
+            mNapierianLogarithmString = "np.log";
+            mCommonLogarithmString = "np.log10";
+            mCeilingString = "np.ceil";
+            mFloorString = "np.floor";
+            mMinString = "np.minimum";
+            mMaxString = "np.maximum";
+            mRemString = "np.fmod";
+
+            mMinFunctionString = "";
+            mMaxFunctionString = "";
+
+            mSinString = "np.sin";
+            mCosString = "np.cos";
+            mTanString = "np.tan";
+            mSinhString = "np.sinh";
+            mCoshString = "np.cosh";
+            mTanhString = "np.tanh";
+            mAsinString = "np.arcsin";
+            mAcosString = "np.arccos";
+            mAtanString = "np.arctan";
+            mAsinhString = "np.arcsinh";
+            mAcoshString = "np.arccosh";
+            mAtanhString = "np.arctanh";
+
+            mSecFunctionString = "\n"
+                                 "def sec(x):\n"
+                                 "    return 1.0/np.cos(x)\n";
+            mCscFunctionString = "\n"
+                                 "def csc(x):\n"
+                                 "    return 1.0/np.sin(x)\n";
+            mCotFunctionString = "\n"
+                                 "def cot(x):\n"
+                                 "    return 1.0/np.tan(x)\n";
+            mSechFunctionString = "\n"
+                                  "def sech(x):\n"
+                                  "    return 1.0/np.cosh(x)\n";
+            mCschFunctionString = "\n"
+                                  "def csch(x):\n"
+                                  "    return 1.0/np.sinh(x)\n";
+            mCothFunctionString = "\n"
+                                  "def coth(x):\n"
+                                  "    return 1.0/np.tanh(x)\n";
+            mAsecFunctionString = "\n"
+                                  "def asec(x):\n"
+                                  "    return np.arccos(1.0/x)\n";
+            mAcscFunctionString = "\n"
+                                  "def acsc(x):\n"
+                                  "    return np.arcsin(1.0/x)\n";
+            mAcotFunctionString = "\n"
+                                  "def acot(x):\n"
+                                  "    return np.arctan(1.0/x)\n";
+            mAsechFunctionString = "\n"
+                                   "def asech(x):\n"
+                                   "    one_over_x = 1.0/x\n"
+                           "\n"
+                                   "    return np.log(one_over_x+np.sqrt(one_over_x*one_over_x-1.0))\n";
+            mAcschFunctionString = "\n"
+                                   "def acsch(x):\n"
+                                   "    one_over_x = 1.0/x\n"
+                           "\n"
+                                   "    return np.log(one_over_x+np.sqrt(one_over_x*one_over_x+1.0))\n";
+            mAcothFunctionString = "\n"
+                                   "def acoth(x):\n"
+                                   "    one_over_x = 1.0/x\n"
+                           "\n"
+                                   "    return 0.5*np.log((1.0+one_over_x)/(1.0-one_over_x))\n";
+
+            mConditionalOperatorIfString = "np.where(<CONDITION>, <IF_STATEMENT>";
+            mConditionalOperatorElseString = ", <ELSE_STATEMENT>)";
+
+            mInfString = "np.inf";
+            mNanString = "np.nan";
+
+            mImplementationHeaderString = "from enum import Enum\n"
+                                          "\n"
+                                          "import numpy as np\n"
+                                          "\n";
+
+            mReturnCreatedArrayString = "return np.full((<ARRAY_SIZE>, cell_count), np.nan)\n";
+
+            mImplementationCreateStatesArrayMethodString = "\n"
+                                                           "def create_states_array(cell_count):\n"
+                                                           "<CODE>";
+
+            mImplementationCreateVariablesArrayMethodString = "\n"
+                                                              "def create_variables_array(cell_count):\n"
+                                                              "<CODE>";
+        }
     }
+
+    // Everything that depends on the precision of computations.
+
+    loadComputePrecision(GeneratorProfile::Precision::DOUBLE);
+}
+
+void GeneratorProfile::GeneratorProfileImpl::loadComputePrecision(GeneratorProfile::Precision precision)
+{
+    mComputePrecision = precision;
+
+    // Python only has double precision numbers.
+
+    if ((mProfile != GeneratorProfile::Profile::C)
+        && (mProfile != GeneratorProfile::Profile::C_STATIC)) {
+        return;
+    }
+
+    // In C, a single precision number or mathematical function is spelled
+    // like its double precision counterpart, but with an "f" suffix.
+
+    std::string suffix = (precision == GeneratorProfile::Precision::SINGLE) ? "f" : "";
+    std::string zero = "0.0" + suffix;
+    std::string half = "0.5" + suffix;
+    std::string one = "1.0" + suffix;
+
+    mComputeTypeString = (precision == GeneratorProfile::Precision::SINGLE) ? "float" : "double";
+
+    mNumberSuffixString = suffix;
+
+    // Arithmetic operators.
+
+    mPowerString = "pow" + suffix;
+    mSquareRootString = "sqrt" + suffix;
+    mAbsoluteValueString = "fabs" + suffix;
+    mExponentialString = "exp" + suffix;
+    mNapierianLogarithmString = "log" + suffix;
+    mCommonLogarithmString = "log10" + suffix;
+    mCeilingString = "ceil" + suffix;
+    mFloorString = "floor" + suffix;
+    mRemString = "fmod" + suffix;
+
+    // Trigonometric operators.
+
+    mSinString = "sin" + suffix;
+    mCosString = "cos" + suffix;
+    mTanString = "tan" + suffix;
+    mSinhString = "sinh" + suffix;
+    mCoshString = "cosh" + suffix;
+    mTanhString = "tanh" + suffix;
+    mAsinString = "asin" + suffix;
+    mAcosString = "acos" + suffix;
+    mAtanString = "atan" + suffix;
+    mAsinhString = "asinh" + suffix;
+    mAcoshString = "acosh" + suffix;
+    mAtanhString = "atanh" + suffix;
+
+    // Arithmetic functions.
+
+    mXorFunctionString = "<COMPUTE_TYPE> xor(<COMPUTE_TYPE> x, <COMPUTE_TYPE> y)\n"
+                         "{\n"
+                         "    return (x != " + zero + ") ^ (y != " + zero + ");\n"
+                         "}\n";
+
+    // Trigonometric functions.
+
+    mSecFunctionString = "<COMPUTE_TYPE> sec(<COMPUTE_TYPE> x)\n"
+                         "{\n"
+                         "    return " + one + "/" + mCosString + "(x);\n"
+                         "}\n";
+    mCscFunctionString = "<COMPUTE_TYPE> csc(<COMPUTE_TYPE> x)\n"
+                         "{\n"
+                         "    return " + one + "/" + mSinString + "(x);\n"
+                         "}\n";
+    mCotFunctionString = "<COMPUTE_TYPE> cot(<COMPUTE_TYPE> x)\n"
+                         "{\n"
+                         "    return " + one + "/" + mTanString + "(x);\n"
+                         "}\n";
+    mSechFunctionString = "<COMPUTE_TYPE> sech(<COMPUTE_TYPE> x)\n"
+                          "{\n"
+                          "    return " + one + "/" + mCoshString + "(x);\n"
+                          "}\n";
+    mCschFunctionString = "<COMPUTE_TYPE> csch(<COMPUTE_TYPE> x)\n"
+                          "{\n"
+                          "    return " + one + "/" + mSinhString + "(x);\n"
+                          "}\n";
+    mCothFunctionString = "<COMPUTE_TYPE> coth(<COMPUTE_TYPE> x)\n"
+                          "{\n"
+                          "    return " + one + "/" + mTanhString + "(x);\n"
+                          "}\n";
+    mAsecFunctionString = "<COMPUTE_TYPE> asec(<COMPUTE_TYPE> x)\n"
+                          "{\n"
+                          "    return " + mAcosString + "(" + one + "/x);\n"
+                          "}\n";
+    mAcscFunctionString = "<COMPUTE_TYPE> acsc(<COMPUTE_TYPE> x)\n"
+                          "{\n"
+                          "    return " + mAsinString + "(" + one + "/x);\n"
+                          "}\n";
+    mAcotFunctionString = "<COMPUTE_TYPE> acot(<COMPUTE_TYPE> x)\n"
+                          "{\n"
+                          "    return " + mAtanString + "(" + one + "/x);\n"
+                          "}\n";
+    mAsechFunctionString = "<COMPUTE_TYPE> asech(<COMPUTE_TYPE> x)\n"
+                           "{\n"
+                           "    <COMPUTE_TYPE> oneOverX = " + one + "/x;\n"
+                           "\n"
+                           "    return " + mNapierianLogarithmString + "(oneOverX+" + mSquareRootString + "(oneOverX*oneOverX-" + one + "));\n"
+                           "}\n";
+    mAcschFunctionString = "<COMPUTE_TYPE> acsch(<COMPUTE_TYPE> x)\n"
+                           "{\n"
+                           "    <COMPUTE_TYPE> oneOverX = " + one + "/x;\n"
+                           "\n"
+                           "    return " + mNapierianLogarithmString + "(oneOverX+" + mSquareRootString + "(oneOverX*oneOverX+" + one + "));\n"
+                           "}\n";
+    mAcothFunctionString = "<COMPUTE_TYPE> acoth(<COMPUTE_TYPE> x)\n"
+                           "{\n"
+                           "    <COMPUTE_TYPE> oneOverX = " + one + "/x;\n"
+                           "\n"
+                           "    return " + half + "*" + mNapierianLogarithmString + "((" + one + "+oneOverX)/(" + one + "-oneOverX));\n"
+                           "}\n";
 }
 
 GeneratorProfile::GeneratorProfile(Profile profile)
@@ -882,6 +1206,16 @@ void GeneratorProfile::setProfile(Profile profile)
     mPimpl->loadProfile(profile);
 }
 
+GeneratorProfile::Precision GeneratorProfile::computePrecision() const
+{
+    return mPimpl->mComputePrecision;
+}
+
+void GeneratorProfile::setComputePrecision(Precision precision)
+{
+    mPimpl->loadComputePrecision(precision);
+}
+
 bool GeneratorProfile::hasInterface() const
 {
     return mPimpl->mHasInterface;
@@ -1982,6 +2316,46 @@ void GeneratorProfile::setImplementationVariableCountString(const std::string &i
     mPimpl->mImplementationVariableCountString = implementationVariableCountString;
 }
 
+std::string GeneratorProfile::interfaceRootCountString() const
+{
+    return mPimpl->mInterfaceRootCountString;
+}
+
+void GeneratorProfile::setInterfaceRootCountString(const std::string &interfaceRootCountString)
+{
+    mPimpl->mInterfaceRootCountString = interfaceRootCountString;
+}
+
+std::string GeneratorProfile::implementationRootCountString() const
+{
+    return mPimpl->mImplementationRootCountString;
+}
+
+void GeneratorProfile::setImplementationRootCountString(const std::string &implementationRootCountString)
+{
+    mPimpl->mImplementationRootCountString = implementationRootCountString;
+}
+
+std::string GeneratorProfile::interfaceModelInstanceTypeString() const
+{
+    return mPimpl->mInterfaceModelInstanceTypeString;
+}
+
+void GeneratorProfile::setInterfaceModelInstanceTypeString(const std::string &interfaceModelInstanceTypeString)
+{
+    mPimpl->mInterfaceModelInstanceTypeString = interfaceModelInstanceTypeString;
+}
+
+std::string GeneratorProfile::implementationModelInstanceTypeString() const
+{
+    return mPimpl->mImplementationModelInstanceTypeString;
+}
+
+void GeneratorProfile::setImplementationModelInstanceTypeString(const std::string &implementationModelInstanceTypeString)
+{
+    mPimpl->mImplementationModelInstanceTypeString = implementationModelInstanceTypeString;
+}
+
 std::string GeneratorProfile::variableTypeObjectString() const
 {
     return mPimpl->mVariableTypeObjectString;
@@ -2162,6 +2536,86 @@ void GeneratorProfile::setVariablesArrayString(const std::string &variablesArray
     mPimpl->mVariablesArrayString = variablesArrayString;
 }
 
+std::string GeneratorProfile::rootsArrayString() const
+{
+    return mPimpl->mRootsArrayString;
+}
+
+void GeneratorProfile::setRootsArrayString(const std::string &rootsArrayString)
+{
+    mPimpl->mRootsArrayString = rootsArrayString;
+}
+
+std::string GeneratorProfile::rootsFoundArrayString() const
+{
+    return mPimpl->mRootsFoundArrayString;
+}
+
+void GeneratorProfile::setRootsFoundArrayString(const std::string &rootsFoundArrayString)
+{
+    mPimpl->mRootsFoundArrayString = rootsFoundArrayString;
+}
+
+std::string GeneratorProfile::resetValueDeclarationString() const
+{
+    return mPimpl->mResetValueDeclarationString;
+}
+
+void GeneratorProfile::setResetValueDeclarationString(const std::string &resetValueDeclarationString)
+{
+    mPimpl->mResetValueDeclarationString = resetValueDeclarationString;
+}
+
+std::string GeneratorProfile::resetValueString() const
+{
+    return mPimpl->mResetValueString;
+}
+
+void GeneratorProfile::setResetValueString(const std::string &resetValueString)
+{
+    mPimpl->mResetValueString = resetValueString;
+}
+
+std::string GeneratorProfile::statesTypeString() const
+{
+    return mPimpl->mStatesTypeString;
+}
+
+void GeneratorProfile::setStatesTypeString(const std::string &statesTypeString)
+{
+    mPimpl->mStatesTypeString = statesTypeString;
+}
+
+std::string GeneratorProfile::variablesTypeString() const
+{
+    return mPimpl->mVariablesTypeString;
+}
+
+void GeneratorProfile::setVariablesTypeString(const std::string &variablesTypeString)
+{
+    mPimpl->mVariablesTypeString = variablesTypeString;
+}
+
+std::string GeneratorProfile::computeTypeString() const
+{
+    return mPimpl->mComputeTypeString;
+}
+
+void GeneratorProfile::setComputeTypeString(const std::string &computeTypeString)
+{
+    mPimpl->mComputeTypeString = computeTypeString;
+}
+
+std::string GeneratorProfile::numberSuffixString() const
+{
+    return mPimpl->mNumberSuffixString;
+}
+
+void GeneratorProfile::setNumberSuffixString(const std::string &numberSuffixString)
+{
+    mPimpl->mNumberSuffixString = numberSuffixString;
+}
+
 std::string GeneratorProfile::returnCreatedArrayString() const
 {
     return mPimpl->mReturnCreatedArrayString;
@@ -2312,6 +2766,46 @@ void GeneratorProfile::setImplementationComputeVariablesMethodString(const std::
     mPimpl->mImplementationComputeVariablesMethodString = implementationComputeVariablesMethodString;
 }
 
+std::string GeneratorProfile::interfaceComputeRootsMethodString() const
+{
+    return mPimpl->mInterfaceComputeRootsMethodString;
+}
+
+void GeneratorProfile::setInterfaceComputeRootsMethodString(const std::string &interfaceComputeRootsMethodString)
+{
+    mPimpl->mInterfaceComputeRootsMethodString = interfaceComputeRootsMethodString;
+}
+
+std::string GeneratorProfile::implementationComputeRootsMethodString() const
+{
+    return mPimpl->mImplementationComputeRootsMethodString;
+}
+
+void GeneratorProfile::setImplementationComputeRootsMethodString(const std::string &implementationComputeRootsMethodString)
+{
+    mPimpl->mImplementationComputeRootsMethodString = implementationComputeRootsMethodString;
+}
+
+std::string GeneratorProfile::interfaceApplyResetsMethodString() const
+{
+    return mPimpl->mInterfaceApplyResetsMethodString;
+}
+
+void GeneratorProfile::setInterfaceApplyResetsMethodString(const std::string &interfaceApplyResetsMethodString)
+{
+    mPimpl->mInterfaceApplyResetsMethodString = interfaceApplyResetsMethodString;
+}
+
+std::string GeneratorProfile::implementationApplyResetsMethodString() const
+{
+    return mPimpl->mImplementationApplyResetsMethodString;
+}
+
+void GeneratorProfile::setImplementationApplyResetsMethodString(const std::string &implementationApplyResetsMethodString)
+{
+    mPimpl->mImplementationApplyResetsMethodString = implementationApplyResetsMethodString;
+}
+
 std::string GeneratorProfile::emptyMethodString() const
 {
     return mPimpl->mEmptyMethodString;
@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "libcellml/importedentity.h"
 
+#include "libcellml/entity.h"
+
 namespace libcellml {
 
 /**
@@ -54,6 +56,7 @@ ImportSourcePtr ImportedEntity::importSource() const
 void ImportedEntity::setImportSource(const ImportSourcePtr &importSource)
 {
     mPimpl->mImportSource = importSource;
+    importModified();
 }
 
 std::string ImportedEntity::importReference() const
@@ -64,6 +67,15 @@ std::string ImportedEntity::importReference() const
 void ImportedEntity::setImportReference(const std::string &reference)
 {
     mPimpl->mImportReference = reference;
+    importModified();
+}
+
+void ImportedEntity::importModified()
+{
+    auto entity = dynamic_cast<Entity *>(this);
+    if (entity != nullptr) {
+        entity->markAsModified();
+    }
 }
 
 } // namespace libcellml
@@ -0,0 +1,262 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/importlibrary.h"
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "libcellml/component.h"
+#include "libcellml/importresolver.h"
+#include "libcellml/importsource.h"
+#include "libcellml/model.h"
+#include "libcellml/parser.h"
+#include "libcellml/units.h"
+
+#include "workqueue.h"
+
+namespace libcellml {
+
+/**
+ * @brief The ImportLibrary::ImportLibraryImpl struct.
+ *
+ * The private implementation for the ImportLibrary class.
+ */
+struct ImportLibrary::ImportLibraryImpl
+{
+    std::map<std::string, ModelPtr> mModels; /**< The models, indexed by their location. */
+    ImportResolverPtr mImportResolver = ImportResolver::create(); /**< The import resolver used to fetch documents. */
+    size_t mThreadCount = 1; /**< The maximum number of threads used to fetch and parse documents. */
+
+    ModelPtr fetchModel(const ParserPtr &parser, const std::string &location) const;
+    void resolveImports(const ModelPtr &model, const std::string &baseFile);
+};
+
+/**
+ * @brief The PendingImport struct.
+ *
+ * An import source which has yet to be given its model, together with the
+ * location of the document it refers to.
+ */
+struct PendingImport
+{
+    ImportSourcePtr mImportSource; /**< The import source. */
+    std::string mLocation; /**< The location of the imported document. */
+};
+
+static void findPendingImport(const ImportedEntityPtr &importedEntity,
+                              const std::string &baseFile,
+                              const ImportResolverPtr &importResolver,
+                              std::vector<PendingImport> &pendingImports)
+{
+    if (importedEntity->isImport()) {
+        ImportSourcePtr importSource = importedEntity->importSource();
+        if (!importSource->hasModel()) {
+            pendingImports.push_back({importSource, importResolver->location(importSource->url(), baseFile)});
+        }
+    }
+}
+
+static void findPendingComponentImports(const ComponentEntityPtr &parentComponentEntity,
+                                        const std::string &baseFile,
+                                        const ImportResolverPtr &importResolver,
+                                        std::vector<PendingImport> &pendingImports)
+{
+    for (size_t n = 0; n < parentComponentEntity->componentCount(); ++n) {
+        ComponentPtr component = parentComponentEntity->component(n);
+        if (component->isImport()) {
+            findPendingImport(component, baseFile, importResolver, pendingImports);
+        } else {
+            findPendingComponentImports(component, baseFile, importResolver, pendingImports);
+        }
+    }
+}
+
+/**
+ * @brief Find the imports of the given @p model which have yet to be resolved.
+ *
+ * Find the imports of the given @p model which have yet to be resolved, in
+ * the order in which they used to be resolved one at a time, i.e. units
+ * first and then components, depth first.
+ *
+ * @param model The @c ModelPtr whose imports are to be found.
+ * @param baseFile The @c std::string location of @p model.
+ * @param importResolver The @c ImportResolverPtr used to locate the
+ * imported documents.
+ * @param pendingImports The pending imports to which those of @p model are
+ * appended.
+ */
+static void findPendingImports(const ModelPtr &model,
+                               const std::string &baseFile,
+                               const ImportResolverPtr &importResolver,
+                               std::vector<PendingImport> &pendingImports)
+{
+    for (size_t n = 0; n < model->unitsCount(); ++n) {
+        findPendingImport(model->units(n), baseFile, importResolver, pendingImports);
+    }
+    findPendingComponentImports(model, baseFile, importResolver, pendingImports);
+}
+
+ModelPtr ImportLibrary::ImportLibraryImpl::fetchModel(const ParserPtr &parser, const std::string &location) const
+{
+    auto buffer = mImportResolver->fetch(location);
+    if (!buffer.found) {
+        return nullptr;
+    }
+    return parser->parseModel(buffer.data, buffer.size);
+}
+
+void ImportLibrary::ImportLibraryImpl::resolveImports(const ModelPtr &model, const std::string &baseFile)
+{
+    std::vector<PendingImport> pendingImports;
+    std::set<std::string> missingLocations;
+
+    findPendingImports(model, baseFile, mImportResolver, pendingImports);
+
+    while (!pendingImports.empty()) {
+        // Fetch and parse, concurrently, the documents imported at this level
+        // of the import graph which are not yet in the library. A document
+        // which is already in the library, including one that is still having
+        // its imports resolved, is never fetched again, which is what breaks
+        // import cycles.
+
+        std::vector<std::string> locations;
+        std::set<std::string> newLocations;
+        for (const auto &pendingImport : pendingImports) {
+            if ((mModels.count(pendingImport.mLocation) == 0)
+                && (missingLocations.count(pendingImport.mLocation) == 0)
+                && newLocations.insert(pendingImport.mLocation).second) {
+                locations.push_back(pendingImport.mLocation);
+            }
+        }
+
+        std::vector<ModelPtr> newModels(locations.size());
+        std::vector<ParserPtr> parsers(concurrentWorkerCount(locations.size(), mThreadCount));
+        for (auto &parser : parsers) {
+            parser = Parser::create();
+        }
+        runConcurrently(locations.size(), parsers.size(), [&](size_t worker, size_t index) {
+            newModels.at(index) = fetchModel(parsers.at(worker), locations.at(index));
+        });
+
+        for (size_t i = 0; i < locations.size(); ++i) {
+            if (newModels.at(i) == nullptr) {
+                missingLocations.insert(locations.at(i));
+            } else {
+                mModels.emplace(locations.at(i), newModels.at(i));
+            }
+        }
+
+        // Give import sources their model, in the order in which they were
+        // found, and move on to the imports of the models that we have just
+        // parsed.
+
+        for (const auto &pendingImport : pendingImports) {
+            auto found = mModels.find(pendingImport.mLocation);
+            if ((found != mModels.end()) && !pendingImport.mImportSource->hasModel()) {
+                pendingImport.mImportSource->setModel(found->second);
+            }
+        }
+
+        pendingImports.clear();
+        for (size_t i = 0; i < locations.size(); ++i) {
+            if (newModels.at(i) != nullptr) {
+                findPendingImports(newModels.at(i), locations.at(i), mImportResolver, pendingImports);
+            }
+        }
+    }
+}
+
+ImportLibrary::ImportLibrary()
+    : mPimpl(new ImportLibraryImpl())
+{
+}
+
+ImportLibrary::~ImportLibrary()
+{
+    delete mPimpl;
+}
+
+ImportLibraryPtr ImportLibrary::create() noexcept
+{
+    return std::shared_ptr<ImportLibrary> {new ImportLibrary {}};
+}
+
+void ImportLibrary::resolveImports(const ModelPtr &model, const std::string &baseFile)
+{
+    mPimpl->resolveImports(model, baseFile);
+}
+
+ModelPtr ImportLibrary::model(const std::string &url)
+{
+    std::string location = mPimpl->mImportResolver->location(url, "");
+    auto found = mPimpl->mModels.find(location);
+
+    if (found != mPimpl->mModels.end()) {
+        return found->second;
+    }
+
+    ModelPtr model = mPimpl->fetchModel(Parser::create(), location);
+
+    if (model != nullptr) {
+        // Add the model to the library before resolving its imports, so that
+        // a model which ends up importing itself gets resolved to itself
+        // rather than fetched over and over again.
+
+        mPimpl->mModels.emplace(location, model);
+        mPimpl->resolveImports(model, location);
+    }
+
+    return model;
+}
+
+bool ImportLibrary::hasModel(const std::string &url) const
+{
+    return mPimpl->mModels.count(mPimpl->mImportResolver->location(url, "")) != 0;
+}
+
+size_t ImportLibrary::modelCount() const
+{
+    return mPimpl->mModels.size();
+}
+
+void ImportLibrary::removeAllModels()
+{
+    mPimpl->mModels.clear();
+}
+
+void ImportLibrary::setImportResolver(const ImportResolverPtr &importResolver)
+{
+    mPimpl->mImportResolver = (importResolver != nullptr) ? importResolver : ImportResolver::create();
+}
+
+ImportResolverPtr ImportLibrary::importResolver() const
+{
+    return mPimpl->mImportResolver;
+}
+
+void ImportLibrary::setThreadCount(size_t threads)
+{
+    mPimpl->mThreadCount = threads;
+}
+
+size_t ImportLibrary::threadCount() const
+{
+    return mPimpl->mThreadCount;
+}
+
+} // namespace libcellml
@@ -0,0 +1,86 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "libcellml/importresolver.h"
+
+#include <cstdlib>
+
+#include "mappedfile.h"
+
+namespace libcellml {
+
+/**
+ * @brief Get the canonical form of the given @p path.
+ *
+ * Get the absolute form of the given @p path with any symbolic link and
+ * any @c . or @c .. component resolved. If this is not possible, e.g.
+ * because the file does not exist, then @p path is returned as is.
+ *
+ * @param path The @c std::string path to canonicalise.
+ *
+ * @return The canonical form of @p path.
+ */
+static std::string canonicalPath(const std::string &path)
+{
+#ifdef _WIN32
+    char *canonicalPath = _fullpath(nullptr, path.c_str(), 0);
+#else
+    char *canonicalPath = realpath(path.c_str(), nullptr);
+#endif
+
+    if (canonicalPath == nullptr) {
+        return path;
+    }
+
+    std::string res = canonicalPath;
+
+    free(canonicalPath);
+
+    return res;
+}
+
+ImportResolver::ImportResolver() = default;
+
+ImportResolver::~ImportResolver() = default;
+
+ImportResolverPtr ImportResolver::create() noexcept
+{
+    return std::shared_ptr<ImportResolver> {new ImportResolver {}};
+}
+
+std::string ImportResolver::location(const std::string &url, const std::string &base) const
+{
+    // We can be naive here as we know what we are dealing with.
+
+    return canonicalPath(base.substr(0, base.find_last_of('/') + 1) + url);
+}
+
+ImportResolver::Buffer ImportResolver::fetch(const std::string &location) const
+{
+    Buffer res;
+    auto file = std::make_shared<MappedFile>(location);
+
+    if (file->isValid()) {
+        res.found = true;
+        res.data = file->data();
+        res.size = file->size();
+        res.owner = file;
+    }
+
+    return res;
+}
+
+} // namespace libcellml
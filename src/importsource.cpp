@@ -54,6 +54,7 @@ std::string ImportSource::url() const
 void ImportSource::setUrl(const std::string &url)
 {
     mPimpl->mUrl = url;
+    markAsModified();
 }
 
 ModelPtr ImportSource::model() const
@@ -64,6 +65,7 @@ ModelPtr ImportSource::model() const
 void ImportSource::setModel(const ModelPtr &model)
 {
     mPimpl->mModel = model;
+    markAsModified();
 }
 
 bool ImportSource::hasModel() const
@@ -17,6 +17,7 @@ limitations under the License.
 #pragma once
 
 #include <map>
+#include <unordered_map>
 #include <vector>
 
 #include "libcellml/types.h"
@@ -25,7 +26,8 @@ namespace libcellml {
 
 using IndexStack = std::vector<size_t>; /**< Type definition for tracking indicies. */
 using EquivalenceMap = std::map<IndexStack, std::vector<IndexStack>>; /**< Type definition for map of variable equivalences defined over model. */
-using NameList = std::vector<std::string>; /**< Type definition for list of names. */
 using ComponentNameMap = std::map<std::string, ComponentPtr>; /**< Type definition for map of component name to component pointer. */
+using UnitsCopyMap = std::unordered_map<const Units *, UnitsPtr>; /**< Type definition for map of units to their copy. */
+using VariableCopyMap = std::unordered_map<const Variable *, VariablePtr>; /**< Type definition for map of variable to its copy. */
 
 } // namespace libcellml
@@ -0,0 +1,109 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "mappedfile.h"
+
+#ifdef _WIN32
+#    define NOMINMAX
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace libcellml {
+
+MappedFile::MappedFile(const std::string &path)
+{
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    mFile = file;
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) == 0) {
+        return;
+    }
+    mSize = size_t(size.QuadPart);
+    mValid = true;
+    if (mSize > 0) {
+        mMapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mMapping != nullptr) {
+            mData = static_cast<const char *>(MapViewOfFile(mMapping, FILE_MAP_READ, 0, 0, 0));
+        }
+        mValid = mData != nullptr;
+    }
+#else
+    int file = open(path.c_str(), O_RDONLY);
+    if (file == -1) {
+        return;
+    }
+    struct stat info = {};
+    if ((fstat(file, &info) == 0) && S_ISREG(info.st_mode)) {
+        mSize = size_t(info.st_size);
+        mValid = true;
+        if (mSize > 0) {
+            void *data = mmap(nullptr, mSize, PROT_READ, MAP_PRIVATE, file, 0);
+            if (data != MAP_FAILED) {
+                mData = static_cast<const char *>(data);
+            } else {
+                mValid = false;
+            }
+        }
+    }
+    // The mapping remains valid once the file is closed.
+    close(file);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef _WIN32
+    if (mData != nullptr) {
+        UnmapViewOfFile(mData);
+    }
+    if (mMapping != nullptr) {
+        CloseHandle(mMapping);
+    }
+    if (mFile != nullptr) {
+        CloseHandle(mFile);
+    }
+#else
+    if (mData != nullptr) {
+        munmap(const_cast<char *>(mData), mSize);
+    }
+#endif
+}
+
+bool MappedFile::isValid() const
+{
+    return mValid;
+}
+
+const char *MappedFile::data() const
+{
+    return mData;
+}
+
+size_t MappedFile::size() const
+{
+    return mSize;
+}
+
+} // namespace libcellml
@@ -0,0 +1,76 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+namespace libcellml {
+
+/**
+ * @brief The MappedFile class.
+ *
+ * A read-only view of the contents of a file, which is memory mapped rather
+ * than read, so that it can be parsed without being copied. An empty file is
+ * valid, but has no data.
+ */
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string &path); /**< Constructor */
+    ~MappedFile(); /**< Destructor */
+    MappedFile(const MappedFile &rhs) = delete; /**< Copy constructor */
+    MappedFile &operator=(const MappedFile &rhs) = delete; /**< Assignment operator */
+
+    /**
+     * @brief Test whether the file could be mapped.
+     *
+     * Test whether the file could be opened and, unless it is empty, mapped.
+     *
+     * @return @c true if the file could be mapped, @c false otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * @brief Get the contents of the file.
+     *
+     * Get the contents of the file, which are not null terminated.
+     *
+     * @return The contents of the file, or @c nullptr if the file is empty or
+     * could not be mapped.
+     */
+    const char *data() const;
+
+    /**
+     * @brief Get the size of the file.
+     *
+     * Get the size of the file.
+     *
+     * @return The size of the file.
+     */
+    size_t size() const;
+
+private:
+#ifdef _WIN32
+    void *mFile = nullptr; /**< The handle of the file. */
+    void *mMapping = nullptr; /**< The handle of the file mapping. */
+#endif
+    const char *mData = nullptr; /**< The contents of the file. */
+    size_t mSize = 0; /**< The size of the file. */
+    bool mValid = false; /**< Whether the file could be mapped. */
+};
+
+} // namespace libcellml
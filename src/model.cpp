@@ -17,20 +17,21 @@ limitations under the License.
 #include "libcellml/model.h"
 
 #include <algorithm>
-#include <fstream>
 #include <map>
-#include <sstream>
 #include <stack>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "libcellml/component.h"
+#include "libcellml/importlibrary.h"
 #include "libcellml/importsource.h"
-#include "libcellml/parser.h"
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
 
 #include "internaltypes.h"
+#include "nameindex.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -45,6 +46,7 @@ namespace libcellml {
 struct Model::ModelImpl
 {
     std::vector<UnitsPtr> mUnits;
+    NameIndex<Units> mUnitsIndex;
 
     std::vector<UnitsPtr>::iterator findUnits(const std::string &name);
     std::vector<UnitsPtr>::iterator findUnits(const UnitsPtr &units);
@@ -52,8 +54,7 @@ struct Model::ModelImpl
 
 std::vector<UnitsPtr>::iterator Model::ModelImpl::findUnits(const std::string &name)
 {
-    return std::find_if(mUnits.begin(), mUnits.end(),
-                        [=](const UnitsPtr &u) -> bool { return u->name() == name; });
+    return mUnitsIndex.find(mUnits, name);
 }
 
 std::vector<UnitsPtr>::iterator Model::ModelImpl::findUnits(const UnitsPtr &units)
@@ -98,10 +99,22 @@ bool Model::doAddComponent(const ComponentPtr &component)
     return ComponentEntity::doAddComponent(component);
 }
 
+void Model::invalidateNameIndices()
+{
+    ComponentEntity::invalidateNameIndices();
+    mPimpl->mUnitsIndex.invalidate();
+}
+
 void Model::addUnits(const UnitsPtr &units)
 {
+    auto owner = std::dynamic_pointer_cast<Model>(units->parent());
+    if (owner != nullptr) {
+        owner->removeUnits(units);
+    }
     mPimpl->mUnits.push_back(units);
+    mPimpl->mUnitsIndex.append(mPimpl->mUnits);
     units->setParent(shared_from_this());
+    markAsModified();
 }
 
 bool Model::removeUnits(size_t index)
@@ -111,6 +124,8 @@ bool Model::removeUnits(size_t index)
         auto units = *(mPimpl->mUnits.begin() + int64_t(index));
         units->removeParent();
         mPimpl->mUnits.erase(mPimpl->mUnits.begin() + int64_t(index));
+        mPimpl->mUnitsIndex.erase(mPimpl->mUnits, units);
+        markAsModified();
         status = true;
     }
 
@@ -122,8 +137,11 @@ bool Model::removeUnits(const std::string &name)
     bool status = false;
     auto result = mPimpl->findUnits(name);
     if (result != mPimpl->mUnits.end()) {
-        (*result)->removeParent();
+        UnitsPtr units = *result;
+        units->removeParent();
         mPimpl->mUnits.erase(result);
+        mPimpl->mUnitsIndex.erase(mPimpl->mUnits, units);
+        markAsModified();
         status = true;
     }
 
@@ -135,8 +153,11 @@ bool Model::removeUnits(const UnitsPtr &units)
     bool status = false;
     auto result = mPimpl->findUnits(units);
     if (result != mPimpl->mUnits.end()) {
+        UnitsPtr erasedUnits = *result;
         units->removeParent();
         mPimpl->mUnits.erase(result);
+        mPimpl->mUnitsIndex.erase(mPimpl->mUnits, erasedUnits);
+        markAsModified();
         status = true;
     }
 
@@ -146,11 +167,13 @@ bool Model::removeUnits(const UnitsPtr &units)
 void Model::removeAllUnits()
 {
     mPimpl->mUnits.clear();
+    mPimpl->mUnitsIndex.invalidate();
+    markAsModified();
 }
 
 bool Model::hasUnits(const std::string &name) const
 {
-    return mPimpl->findUnits(name) != mPimpl->mUnits.end();
+    return mPimpl->mUnitsIndex.item(mPimpl->mUnits, name) != nullptr;
 }
 
 bool Model::hasUnits(const UnitsPtr &units) const
@@ -170,13 +193,7 @@ UnitsPtr Model::units(size_t index) const
 
 UnitsPtr Model::units(const std::string &name) const
 {
-    UnitsPtr units = nullptr;
-    auto result = mPimpl->findUnits(name);
-    if (result != mPimpl->mUnits.end()) {
-        units = *result;
-    }
-
-    return units;
+    return mPimpl->mUnitsIndex.item(mPimpl->mUnits, name);
 }
 
 UnitsPtr Model::takeUnits(size_t index)
@@ -201,6 +218,9 @@ bool Model::replaceUnits(size_t index, const UnitsPtr &units)
     bool status = false;
     if (removeUnits(index)) {
         mPimpl->mUnits.insert(mPimpl->mUnits.begin() + int64_t(index), units);
+        mPimpl->mUnitsIndex.invalidate();
+        units->setParent(shared_from_this());
+        markAsModified();
         status = true;
     }
 
@@ -294,66 +314,22 @@ bool Model::hasUnlinkedUnits()
     return unlinkedUnits;
 }
 
-/**
- * @brief Resolve the path of the given filename using the given base.
- *
- * Resolves the full path to the given @p filename using the @p base.
- *
- * This function is only intended to work with local files.  It may not
- * work with bases that use the 'file://' prefix.
- *
- * @param filename The @c std::string relative path from the base path.
- * @param base The @c std::string location on local disk for determining the full path from.
- *
- * @return The full path from the @p base location to the @p filename
- */
-std::string resolvePath(const std::string &filename, const std::string &base)
+void Model::resolveImports(const std::string &baseFile)
 {
-    // We can be naive here as we know what we are dealing with
-    std::string path = base.substr(0, base.find_last_of('/') + 1) + filename;
-    return path;
+    resolveImports(baseFile, ImportLibrary::create());
 }
 
-void resolveImport(const ImportedEntityPtr &importedEntity,
-                   const std::string &baseFile)
+void Model::resolveImports(const std::string &baseFile, const ImportLibraryPtr &importLibrary)
 {
-    if (importedEntity->isImport()) {
-        ImportSourcePtr importSource = importedEntity->importSource();
-        if (!importSource->hasModel()) {
-            std::string url = resolvePath(importSource->url(), baseFile);
-            std::ifstream file(url);
-            if (file.good()) {
-                std::stringstream buffer;
-                buffer << file.rdbuf();
-                ParserPtr parser = Parser::create();
-                ModelPtr model = parser->parseModel(buffer.str());
-                importSource->setModel(model);
-                model->resolveImports(url);
-            }
-        }
-    }
+    importLibrary->resolveImports(shared_from_this(), baseFile);
 }
 
-void resolveComponentImports(const ComponentEntityPtr &parentComponentEntity,
-                             const std::string &baseFile)
+void Model::resolveImports(const std::string &baseFile, const ImportResolverPtr &importResolver)
 {
-    for (size_t n = 0; n < parentComponentEntity->componentCount(); ++n) {
-        libcellml::ComponentPtr component = parentComponentEntity->component(n);
-        if (component->isImport()) {
-            resolveImport(component, baseFile);
-        } else {
-            resolveComponentImports(component, baseFile);
-        }
-    }
-}
+    ImportLibraryPtr importLibrary = ImportLibrary::create();
 
-void Model::resolveImports(const std::string &baseFile)
-{
-    for (size_t n = 0; n < unitsCount(); ++n) {
-        libcellml::UnitsPtr units = Model::units(n);
-        resolveImport(units, baseFile);
-    }
-    resolveComponentImports(shared_from_this(), baseFile);
+    importLibrary->setImportResolver(importResolver);
+    importLibrary->resolveImports(shared_from_this(), baseFile);
 }
 
 bool isUnresolvedImport(const ImportedEntityPtr &importedEntity)
@@ -447,100 +423,100 @@ bool Model::hasImports() const
     return importsPresent;
 }
 
-size_t getComponentIndexInComponentEntity(const ComponentEntityPtr &componentParent, const ComponentEntityPtr &component)
+/**
+ * @brief The ComponentNames struct.
+ *
+ * The component names in use in a model that is being flattened, together
+ * with the suffix from which to look for a unique version of a given name.
+ */
+struct ComponentNames
 {
-    size_t index = 0;
-    bool found = false;
-    while (index < componentParent->componentCount() && !found) {
-        if (componentParent->component(index) == component) {
-            found = true;
-        } else {
-            ++index;
-        }
-    }
+    std::unordered_set<std::string> mNames; /**< The component names in use. */
+    std::unordered_map<std::string, size_t> mSuffixes; /**< The next suffix to try for a given name. */
 
-    return index;
-}
+    std::string uniqueName(const std::string &name);
+};
 
-IndexStack reverseEngineerIndexStack(const VariablePtr &variable)
+std::string ComponentNames::uniqueName(const std::string &name)
 {
-    IndexStack indexStack;
-    ComponentPtr component = std::dynamic_pointer_cast<Component>(variable->parent());
-    indexStack.push_back(getVariableIndexInComponent(component, variable));
-
-    ComponentEntityPtr parent = component;
-    ComponentEntityPtr grandParent = std::dynamic_pointer_cast<ComponentEntity>(parent->parent());
-    while (grandParent != nullptr) {
-        indexStack.push_back(getComponentIndexInComponentEntity(grandParent, parent));
-        parent = grandParent;
-        grandParent = std::dynamic_pointer_cast<ComponentEntity>(grandParent->parent());
+    if (mNames.count(name) == 0) {
+        return name;
     }
 
-    std::reverse(std::begin(indexStack), std::end(indexStack));
+    // Names are never given up, so there is no need to try again the suffixes
+    // that we have already tried for the given name.
 
-    return indexStack;
-}
+    size_t &suffix = mSuffixes[name];
+    std::string res;
 
-void recordVariableEquivalences(const ComponentPtr &component, EquivalenceMap &equivalenceMap, IndexStack &indexStack)
-{
-    for (size_t index = 0; index < component->variableCount(); ++index) {
-        auto variable = component->variable(index);
-        for (size_t j = 0; j < variable->equivalentVariableCount(); ++j) {
-            if (j == 0) {
-                indexStack.push_back(index);
-            }
-            auto equivalentVariable = variable->equivalentVariable(j);
-            auto equivalentVariableIndexStack = reverseEngineerIndexStack(equivalentVariable);
-            if (equivalenceMap.count(indexStack) == 0) {
-                equivalenceMap[indexStack] = std::vector<IndexStack>();
-            }
-            equivalenceMap[indexStack].push_back(equivalentVariableIndexStack);
-        }
-        if (variable->equivalentVariableCount() > 0) {
-            indexStack.pop_back();
-        }
-    }
+    do {
+        res = name + "_" + convertToString(++suffix);
+    } while (mNames.count(res) != 0);
+
+    return res;
 }
 
-void generateEquivalenceMap(const ComponentPtr &component, EquivalenceMap &map, IndexStack &indexStack)
+using ComponentImport = std::pair<ComponentEntityPtr, size_t>; /**< Type definition for an imported component, as its parent and its index in it. */
+
+void addComponentNames(const ComponentPtr &component, ComponentNames &componentNames)
 {
+    componentNames.mNames.insert(component->name());
     for (size_t index = 0; index < component->componentCount(); ++index) {
-        indexStack.push_back(index);
-        auto c = component->component(index);
-        recordVariableEquivalences(c, map, indexStack);
-        generateEquivalenceMap(c, map, indexStack);
-        indexStack.pop_back();
+        addComponentNames(component->component(index), componentNames);
     }
 }
 
-VariablePtr getVariableLocatedAt(const IndexStack &stack, const ModelPtr &model)
+void findComponentImports(const ComponentEntityPtr &parent, std::vector<ComponentImport> &componentImports)
 {
-    ComponentPtr component;
-    for (size_t index = 0; index < stack.size() - 1; ++index) {
-        if (index == 0) {
-            component = model->component(stack.at(index));
+    for (size_t index = 0; index < parent->componentCount(); ++index) {
+        auto c = parent->component(index);
+        if (c->isImport()) {
+            componentImports.emplace_back(parent, index);
         } else {
-            component = component->component(stack.at(index));
+            findComponentImports(c, componentImports);
         }
     }
-
-    return component->variable(stack.back());
 }
 
-void makeEquivalence(const IndexStack &stack1, const IndexStack &stack2, const ModelPtr &model)
+ComponentNameMap createComponentNamesMap(const ComponentPtr &component)
 {
-    auto v1 = getVariableLocatedAt(stack1, model);
-    auto v2 = getVariableLocatedAt(stack2, model);
-    Variable::addEquivalence(v1, v2);
+    ComponentNameMap nameMap;
+    for (size_t index = 0; index < component->componentCount(); ++index) {
+        auto c = component->component(index);
+        nameMap[c->name()] = c;
+        ComponentNameMap childrenNameMap = createComponentNamesMap(c);
+        nameMap.insert(childrenNameMap.begin(), childrenNameMap.end());
+    }
+
+    return nameMap;
 }
 
-void applyEquivalenceMapToModel(const EquivalenceMap &map, const ModelPtr &model)
+void copyVariableEquivalences(const ComponentPtr &component, const VariableCopyMap &variableCopies, bool withIds)
 {
-    for (const auto &iter : map) {
-        auto key = iter.first;
-        auto vector = iter.second;
-        for (auto vectorIter = vector.begin(); vectorIter < vector.end(); ++vectorIter) {
-            makeEquivalence(key, *vectorIter, model);
+    // Visit the variables and encapsulated components in the order in which
+    // they used to be visited, i.e. the order of their index stacks, so that
+    // the order of the equivalences, and therefore of the connections when the
+    // model is serialised, does not change.
+
+    size_t count = std::max(component->variableCount(), component->componentCount());
+    for (size_t index = 0; index < count; ++index) {
+        auto variable = component->variable(index);
+        if (variable != nullptr) {
+            auto variableCopy = variableCopies.at(variable.get());
+            for (size_t j = 0; j < variable->equivalentVariableCount(); ++j) {
+                auto equivalentVariableCopy = variableCopies.find(variable->equivalentVariable(j).get());
+                if ((equivalentVariableCopy != variableCopies.end()) && withIds) {
+                    auto equivalentVariable = variable->equivalentVariable(j);
+                    Variable::addEquivalence(variableCopy, equivalentVariableCopy->second,
+                                             Variable::equivalenceMappingId(variable, equivalentVariable),
+                                             Variable::equivalenceConnectionId(variable, equivalentVariable));
+                } else if (equivalentVariableCopy != variableCopies.end()) {
+                    Variable::addEquivalence(variableCopy, equivalentVariableCopy->second);
+                }
+            }
+        }
+        if (index < component->componentCount()) {
+            copyVariableEquivalences(component->component(index), variableCopies, withIds);
         }
     }
 }
@@ -554,205 +530,166 @@ ModelPtr Model::clone() const
 
     m->setEncapsulationId(encapsulationId());
 
-    for (size_t index = 0; index < mPimpl->mUnits.size(); ++index) {
-        m->addUnits(units(index)->clone());
+    // Clone the units and components, keeping track of the copy of each units
+    // and variable, so that the variables of the clone use the units of the
+    // clone and their equivalences can be rewired in a single pass.
+
+    UnitsCopyMap unitsCopies;
+    VariableCopyMap variableCopies;
+
+    unitsCopies.reserve(mPimpl->mUnits.size());
+    for (const auto &u : mPimpl->mUnits) {
+        auto uClone = u->clone();
+        m->addUnits(uClone);
+        unitsCopies.emplace(u.get(), uClone);
     }
 
     for (size_t index = 0; index < componentCount(); ++index) {
-        m->addComponent(component(index)->clone());
+        m->addComponent(cloneComponent(*component(index), unitsCopies, variableCopies));
     }
 
-    // Generate equivalence map starting from the models components.
-    EquivalenceMap map;
-    IndexStack indexStack;
     for (size_t index = 0; index < componentCount(); ++index) {
-        indexStack.push_back(index);
-        auto c = component(index);
-        recordVariableEquivalences(c, map, indexStack);
-        generateEquivalenceMap(c, map, indexStack);
-        indexStack.pop_back();
+        copyVariableEquivalences(component(index), variableCopies, true);
     }
-    applyEquivalenceMapToModel(map, m);
 
     return m;
 }
 
-IndexStack reverseEngineerIndexStack(const ComponentPtr &component)
-{
-    auto dummyVariable = Variable::create();
-    component->addVariable(dummyVariable);
-    IndexStack indexStack = reverseEngineerIndexStack(dummyVariable);
-    indexStack.pop_back();
-    component->removeVariable(dummyVariable);
-
-    return indexStack;
-}
-
-IndexStack rebaseIndexStack(const IndexStack &stack, const IndexStack &originStack, const IndexStack &destinationStack)
+bool hasEquivalentUnits(const ModelPtr &model, const UnitsPtr &units)
 {
-    auto rebasedStack = stack;
-
-    rebasedStack.resize(originStack.size(), SIZE_MAX);
-    if (rebasedStack == originStack) {
-        rebasedStack = destinationStack;
-        auto offsetIt = stack.begin() + static_cast<int64_t>(originStack.size());
-        rebasedStack.insert(rebasedStack.end(), offsetIt, stack.end());
-    } else {
-        rebasedStack.clear();
+    if (units->name().empty()) {
+        return false;
     }
 
-    return rebasedStack;
+    auto modelUnits = model->units(units->name());
+
+    return (modelUnits != nullptr) && Units::dimensionallyEquivalent(modelUnits, units);
 }
 
-EquivalenceMap rebaseEquivalenceMap(const EquivalenceMap &map, const IndexStack &originStack, const IndexStack &destinationStack)
+void findVariableUnits(const ComponentPtr &component, std::vector<UnitsPtr> &variableUnits)
 {
-    EquivalenceMap rebasedMap;
-    for (const auto &entry : map) {
-        auto key = entry.first;
-        auto rebasedKey = rebaseIndexStack(key, originStack, destinationStack);
-        if (!rebasedKey.empty()) {
-            auto vector = entry.second;
-            std::vector<IndexStack> rebasedVector;
-            for (const auto &stack : vector) {
-                auto rebasedTarget = rebaseIndexStack(stack, originStack, destinationStack);
-                if (!rebasedTarget.empty()) {
-                    rebasedVector.push_back(rebasedTarget);
-                }
-            }
-
-            if (!rebasedVector.empty()) {
-                rebasedMap[rebasedKey] = rebasedVector;
-            }
+    for (size_t index = 0; index < component->variableCount(); ++index) {
+        auto u = component->variable(index)->units();
+        if (u != nullptr) {
+            variableUnits.push_back(u);
         }
     }
-
-    return rebasedMap;
-}
-
-void componentNames(const ComponentPtr &component, NameList &names)
-{
     for (size_t index = 0; index < component->componentCount(); ++index) {
-        auto c = component->component(index);
-        names.push_back(c->name());
-        componentNames(c, names);
+        findVariableUnits(component->component(index), variableUnits);
     }
 }
 
-NameList componentNames(const ModelPtr &model)
+UnitsPtr instantiateUnits(const ModelPtr &model, const UnitsPtr &units)
 {
-    NameList names;
-    for (size_t index = 0; index < model->componentCount(); ++index) {
-        auto component = model->component(index);
-        names.push_back(component->name());
-        componentNames(component, names);
+    // Standard units are not to be added to the model.
+
+    auto unitsCopy = units->clone();
+    if (isStandardUnitName(unitsCopy->name())) {
+        return unitsCopy;
     }
-    return names;
-}
 
-ComponentNameMap createComponentNamesMap(const ComponentPtr &component)
-{
-    ComponentNameMap nameMap;
-    for (size_t index = 0; index < component->componentCount(); ++index) {
-        auto c = component->component(index);
-        nameMap[c->name()] = c;
-        ComponentNameMap childrenNameMap = createComponentNamesMap(c);
-        nameMap.insert(childrenNameMap.begin(), childrenNameMap.end());
+    // Use the model's units if they are equivalent to the given ones,
+    // otherwise add a copy of the given units to the model, under a name
+    // which is not yet in use.
+
+    auto name = unitsCopy->name();
+    size_t count = 0;
+    while (model->hasUnits(unitsCopy->name()) && !hasEquivalentUnits(model, unitsCopy)) {
+        unitsCopy->setName(name + "_" + convertToString(++count));
     }
+    if (model->hasUnits(unitsCopy->name())) {
+        return model->units(unitsCopy->name());
+    }
+    model->addUnits(unitsCopy);
 
-    return nameMap;
+    return unitsCopy;
 }
 
-void flattenComponent(const ComponentEntityPtr &parent, const ComponentPtr &component, size_t index)
+UnitsCopyMap instantiateComponentUnits(const ModelPtr &model, const ComponentPtr &importedComponent, UnitsCopyMap &instantiatedUnits)
 {
-    if (component->isImport()) {
-        auto model = owningModel(component);
-        auto importSource = component->importSource();
-        auto importModel = importSource->model();
-        auto importedComponent = importModel->component(component->importReference());
-
-        // Determine names of components already in use.
-        NameList compNames = componentNames(model);
-
-        // Determine the stack for the destination component.
-        IndexStack destinationComponentBaseIndexStack = reverseEngineerIndexStack(component);
-
-        // Determine the stack for the source component.
-        IndexStack importedComponentBaseIndexStack = reverseEngineerIndexStack(importedComponent);
-
-        // Generate equivalence map for the source component.
-        EquivalenceMap map;
-        recordVariableEquivalences(importedComponent, map, importedComponentBaseIndexStack);
-        generateEquivalenceMap(importedComponent, map, importedComponentBaseIndexStack);
-
-        // Rebase the generated equivalence map from the source component to the destination component.
-        auto rebasedMap = rebaseEquivalenceMap(map, importedComponentBaseIndexStack, destinationComponentBaseIndexStack);
-
-        // Take a copy of the imported component which will be used to replace the import defined in this model.
-        auto importedComponentCopy = importedComponent->clone();
-        importedComponentCopy->setName(component->name());
-
-        // Temporarily add component to new model to find units used.
-        auto tempModel = Model::create();
-        tempModel->addComponent(importedComponentCopy);
-        tempModel->linkUnits();
-        std::vector<UnitsPtr> requiredUnits;
-        for (size_t i = 0; i < tempModel->unitsCount(); ++i) {
-            auto u = tempModel->units(i);
-            requiredUnits.push_back(u);
-        }
+    // Determine the units to be used by the variables of the copy of the
+    // imported component. Units with the same name are taken to be the same
+    // units within an imported component, while the units that were
+    // instantiated for a previous instance of an imported component are
+    // shared by all its instances.
 
-        // Make a map of component name to component pointer.
-        ComponentNameMap newComponentNames = createComponentNamesMap(importedComponentCopy);
-        for (const auto &entry : newComponentNames) {
-            std::string newName = entry.first;
-            size_t count = 1;
-            while (std::find(compNames.begin(), compNames.end(), newName) != compNames.end()) {
-                newName += "_" + convertToString(count++);
-            }
-            if (newName != entry.first) {
-                entry.second->setName(newName);
-            }
-        }
+    std::vector<UnitsPtr> variableUnits;
+    UnitsCopyMap unitsCopies;
+    std::unordered_map<std::string, UnitsPtr> namedUnitsCopies;
 
-        // If the component 'component' has variables then they are equivalent variables and they
-        // need to be exchanged with the real variables from the component 'importedComponent'.
-        for (size_t i = 0; i < component->variableCount(); ++i) {
-            auto placeholderVariable = component->variable(i);
-            for (size_t j = 0; j < placeholderVariable->equivalentVariableCount(); ++j) {
-                auto localModelVariable = placeholderVariable->equivalentVariable(j);
-                auto importedComponentVariable = importedComponentCopy->variable(placeholderVariable->name());
-                Variable::removeEquivalence(placeholderVariable, localModelVariable);
-                Variable::addEquivalence(importedComponentVariable, localModelVariable);
-            }
-        }
-        parent->replaceComponent(index, importedComponentCopy);
-
-        // Apply the rebased equivalence map onto the modified model.
-        applyEquivalenceMapToModel(rebasedMap, model);
-
-        // Copy over units used in imported component to this model.
-        for (const auto &u : requiredUnits) {
-            if (!model->hasUnits(u)) {
-                size_t count = 0;
-                while (!model->hasUnits(u) && model->hasUnits(u->name())) {
-                    auto name = u->name();
-                    name += "_" + convertToString(++count);
-                    u->setName(name);
+    findVariableUnits(importedComponent, variableUnits);
+
+    for (const auto &u : variableUnits) {
+        if (unitsCopies.count(u.get()) == 0) {
+            auto namedUnitsCopy = namedUnitsCopies.find(u->name());
+            if (namedUnitsCopy != namedUnitsCopies.end()) {
+                unitsCopies.emplace(u.get(), namedUnitsCopy->second);
+            } else {
+                auto instantiatedUnitsCopy = instantiatedUnits.find(u.get());
+                auto unitsCopy = (instantiatedUnitsCopy != instantiatedUnits.end()) ?
+                                     instantiatedUnitsCopy->second :
+                                     instantiateUnits(model, u);
+                instantiatedUnits.emplace(u.get(), unitsCopy);
+                unitsCopies.emplace(u.get(), unitsCopy);
+                if (!isStandardUnitName(u->name())) {
+                    namedUnitsCopies.emplace(u->name(), unitsCopy);
                 }
-                model->addUnits(u);
             }
         }
     }
+
+    return unitsCopies;
 }
 
-void flattenComponentTree(const ComponentEntityPtr &parent, const ComponentPtr &component, size_t componentIndex)
+ComponentPtr flattenComponent(const ModelPtr &model, const ComponentImport &componentImport, ComponentNames &componentNames, UnitsCopyMap &instantiatedUnits)
 {
-    flattenComponent(parent, component, componentIndex);
+    auto parent = componentImport.first;
+    auto index = componentImport.second;
+    auto component = parent->component(index);
+    auto importSource = component->importSource();
+    auto importModel = importSource->model();
+    auto importedComponent = importModel->component(component->importReference());
 
-    for (size_t index = 0; index < component->componentCount(); ++index) {
-        auto c = component->component(index);
-        flattenComponentTree(component, c, index);
+    // Take a copy of the imported component which will be used to replace the
+    // import defined in this model. The copy shares its math and its units with
+    // the other instances of the imported component, so that only its
+    // variables, i.e. what binds it to the rest of the model, are its own.
+    UnitsCopyMap unitsCopies = instantiateComponentUnits(model, importedComponent, instantiatedUnits);
+    VariableCopyMap variableCopies;
+    auto importedComponentCopy = cloneComponent(*importedComponent, unitsCopies, variableCopies);
+    importedComponentCopy->setName(component->name());
+
+    // Make the names of the encapsulated components unique.
+    ComponentNameMap newComponentNames = createComponentNamesMap(importedComponentCopy);
+    for (const auto &entry : newComponentNames) {
+        std::string newName = componentNames.uniqueName(entry.first);
+        if (newName != entry.first) {
+            entry.second->setName(newName);
+        }
+        componentNames.mNames.insert(newName);
+    }
+    addComponentNames(importedComponentCopy, componentNames);
+
+    // If the component 'component' has variables then they are equivalent variables and they
+    // need to be exchanged with the real variables from the component 'importedComponent'.
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto placeholderVariable = component->variable(i);
+        auto importedComponentVariable = importedComponentCopy->variable(placeholderVariable->name());
+        std::vector<VariablePtr> localModelVariables;
+        for (size_t j = 0; j < placeholderVariable->equivalentVariableCount(); ++j) {
+            localModelVariables.push_back(placeholderVariable->equivalentVariable(j));
+        }
+        for (const auto &localModelVariable : localModelVariables) {
+            Variable::removeEquivalence(placeholderVariable, localModelVariable);
+            Variable::addEquivalence(importedComponentVariable, localModelVariable);
+        }
     }
+    parent->replaceComponent(index, importedComponentCopy);
+
+    // Recreate, between the copied variables, the equivalences of the imported component.
+    copyVariableEquivalences(importedComponent, variableCopies, false);
+
+    return importedComponentCopy;
 }
 
 void Model::flatten()
@@ -761,8 +698,27 @@ void Model::flatten()
         return;
     }
 
-    while (hasImports()) {
+    // Instantiate imported units and components one level of the import graph
+    // at a time, as we have always done, so that the names given to them do
+    // not depend on how deep their imports are. Each level is dealt with in a
+    // single pass: the imported components of a level are those brought in by
+    // the components instantiated at the previous level, and the names in use
+    // are kept track of rather than looked for in the whole model.
+
+    auto model = shared_from_this();
+    ComponentNames componentNames;
+    UnitsCopyMap instantiatedUnits;
+    std::vector<ComponentImport> componentImports;
+
+    for (size_t index = 0; index < componentCount(); ++index) {
+        addComponentNames(component(index), componentNames);
+    }
+    findComponentImports(model, componentImports);
+
+    bool unitsImported = true;
+    while (unitsImported || !componentImports.empty()) {
         // Go through Units and instantiate any imported Units.
+        unitsImported = false;
         for (size_t index = 0; index < unitsCount(); ++index) {
             auto u = units(index);
             if (u->isImport()) {
@@ -770,14 +726,21 @@ void Model::flatten()
                 auto importedUnitsCopy = importedUnits->clone();
                 importedUnitsCopy->setName(u->name());
                 replaceUnits(index, importedUnitsCopy);
+                unitsImported = true;
             }
         }
 
-        // Go through Components and instatiate any imported Components
-        for (size_t index = 0; index < componentCount(); ++index) {
-            auto c = component(index);
-            flattenComponentTree(shared_from_this(), c, index);
+        // Go through Components and instantiate any imported Components.
+        std::vector<ComponentImport> nextComponentImports;
+        for (const auto &componentImport : componentImports) {
+            auto c = flattenComponent(model, componentImport, componentNames, instantiatedUnits);
+            if (c->isImport()) {
+                nextComponentImports.push_back(componentImport);
+            } else {
+                findComponentImports(c, nextComponentImports);
+            }
         }
+        componentImports.swap(nextComponentImports);
     }
 }
 
@@ -18,6 +18,8 @@ limitations under the License.
 #include "libcellml/componententity.h"
 #include "libcellml/namedentity.h"
 
+#include "symbol.h"
+
 namespace libcellml {
 
 /**
@@ -27,7 +29,7 @@ namespace libcellml {
  */
 struct NamedEntity::NamedEntityImpl
 {
-    std::string mName; /**< Entity name represented as a std::string. */
+    Symbol mName; /**< Entity name represented as an interned string. */
 };
 
 NamedEntity::NamedEntity()
@@ -42,12 +44,22 @@ NamedEntity::~NamedEntity()
 
 void NamedEntity::setName(const std::string &name)
 {
-    mPimpl->mName = name;
+    // Only intern the name if it is different from the current one, so that
+    // renaming an entity to its current name does not lock the intern table.
+    if (name == mPimpl->mName.string()) {
+        return;
+    }
+    mPimpl->mName = Symbol(name);
+    markAsModified();
+    auto owner = std::dynamic_pointer_cast<ComponentEntity>(parent());
+    if (owner != nullptr) {
+        owner->invalidateNameIndices();
+    }
 }
 
 std::string NamedEntity::name() const
 {
-    return mPimpl->mName;
+    return mPimpl->mName.string();
 }
 
 } // namespace libcellml
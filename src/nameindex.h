@@ -0,0 +1,189 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace libcellml {
+
+/**
+ * @brief The NameIndex class.
+ *
+ * The NameIndex class is a hash-based index of the first item with a given
+ * name in a list of named items. The index is kept up to date when an item is
+ * appended to or erased from the list, and is otherwise rebuilt the first
+ * time that it is needed after it has been invalidated, e.g. after an item of
+ * the list has been renamed.
+ */
+template<typename T>
+class NameIndex
+{
+public:
+    using ItemPtr = std::shared_ptr<T>; /**< Type definition for a named item. */
+    using Items = std::vector<ItemPtr>; /**< Type definition for a list of named items. */
+
+    /**
+     * @brief Invalidate this index.
+     *
+     * Invalidate this index, so that it gets rebuilt the next time that it
+     * is needed.
+     */
+    void invalidate()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mValid = false;
+        mItems.clear();
+    }
+
+    /**
+     * @brief Update this index after an item has been appended to @p items.
+     *
+     * Update this index after an item has been appended to @p items.
+     *
+     * @param items The list of named items.
+     */
+    void append(const Items &items)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mValid) {
+            mItems.emplace(items.back()->name(), items.back());
+        }
+    }
+
+    /**
+     * @brief Update this index after @p item has been erased from @p items.
+     *
+     * Update this index after @p item has been erased from @p items.
+     *
+     * @param items The list of named items.
+     * @param item The item that has been erased.
+     */
+    void erase(const Items &items, const ItemPtr &item)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mValid) {
+            return;
+        }
+        std::string name = item->name();
+        auto iter = mItems.find(name);
+        if ((iter != mItems.end()) && (iter->second == item)) {
+            // The item was the first one with its name, so look for the next
+            // one, if any.
+            mItems.erase(iter);
+            for (const auto &otherItem : items) {
+                if (otherItem->name() == name) {
+                    mItems.emplace(name, otherItem);
+                    break;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Update this index after @p item has replaced @p oldItem.
+     *
+     * Update this index after @p item has replaced @p oldItem, in place, in
+     * the list of named items.
+     *
+     * @param oldItem The item that has been replaced.
+     * @param item The item that has replaced @p oldItem.
+     */
+    void replace(const ItemPtr &oldItem, const ItemPtr &item)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mValid) {
+            return;
+        }
+        auto iter = mItems.find(item->name());
+        if ((iter != mItems.end()) && (iter->second == oldItem)) {
+            // The items have the same name and the old item was the first one
+            // with that name, so the new item now is.
+            iter->second = item;
+        } else if ((iter == mItems.end()) || (oldItem->name() != item->name())) {
+            // The items have different names, so play it safe.
+            mValid = false;
+            mItems.clear();
+        }
+    }
+
+    /**
+     * @brief Get the first item called @p name in @p items.
+     *
+     * Get the first item called @p name in @p items.
+     *
+     * @param items The list of named items.
+     * @param name The name of the item to look for.
+     *
+     * @return The item, or @c nullptr if there is no item called @p name.
+     */
+    ItemPtr item(const Items &items, const std::string &name)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mValid) {
+            rebuild(items);
+        }
+        auto iter = mItems.find(name);
+        if ((iter != mItems.end()) && (iter->second->name() != name)) {
+            // The item has been renamed without us being told about it, so
+            // play it safe.
+            rebuild(items);
+            iter = mItems.find(name);
+        }
+        return (iter != mItems.end()) ? iter->second : nullptr;
+    }
+
+    /**
+     * @brief Get the first item called @p name in @p items.
+     *
+     * Get an iterator to the first item called @p name in @p items.
+     *
+     * @param items The list of named items.
+     * @param name The name of the item to look for.
+     *
+     * @return The iterator to the item, or the end of @p items if there is no
+     * item called @p name.
+     */
+    typename Items::iterator find(Items &items, const std::string &name)
+    {
+        ItemPtr namedItem = item(items, name);
+        if (namedItem == nullptr) {
+            return items.end();
+        }
+        return std::find(items.begin(), items.end(), namedItem);
+    }
+
+private:
+    void rebuild(const Items &items)
+    {
+        mItems.clear();
+        for (const auto &item : items) {
+            mItems.emplace(item->name(), item);
+        }
+        mValid = true;
+    }
+
+    std::mutex mMutex;
+    std::unordered_map<std::string, ItemPtr> mItems;
+    bool mValid = false;
+};
+
+} // namespace libcellml
@@ -47,6 +47,7 @@ void OrderedEntity::setOrder(int order)
 {
     mPimpl->mOrder = order;
     mPimpl->mOrderSet = true;
+    markAsModified();
 }
 
 int OrderedEntity::order() const
@@ -57,6 +58,7 @@ int OrderedEntity::order() const
 void OrderedEntity::unsetOrder()
 {
     mPimpl->mOrderSet = false;
+    markAsModified();
 }
 
 bool OrderedEntity::isOrderSet()
@@ -29,8 +29,11 @@ limitations under the License.
 #include "libcellml/reset.h"
 #include "libcellml/variable.h"
 
+#include "mappedfile.h"
 #include "namespaces.h"
+#include "snapshot.h"
 #include "utilities.h"
+#include "workqueue.h"
 #include "xmldoc.h"
 #include "xmlutils.h"
 
@@ -44,31 +47,85 @@ namespace libcellml {
 struct Parser::ParserImpl
 {
     Parser *mParser = nullptr;
+    bool mStreaming = false;
 
     /**
-     * @brief Update the @p model with attributes parsed from a @c std::string.
+     * @brief Update the @p model with attributes parsed from a buffer.
      *
      * Update the @p model with attributes and entities parsed from
-     * the @c std::string @p input. Any entities or attributes in @p model with names
-     * matching those in @p input will be overwritten.
+     * the @p size bytes of @p data. Any entities or attributes in @p model with names
+     * matching those in @p data will be overwritten.
      *
      * @param model The @c ModelPtr to update.
-     * @param input The string to parse and update the @p model with.
+     * @param data The buffer to parse and update the @p model with.
+     * @param size The size of the buffer.
      */
-    void loadModel(const ModelPtr &model, const std::string &input);
+    void loadModel(const ModelPtr &model, const char *data, size_t size);
 
     /**
-     * @brief Update a @p model with the attributes from a @c std::string.
+     * @brief Add the XML errors raised while parsing @p doc.
+     *
+     * Add the errors raised by libxml2 while parsing @p doc to the
+     * @c Parser.
+     *
+     * @param doc The @c XmlDocPtr that has been parsed.
+     */
+    void addXmlErrors(const XmlDocPtr &doc);
+
+    /**
+     * @brief Add an error for an input without a valid XML root node.
+     *
+     * Add an error to the @c Parser for an input from which no valid XML
+     * root node could be retrieved.
+     */
+    void addNoRootNodeError();
+
+    /**
+     * @brief Update the @p model with the attributes of the model @p node.
+     *
+     * Check that @p node is a CellML model element and update the @p model
+     * with its attributes. The children of @p node are not considered.
+     *
+     * @param model The @c ModelPtr to update.
+     * @param node The model @c XmlNodePtr to parse and update the @p model with.
+     *
+     * @return @c true if @p node is a CellML model element, @c false otherwise.
+     */
+    bool loadModelElement(const ModelPtr &model, const XmlNodePtr &node);
+
+    /**
+     * @brief Update the @p model with the child @p node of a model element.
+     *
+     * Update the @p model with the component, units or import parsed from
+     * @p node. Connection and encapsulation nodes can only be loaded once all
+     * the components of the @p model are known, so they are added to
+     * @p connectionNodes and @p encapsulationNodes, respectively.
+     *
+     * @param model The @c ModelPtr to update.
+     * @param childNode The @c XmlNodePtr to parse and update the @p model with.
+     * @param connectionNodes The connection nodes to be loaded later on.
+     * @param encapsulationNodes The encapsulation nodes to be loaded later on.
+     *
+     * @return @c true if @p childNode has been added to @p connectionNodes or
+     * @p encapsulationNodes, @c false otherwise.
+     */
+    bool loadModelChild(const ModelPtr &model, const XmlNodePtr &childNode,
+                        std::vector<XmlNodePtr> &connectionNodes,
+                        std::vector<XmlNodePtr> &encapsulationNodes);
+
+    /**
+     * @brief Update a @p model with the attributes from a buffer.
      *
      * Update the @p model with entities and attributes
-     * from the @c std::string @p input. Any entities or attributes
-     * in the @p model with names matching those in @p input
+     * from the @p size bytes of @p data. Any entities or attributes
+     * in the @p model with names matching those in @p data
      * will be overwritten.
      *
      * @param model The @c ModelPtr to update.
-     * @param input The string to parse and update the @p model with.
+     * @param data The buffer to parse and update the @p model with.
+     * @param size The size of the buffer.
      */
-    void updateModel(const ModelPtr &model, const std::string &input);
+    void updateModel(const ModelPtr &model, const char *data, size_t size);
 
     /**
      * @brief Update the @p component with attributes parsed from @p node.
@@ -229,47 +286,208 @@ ParserPtr Parser::create() noexcept
 }
 
 ModelPtr Parser::parseModel(const std::string &input)
+{
+    return parseModel(input.c_str(), input.size());
+}
+
+ModelPtr Parser::parseModel(const char *data, size_t size)
 {
     removeAllErrors();
     ModelPtr model = Model::create();
-    if (input.empty()) {
+    if (size == 0) {
         ErrorPtr err = Error::create();
         err->setDescription("Model is empty.");
         err->setKind(Error::Kind::XML);
         err->setModel(model);
         addError(err);
+    } else if (size > size_t(std::numeric_limits<int>::max())) {
+        // LibXml2 takes the size of a buffer as an int.
+        ErrorPtr err = Error::create();
+        err->setDescription("Model is too large (" + std::to_string(size) + " bytes), the maximum size is " + std::to_string(std::numeric_limits<int>::max()) + " bytes.");
+        err->setKind(Error::Kind::XML);
+        err->setModel(model);
+        addError(err);
     } else {
-        mPimpl->updateModel(model, input);
+        mPimpl->updateModel(model, data, size);
     }
     return model;
 }
 
-void Parser::ParserImpl::updateModel(const ModelPtr &model, const std::string &input)
+ModelPtr Parser::parseModelFromFile(const std::string &path)
 {
-    loadModel(model, input);
+    MappedFile file(path);
+    if (!file.isValid()) {
+        removeAllErrors();
+        ErrorPtr err = Error::create();
+        err->setDescription("File '" + path + "' could not be opened.");
+        err->setKind(Error::Kind::XML);
+        addError(err);
+        return nullptr;
+    }
+    return parseModel(file.data(), file.size());
+}
+
+ModelPtr Parser::parseModelSnapshot(const std::string &snapshot)
+{
+    return parseModelSnapshot(snapshot.c_str(), snapshot.size());
 }
 
-void Parser::ParserImpl::loadModel(const ModelPtr &model, const std::string &input)
+ModelPtr Parser::parseModelSnapshot(const char *data, size_t size)
+{
+    removeAllErrors();
+    ModelPtr model = Model::create();
+    unsigned int version = 0;
+    auto status = readModelSnapshot(model, data, size, version);
+    if (status == ModelSnapshotStatus::OK) {
+        return model;
+    }
+    ErrorPtr err = Error::create();
+    if (status == ModelSnapshotStatus::UNSUPPORTED_VERSION) {
+        err->setDescription("Snapshot version " + std::to_string(version) + " is not supported, only version " + std::to_string(MODEL_SNAPSHOT_VERSION) + " is.");
+    } else {
+        err->setDescription("Snapshot is not a valid model snapshot.");
+    }
+    err->setKind(Error::Kind::XML);
+    addError(err);
+    return nullptr;
+}
+
+ModelPtr Parser::parseModelSnapshotFromFile(const std::string &path)
+{
+    MappedFile file(path);
+    if (!file.isValid()) {
+        removeAllErrors();
+        ErrorPtr err = Error::create();
+        err->setDescription("File '" + path + "' could not be opened.");
+        err->setKind(Error::Kind::XML);
+        addError(err);
+        return nullptr;
+    }
+    return parseModelSnapshot(file.data(), file.size());
+}
+
+void Parser::setStreaming(bool streaming)
+{
+    mPimpl->mStreaming = streaming;
+}
+
+bool Parser::isStreaming() const
+{
+    return mPimpl->mStreaming;
+}
+
+std::vector<Parser::ParsedModel> Parser::parseModels(const std::vector<std::string> &paths, size_t threads)
+{
+    std::vector<ParsedModel> res(paths.size());
+    std::vector<ParserPtr> parsers(concurrentWorkerCount(paths.size(), threads));
+    for (auto &parser : parsers) {
+        parser = Parser::create();
+        parser->setStreaming(mPimpl->mStreaming);
+    }
+
+    runConcurrently(paths.size(), parsers.size(), [&](size_t worker, size_t index) {
+        ParserPtr parser = parsers.at(worker);
+        ParsedModel &parsedModel = res.at(index);
+        parsedModel.model = parser->parseModelFromFile(paths.at(index));
+        for (size_t i = 0; i < parser->errorCount(); ++i) {
+            parsedModel.errors.push_back(parser->error(i));
+        }
+    });
+
+    return res;
+}
+
+void Parser::ParserImpl::updateModel(const ModelPtr &model, const char *data, size_t size)
+{
+    loadModel(model, data, size);
+}
+
+void Parser::ParserImpl::loadModel(const ModelPtr &model, const char *data, size_t size)
 {
     XmlDocPtr doc = std::make_shared<XmlDoc>();
-    doc->parse(input);
-    // Copy any XML parsing errors into the common parser error handler.
-    if (doc->xmlErrorCount() > 0) {
-        for (size_t i = 0; i < doc->xmlErrorCount(); ++i) {
+    std::vector<XmlNodePtr> connectionNodes;
+    std::vector<XmlNodePtr> encapsulationNodes;
+    bool validModelElement = false;
+    if (mStreaming) {
+        bool hasRootNode = false;
+        doc->parseStreaming(
+            data, size,
+            [&](const XmlNodePtr &node) {
+                hasRootNode = true;
+                validModelElement = loadModelElement(model, node);
+                return validModelElement;
+            },
+            [&](const XmlNodePtr &node) {
+                return loadModelChild(model, node, connectionNodes, encapsulationNodes);
+            });
+        addXmlErrors(doc);
+        if (!hasRootNode) {
+            addNoRootNodeError();
+        }
+    } else {
+        doc->parse(data, size);
+        addXmlErrors(doc);
+        const XmlNodePtr node = doc->rootNode();
+        if (!node) {
+            addNoRootNodeError();
+            return;
+        }
+        validModelElement = loadModelElement(model, node);
+        if (validModelElement) {
+            // Get model children (CellML entities).
+            XmlNodePtr childNode = node->firstChild();
+            while (childNode) {
+                loadModelChild(model, childNode, connectionNodes, encapsulationNodes);
+                childNode = childNode->next();
+            }
+        }
+    }
+    if (!validModelElement) {
+        return;
+    }
+
+    if (!encapsulationNodes.empty()) {
+        // The component_ref elements of the first encapsulation and their
+        // child and sibling elements will be loaded and error-checked in
+        // loadEncapsulation().
+        loadEncapsulation(model, encapsulationNodes.at(0)->firstChild());
+        if (encapsulationNodes.size() > 1) {
             ErrorPtr err = Error::create();
-            err->setDescription("LibXml2 error: " + doc->xmlError(i));
-            err->setKind(Error::Kind::XML);
+            err->setDescription("Model '" + model->name() + "' has more than one encapsulation element.");
+            err->setModel(model);
+            err->setKind(Error::Kind::ENCAPSULATION);
+            err->setRule(SpecificationRule::MODEL_MORE_THAN_ONE_ENCAPSULATION);
             mParser->addError(err);
         }
     }
-    const XmlNodePtr node = doc->rootNode();
-    if (!node) {
+    for (const auto &connectionNode : connectionNodes) {
+        loadConnection(model, connectionNode);
+    }
+
+    model->linkUnits();
+}
+
+void Parser::ParserImpl::addXmlErrors(const XmlDocPtr &doc)
+{
+    // Copy any XML parsing errors into the common parser error handler.
+    for (size_t i = 0; i < doc->xmlErrorCount(); ++i) {
         ErrorPtr err = Error::create();
-        err->setDescription("Could not get a valid XML root node from the provided input.");
+        err->setDescription("LibXml2 error: " + doc->xmlError(i));
         err->setKind(Error::Kind::XML);
         mParser->addError(err);
-        return;
     }
+}
+
+void Parser::ParserImpl::addNoRootNodeError()
+{
+    ErrorPtr err = Error::create();
+    err->setDescription("Could not get a valid XML root node from the provided input.");
+    err->setKind(Error::Kind::XML);
+    mParser->addError(err);
+}
+
+bool Parser::ParserImpl::loadModelElement(const ModelPtr &model, const XmlNodePtr &node)
+{
     if (!node->isCellmlElement("model")) {
         ErrorPtr err = Error::create();
         if (node->name() == "model") {
@@ -284,7 +502,7 @@ void Parser::ParserImpl::loadModel(const ModelPtr &model, const std::string &inp
         err->setModel(model);
         err->setRule(SpecificationRule::MODEL_ELEMENT);
         mParser->addError(err);
-        return;
+        return false;
     }
     // Get model attributes.
     XmlAttributePtr attribute = node->firstAttribute();
@@ -301,95 +519,77 @@ void Parser::ParserImpl::loadModel(const ModelPtr &model, const std::string &inp
         }
         attribute = attribute->next();
     }
-    // Get model children (CellML entities).
-    XmlNodePtr childNode = node->firstChild();
-    std::vector<XmlNodePtr> connectionNodes;
-    std::vector<XmlNodePtr> encapsulationNodes;
-    while (childNode) {
-        if (childNode->isCellmlElement("component")) {
-            const std::string name;
-            ComponentPtr component = Component::create(name);
-            loadComponent(component, childNode);
-            model->addComponent(component);
-        } else if (childNode->isCellmlElement("units")) {
-            UnitsPtr units = Units::create();
-            loadUnits(units, childNode);
-            model->addUnits(units);
-        } else if (childNode->isCellmlElement("import")) {
-            ImportSourcePtr importSource = ImportSource::create();
-            loadImport(importSource, model, childNode);
-        } else if (childNode->isCellmlElement("encapsulation")) {
-            // An encapsulation should not have attributes other than an 'id' attribute.
-            if (childNode->firstAttribute()) {
-                XmlAttributePtr childAttribute = childNode->firstAttribute();
-                while (childAttribute) {
-                    if (childAttribute->isType("id")) {
-                        model->setEncapsulationId(childAttribute->value());
-                    } else {
-                        ErrorPtr err = Error::create();
-                        err->setDescription("Encapsulation in model '" + model->name() + "' has an invalid attribute '" + childAttribute->name() + "'.");
-                        err->setModel(model);
-                        err->setKind(Error::Kind::ENCAPSULATION);
-                        mParser->addError(err);
-                    }
-                    childAttribute = childAttribute->next();
+    return true;
+}
+
+bool Parser::ParserImpl::loadModelChild(const ModelPtr &model, const XmlNodePtr &childNode,
+                                        std::vector<XmlNodePtr> &connectionNodes,
+                                        std::vector<XmlNodePtr> &encapsulationNodes)
+{
+    if (childNode->isCellmlElement("component")) {
+        const std::string name;
+        ComponentPtr component = Component::create(name);
+        loadComponent(component, childNode);
+        model->addComponent(component);
+    } else if (childNode->isCellmlElement("units")) {
+        UnitsPtr units = Units::create();
+        loadUnits(units, childNode);
+        model->addUnits(units);
+    } else if (childNode->isCellmlElement("import")) {
+        ImportSourcePtr importSource = ImportSource::create();
+        loadImport(importSource, model, childNode);
+    } else if (childNode->isCellmlElement("encapsulation")) {
+        // An encapsulation should not have attributes other than an 'id' attribute.
+        if (childNode->firstAttribute()) {
+            XmlAttributePtr childAttribute = childNode->firstAttribute();
+            while (childAttribute) {
+                if (childAttribute->isType("id")) {
+                    model->setEncapsulationId(childAttribute->value());
+                } else {
+                    ErrorPtr err = Error::create();
+                    err->setDescription("Encapsulation in model '" + model->name() + "' has an invalid attribute '" + childAttribute->name() + "'.");
+                    err->setModel(model);
+                    err->setKind(Error::Kind::ENCAPSULATION);
+                    mParser->addError(err);
                 }
+                childAttribute = childAttribute->next();
             }
-            // Load encapsulated component_refs.
-            XmlNodePtr componentRefNode = childNode->firstChild();
-            if (componentRefNode) {
-                // This component_ref and its child and sibling elements will be loaded
-                // and error-checked in loadEncapsulation().
-                encapsulationNodes.push_back(componentRefNode);
-            } else {
-                // TODO Should this be removed?
-                ErrorPtr err = Error::create();
-                err->setDescription("Encapsulation in model '" + model->name() + "' does not contain any child elements.");
-                err->setModel(model);
-                err->setKind(Error::Kind::ENCAPSULATION);
-                err->setRule(SpecificationRule::ENCAPSULATION_COMPONENT_REF);
-                mParser->addError(err);
-            }
-        } else if (childNode->isCellmlElement("connection")) {
-            connectionNodes.push_back(childNode);
-        } else if (childNode->isText()) {
-            std::string textNode = childNode->convertToString();
-            // Ignore whitespace when parsing.
-            if (hasNonWhitespaceCharacters(textNode)) {
-                ErrorPtr err = Error::create();
-                err->setDescription("Model '" + model->name() + "' has an invalid non-whitespace child text element '" + textNode + "'.");
-                err->setModel(model);
-                err->setRule(SpecificationRule::MODEL_CHILD);
-                mParser->addError(err);
-            }
-        } else if (childNode->isComment()) {
-            // Do nothing.
-        } else {
-            ErrorPtr err = Error::create();
-            err->setDescription("Model '" + model->name() + "' has an invalid child element '" + childNode->name() + "'.");
-            err->setModel(model);
-            err->setRule(SpecificationRule::MODEL_CHILD);
-            mParser->addError(err);
         }
-        childNode = childNode->next();
-    }
-
-    if (!encapsulationNodes.empty()) {
-        loadEncapsulation(model, encapsulationNodes.at(0));
-        if (encapsulationNodes.size() > 1) {
+        // Load encapsulated component_refs once all the components are known.
+        if (childNode->firstChild()) {
+            encapsulationNodes.push_back(childNode);
+            return true;
+        }
+        // TODO Should this be removed?
+        ErrorPtr err = Error::create();
+        err->setDescription("Encapsulation in model '" + model->name() + "' does not contain any child elements.");
+        err->setModel(model);
+        err->setKind(Error::Kind::ENCAPSULATION);
+        err->setRule(SpecificationRule::ENCAPSULATION_COMPONENT_REF);
+        mParser->addError(err);
+    } else if (childNode->isCellmlElement("connection")) {
+        connectionNodes.push_back(childNode);
+        return true;
+    } else if (childNode->isText()) {
+        std::string textNode = childNode->convertToString();
+        // Ignore whitespace when parsing.
+        if (hasNonWhitespaceCharacters(textNode)) {
             ErrorPtr err = Error::create();
-            err->setDescription("Model '" + model->name() + "' has more than one encapsulation element.");
+            err->setDescription("Model '" + model->name() + "' has an invalid non-whitespace child text element '" + textNode + "'.");
             err->setModel(model);
-            err->setKind(Error::Kind::ENCAPSULATION);
-            err->setRule(SpecificationRule::MODEL_MORE_THAN_ONE_ENCAPSULATION);
+            err->setRule(SpecificationRule::MODEL_CHILD);
             mParser->addError(err);
         }
+    } else if (childNode->isComment()) {
+        // Do nothing.
+    } else {
+        ErrorPtr err = Error::create();
+        err->setDescription("Model '" + model->name() + "' has an invalid child element '" + childNode->name() + "'.");
+        err->setModel(model);
+        err->setRule(SpecificationRule::MODEL_CHILD);
+        mParser->addError(err);
     }
-    for (const auto &connectionNode : connectionNodes) {
-        loadConnection(model, connectionNode);
-    }
-
-    model->linkUnits();
+    return false;
 }
 
 std::string cleanMath(const std::string &math)
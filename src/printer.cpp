@@ -31,6 +31,7 @@ limitations under the License.
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
 
+#include "snapshot.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -549,4 +550,13 @@ std::string Printer::printModel(const ModelPtr &model) const
     return repr;
 }
 
+std::string Printer::printModelSnapshot(const ModelPtr &model) const
+{
+    if (model == nullptr) {
+        return "";
+    }
+
+    return writeModelSnapshot(model);
+}
+
 } // namespace libcellml
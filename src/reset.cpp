@@ -68,6 +68,7 @@ Reset::~Reset()
 void Reset::setVariable(const VariablePtr &variable)
 {
     mPimpl->mVariable = variable;
+    markAsModified();
 }
 
 VariablePtr Reset::variable() const
@@ -78,6 +79,7 @@ VariablePtr Reset::variable() const
 void Reset::setTestVariable(const VariablePtr &variable)
 {
     mPimpl->mTestVariable = variable;
+    markAsModified();
 }
 
 VariablePtr Reset::testVariable() const
@@ -88,6 +90,7 @@ VariablePtr Reset::testVariable() const
 void Reset::appendTestValue(const std::string &math)
 {
     mPimpl->mTestValue.append(math);
+    markAsModified();
 }
 
 std::string Reset::testValue() const
@@ -98,11 +101,13 @@ std::string Reset::testValue() const
 void Reset::setTestValueId(const std::string &id)
 {
     mPimpl->mTestValueId = id;
+    markAsModified();
 }
 
 void Reset::removeTestValueId()
 {
     mPimpl->mTestValueId = "";
+    markAsModified();
 }
 
 std::string Reset::testValueId() const
@@ -113,16 +118,19 @@ std::string Reset::testValueId() const
 void Reset::setTestValue(const std::string &math)
 {
     mPimpl->mTestValue = math;
+    markAsModified();
 }
 
 void Reset::removeTestValue()
 {
     mPimpl->mTestValue = "";
+    markAsModified();
 }
 
 void Reset::appendResetValue(const std::string &math)
 {
     mPimpl->mResetValue.append(math);
+    markAsModified();
 }
 
 std::string Reset::resetValue() const
@@ -133,21 +141,25 @@ std::string Reset::resetValue() const
 void Reset::setResetValue(const std::string &math)
 {
     mPimpl->mResetValue = math;
+    markAsModified();
 }
 
 void Reset::removeResetValue()
 {
     mPimpl->mResetValue = "";
+    markAsModified();
 }
 
 void Reset::setResetValueId(const std::string &id)
 {
     mPimpl->mResetValueId = id;
+    markAsModified();
 }
 
 void Reset::removeResetValueId()
 {
     mPimpl->mResetValueId = "";
+    markAsModified();
 }
 
 std::string Reset::resetValueId() const
@@ -0,0 +1,591 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "snapshot.h"
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "libcellml/component.h"
+#include "libcellml/importsource.h"
+#include "libcellml/model.h"
+#include "libcellml/reset.h"
+#include "libcellml/units.h"
+#include "libcellml/variable.h"
+
+namespace libcellml {
+
+/**
+ * @brief The tables of a model snapshot.
+ *
+ * The tables of a model snapshot, in the order in which they are stored. The
+ * records of a table are made of the number of 32-bit words given by
+ * recordSizes. References to strings are indices in the strings table while
+ * references to import sources, components and variables are one plus their
+ * index in the corresponding table, zero meaning no reference.
+ */
+enum Table
+{
+    STRINGS, /**< Offset in the string data and length. */
+    IMPORT_SOURCES, /**< URL and id. */
+    UNITS, /**< Name, id, import source, import reference and number of unit records. */
+    UNIT, /**< Reference, prefix, exponent (two words), multiplier (two words) and id. */
+    COMPONENTS, /**< Name, id, encapsulation id, math, import source, import reference, parent component, and number of variable and reset records. */
+    VARIABLES, /**< Name, id, units, initial value and interface type. */
+    RESETS, /**< Variable, test variable, order, whether the order is set, id, test value, test value id, reset value and reset value id. */
+    EQUIVALENCES, /**< First variable, second variable, mapping id and connection id. */
+    TABLE_COUNT
+};
+
+static const size_t recordSizes[TABLE_COUNT] = {2, 2, 5, 7, 9, 5, 9, 4};
+
+/**
+ * The header of a model snapshot starts with a magic string, which is
+ * followed by the version of the format, a byte order mark, the name, id and
+ * encapsulation id of the model, the offset and number of records of each
+ * table, and the offset and size of the string data.
+ */
+static const char MAGIC[8] = {'L', 'C', 'M', 'L', 'S', 'N', 'A', 'P'};
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+static const size_t VERSION_WORD = 0;
+static const size_t BYTE_ORDER_MARK_WORD = 1;
+static const size_t MODEL_WORD = 2;
+static const size_t TABLES_WORD = 5;
+static const size_t STRING_DATA_WORD = TABLES_WORD + 2 * TABLE_COUNT;
+static const size_t HEADER_WORD_COUNT = STRING_DATA_WORD + 2;
+static const size_t HEADER_SIZE = sizeof(MAGIC) + 4 * HEADER_WORD_COUNT;
+
+/**
+ * @brief The ModelSnapshotWriter class.
+ *
+ * The ModelSnapshotWriter class builds the tables of a model snapshot.
+ */
+class ModelSnapshotWriter
+{
+public:
+    std::string write(const ModelPtr &model);
+
+private:
+    std::vector<uint32_t> mTables[TABLE_COUNT]; /**< The tables of the snapshot. */
+    std::string mStringData; /**< The string data of the snapshot. */
+    std::unordered_map<std::string, uint32_t> mStrings; /**< The index of each string. */
+    std::unordered_map<ImportSourcePtr, uint32_t> mImportSources; /**< The reference to each import source. */
+    std::unordered_map<VariablePtr, uint32_t> mVariables; /**< The reference to each variable. */
+    std::vector<ComponentPtr> mComponents; /**< The components, in the order in which they are stored. */
+
+    uint32_t string(const std::string &string);
+    uint32_t importSource(const ImportSourcePtr &importSource);
+    uint32_t variable(const VariablePtr &variable) const;
+    void addDouble(std::vector<uint32_t> &table, double value);
+    void addUnits(const UnitsPtr &units);
+    void addComponent(const ComponentPtr &component, uint32_t parent);
+    void addResets(const ComponentPtr &component);
+    void addEquivalences(const VariablePtr &variable, uint32_t reference);
+};
+
+uint32_t ModelSnapshotWriter::string(const std::string &string)
+{
+    auto found = mStrings.find(string);
+    if (found != mStrings.end()) {
+        return found->second;
+    }
+    auto index = uint32_t(mStrings.size());
+    mStrings.emplace(string, index);
+    mTables[STRINGS].push_back(uint32_t(mStringData.size()));
+    mTables[STRINGS].push_back(uint32_t(string.size()));
+    mStringData += string;
+    return index;
+}
+
+uint32_t ModelSnapshotWriter::importSource(const ImportSourcePtr &importSource)
+{
+    if (importSource == nullptr) {
+        return 0;
+    }
+    auto found = mImportSources.find(importSource);
+    if (found != mImportSources.end()) {
+        return found->second;
+    }
+    auto reference = uint32_t(mImportSources.size() + 1);
+    mImportSources.emplace(importSource, reference);
+    mTables[IMPORT_SOURCES].push_back(string(importSource->url()));
+    mTables[IMPORT_SOURCES].push_back(string(importSource->id()));
+    return reference;
+}
+
+uint32_t ModelSnapshotWriter::variable(const VariablePtr &variable) const
+{
+    auto found = mVariables.find(variable);
+    return (found != mVariables.end()) ? found->second : 0;
+}
+
+void ModelSnapshotWriter::addDouble(std::vector<uint32_t> &table, double value)
+{
+    uint32_t words[2];
+    std::memcpy(words, &value, sizeof(value));
+    table.push_back(words[0]);
+    table.push_back(words[1]);
+}
+
+void ModelSnapshotWriter::addUnits(const UnitsPtr &units)
+{
+    auto &table = mTables[UNITS];
+    table.push_back(string(units->name()));
+    table.push_back(string(units->id()));
+    table.push_back(importSource(units->importSource()));
+    table.push_back(string(units->importReference()));
+    table.push_back(uint32_t(units->unitCount()));
+    for (size_t i = 0; i < units->unitCount(); ++i) {
+        std::string reference;
+        std::string prefix;
+        std::string id;
+        double exponent;
+        double multiplier;
+        units->unitAttributes(i, reference, prefix, exponent, multiplier, id);
+        auto &unitTable = mTables[UNIT];
+        unitTable.push_back(string(reference));
+        unitTable.push_back(string(prefix));
+        addDouble(unitTable, exponent);
+        addDouble(unitTable, multiplier);
+        unitTable.push_back(string(id));
+    }
+}
+
+void ModelSnapshotWriter::addComponent(const ComponentPtr &component, uint32_t parent)
+{
+    mComponents.push_back(component);
+    auto reference = uint32_t(mComponents.size());
+    auto &table = mTables[COMPONENTS];
+    table.push_back(string(component->name()));
+    table.push_back(string(component->id()));
+    table.push_back(string(component->encapsulationId()));
+    table.push_back(string(component->math()));
+    table.push_back(importSource(component->importSource()));
+    table.push_back(string(component->importReference()));
+    table.push_back(parent);
+    table.push_back(uint32_t(component->variableCount()));
+    table.push_back(uint32_t(component->resetCount()));
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto variable = component->variable(i);
+        auto &variableTable = mTables[VARIABLES];
+        mVariables.emplace(variable, uint32_t(mVariables.size() + 1));
+        variableTable.push_back(string(variable->name()));
+        variableTable.push_back(string(variable->id()));
+        variableTable.push_back(string((variable->units() != nullptr) ? variable->units()->name() : ""));
+        variableTable.push_back(string(variable->initialValue()));
+        variableTable.push_back(string(variable->interfaceType()));
+    }
+    for (size_t i = 0; i < component->componentCount(); ++i) {
+        addComponent(component->component(i), reference);
+    }
+}
+
+void ModelSnapshotWriter::addResets(const ComponentPtr &component)
+{
+    auto &table = mTables[RESETS];
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        auto reset = component->reset(i);
+        table.push_back(variable(reset->variable()));
+        table.push_back(variable(reset->testVariable()));
+        table.push_back(uint32_t(reset->order()));
+        table.push_back(reset->isOrderSet() ? 1 : 0);
+        table.push_back(string(reset->id()));
+        table.push_back(string(reset->testValue()));
+        table.push_back(string(reset->testValueId()));
+        table.push_back(string(reset->resetValue()));
+        table.push_back(string(reset->resetValueId()));
+    }
+}
+
+void ModelSnapshotWriter::addEquivalences(const VariablePtr &variable, uint32_t reference)
+{
+    // Each equivalence is stored once, with the variable that comes first.
+    // Equivalent variables are stored in the order in which they are held by
+    // that variable, so that reading the snapshot gives us the same order.
+
+    auto &table = mTables[EQUIVALENCES];
+    for (size_t i = 0; i < variable->equivalentVariableCount(); ++i) {
+        auto equivalentVariable = variable->equivalentVariable(i);
+        auto equivalentReference = this->variable(equivalentVariable);
+        if (equivalentReference > reference) {
+            table.push_back(reference);
+            table.push_back(equivalentReference);
+            table.push_back(string(Variable::equivalenceMappingId(variable, equivalentVariable)));
+            table.push_back(string(Variable::equivalenceConnectionId(variable, equivalentVariable)));
+        }
+    }
+}
+
+std::string ModelSnapshotWriter::write(const ModelPtr &model)
+{
+    string("");
+    uint32_t header[HEADER_WORD_COUNT] = {};
+    header[VERSION_WORD] = MODEL_SNAPSHOT_VERSION;
+    header[BYTE_ORDER_MARK_WORD] = BYTE_ORDER_MARK;
+    header[MODEL_WORD] = string(model->name());
+    header[MODEL_WORD + 1] = string(model->id());
+    header[MODEL_WORD + 2] = string(model->encapsulationId());
+
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        addUnits(model->units(i));
+    }
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        addComponent(model->component(i), 0);
+    }
+    for (const auto &component : mComponents) {
+        addResets(component);
+    }
+    std::vector<VariablePtr> variables(mVariables.size());
+    for (const auto &variable : mVariables) {
+        variables.at(variable.second - 1) = variable.first;
+    }
+    for (size_t i = 0; i < variables.size(); ++i) {
+        addEquivalences(variables.at(i), uint32_t(i + 1));
+    }
+
+    size_t offset = HEADER_SIZE;
+    for (size_t i = 0; i < TABLE_COUNT; ++i) {
+        header[TABLES_WORD + 2 * i] = uint32_t(offset);
+        header[TABLES_WORD + 2 * i + 1] = uint32_t(mTables[i].size() / recordSizes[i]);
+        offset += 4 * mTables[i].size();
+    }
+    header[STRING_DATA_WORD] = uint32_t(offset);
+    header[STRING_DATA_WORD + 1] = uint32_t(mStringData.size());
+
+    std::string res;
+    res.reserve(offset + mStringData.size());
+    res.append(MAGIC, sizeof(MAGIC));
+    res.append(reinterpret_cast<const char *>(header), sizeof(header));
+    for (const auto &table : mTables) {
+        res.append(reinterpret_cast<const char *>(table.data()), 4 * table.size());
+    }
+    res += mStringData;
+
+    return res;
+}
+
+std::string writeModelSnapshot(const ModelPtr &model)
+{
+    ModelSnapshotWriter writer;
+
+    return writer.write(model);
+}
+
+/**
+ * @brief The ModelSnapshotReader class.
+ *
+ * The ModelSnapshotReader class checks a model snapshot and reads it into a
+ * model. Words are read from the snapshot in place, whatever its alignment.
+ */
+class ModelSnapshotReader
+{
+public:
+    ModelSnapshotReader(const char *data, size_t size);
+
+    ModelSnapshotStatus check(unsigned int &version);
+    void read(const ModelPtr &model) const;
+
+private:
+    const char *mData; /**< The snapshot. */
+    size_t mSize; /**< The size of the snapshot. */
+    size_t mOffsets[TABLE_COUNT] = {}; /**< The offset of each table. */
+    size_t mCounts[TABLE_COUNT] = {}; /**< The number of records of each table. */
+    size_t mStringDataOffset = 0; /**< The offset of the string data. */
+
+    uint32_t word(size_t offset) const;
+    uint32_t headerWord(size_t index) const;
+    uint32_t field(Table table, size_t record, size_t field) const;
+    double doubleField(Table table, size_t record, size_t field) const;
+    bool isString(uint32_t index) const;
+    bool isReference(uint32_t reference, Table table) const;
+    bool checkStrings(Table table, const std::vector<size_t> &fields) const;
+    bool checkRecords() const;
+};
+
+ModelSnapshotReader::ModelSnapshotReader(const char *data, size_t size)
+    : mData(data)
+    , mSize(size)
+{
+}
+
+uint32_t ModelSnapshotReader::word(size_t offset) const
+{
+    uint32_t res;
+    std::memcpy(&res, mData + offset, sizeof(res));
+    return res;
+}
+
+uint32_t ModelSnapshotReader::headerWord(size_t index) const
+{
+    return word(sizeof(MAGIC) + 4 * index);
+}
+
+uint32_t ModelSnapshotReader::field(Table table, size_t record, size_t field) const
+{
+    return word(mOffsets[table] + 4 * (record * recordSizes[table] + field));
+}
+
+double ModelSnapshotReader::doubleField(Table table, size_t record, size_t field) const
+{
+    double res;
+    std::memcpy(&res, mData + mOffsets[table] + 4 * (record * recordSizes[table] + field), sizeof(res));
+    return res;
+}
+
+bool ModelSnapshotReader::isString(uint32_t index) const
+{
+    return index < mCounts[STRINGS];
+}
+
+bool ModelSnapshotReader::isReference(uint32_t reference, Table table) const
+{
+    return reference <= mCounts[table];
+}
+
+bool ModelSnapshotReader::checkStrings(Table table, const std::vector<size_t> &fields) const
+{
+    for (size_t i = 0; i < mCounts[table]; ++i) {
+        for (auto f : fields) {
+            if (!isString(field(table, i, f))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool ModelSnapshotReader::checkRecords() const
+{
+    if (!isString(headerWord(MODEL_WORD))
+        || !isString(headerWord(MODEL_WORD + 1))
+        || !isString(headerWord(MODEL_WORD + 2))
+        || !checkStrings(IMPORT_SOURCES, {0, 1})
+        || !checkStrings(UNITS, {0, 1, 3})
+        || !checkStrings(UNIT, {0, 1, 6})
+        || !checkStrings(COMPONENTS, {0, 1, 2, 3, 5})
+        || !checkStrings(VARIABLES, {0, 1, 2, 3, 4})
+        || !checkStrings(RESETS, {4, 5, 6, 7, 8})
+        || !checkStrings(EQUIVALENCES, {2, 3})) {
+        return false;
+    }
+
+    size_t unitCount = 0;
+    for (size_t i = 0; i < mCounts[UNITS]; ++i) {
+        if (!isReference(field(UNITS, i, 2), IMPORT_SOURCES)) {
+            return false;
+        }
+        unitCount += field(UNITS, i, 4);
+    }
+
+    // A component must come after its parent.
+
+    size_t variableCount = 0;
+    size_t resetCount = 0;
+    for (size_t i = 0; i < mCounts[COMPONENTS]; ++i) {
+        if (!isReference(field(COMPONENTS, i, 4), IMPORT_SOURCES)
+            || (field(COMPONENTS, i, 6) > i)) {
+            return false;
+        }
+        variableCount += field(COMPONENTS, i, 7);
+        resetCount += field(COMPONENTS, i, 8);
+    }
+
+    for (size_t i = 0; i < mCounts[RESETS]; ++i) {
+        if (!isReference(field(RESETS, i, 0), VARIABLES)
+            || !isReference(field(RESETS, i, 1), VARIABLES)) {
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < mCounts[EQUIVALENCES]; ++i) {
+        auto variable1 = field(EQUIVALENCES, i, 0);
+        auto variable2 = field(EQUIVALENCES, i, 1);
+        if ((variable1 == 0) || (variable2 == 0)
+            || !isReference(variable1, VARIABLES)
+            || !isReference(variable2, VARIABLES)) {
+            return false;
+        }
+    }
+
+    return (unitCount == mCounts[UNIT])
+           && (variableCount == mCounts[VARIABLES])
+           && (resetCount == mCounts[RESETS]);
+}
+
+ModelSnapshotStatus ModelSnapshotReader::check(unsigned int &version)
+{
+    if ((mSize < HEADER_SIZE)
+        || (std::memcmp(mData, MAGIC, sizeof(MAGIC)) != 0)
+        || (headerWord(BYTE_ORDER_MARK_WORD) != BYTE_ORDER_MARK)) {
+        return ModelSnapshotStatus::INVALID;
+    }
+
+    version = headerWord(VERSION_WORD);
+    if (version != MODEL_SNAPSHOT_VERSION) {
+        return ModelSnapshotStatus::UNSUPPORTED_VERSION;
+    }
+
+    // Make sure that the tables and the string data are within the snapshot
+    // before accessing any of them.
+
+    for (size_t i = 0; i < TABLE_COUNT; ++i) {
+        uint64_t offset = headerWord(TABLES_WORD + 2 * i);
+        uint64_t count = headerWord(TABLES_WORD + 2 * i + 1);
+        if ((offset < HEADER_SIZE) || (offset % 4 != 0)
+            || (offset + 4 * count * recordSizes[i] > mSize)) {
+            return ModelSnapshotStatus::INVALID;
+        }
+        mOffsets[i] = size_t(offset);
+        mCounts[i] = size_t(count);
+    }
+
+    uint64_t stringDataOffset = headerWord(STRING_DATA_WORD);
+    uint64_t stringDataSize = headerWord(STRING_DATA_WORD + 1);
+    if ((mCounts[STRINGS] == 0)
+        || (stringDataOffset + stringDataSize > mSize)) {
+        return ModelSnapshotStatus::INVALID;
+    }
+    for (size_t i = 0; i < mCounts[STRINGS]; ++i) {
+        if (uint64_t(field(STRINGS, i, 0)) + field(STRINGS, i, 1) > stringDataSize) {
+            return ModelSnapshotStatus::INVALID;
+        }
+    }
+    mStringDataOffset = size_t(stringDataOffset);
+
+    return checkRecords() ? ModelSnapshotStatus::OK : ModelSnapshotStatus::INVALID;
+}
+
+void ModelSnapshotReader::read(const ModelPtr &model) const
+{
+    std::vector<std::string> strings;
+    strings.reserve(mCounts[STRINGS]);
+    for (size_t i = 0; i < mCounts[STRINGS]; ++i) {
+        strings.emplace_back(mData + mStringDataOffset + field(STRINGS, i, 0), field(STRINGS, i, 1));
+    }
+
+    model->setName(strings.at(headerWord(MODEL_WORD)));
+    model->setId(strings.at(headerWord(MODEL_WORD + 1)));
+    model->setEncapsulationId(strings.at(headerWord(MODEL_WORD + 2)));
+
+    std::vector<ImportSourcePtr> importSources;
+    for (size_t i = 0; i < mCounts[IMPORT_SOURCES]; ++i) {
+        auto importSource = ImportSource::create();
+        importSource->setUrl(strings.at(field(IMPORT_SOURCES, i, 0)));
+        importSource->setId(strings.at(field(IMPORT_SOURCES, i, 1)));
+        importSources.push_back(importSource);
+    }
+
+    size_t unit = 0;
+    for (size_t i = 0; i < mCounts[UNITS]; ++i) {
+        auto units = Units::create(strings.at(field(UNITS, i, 0)));
+        units->setId(strings.at(field(UNITS, i, 1)));
+        auto importSource = field(UNITS, i, 2);
+        if (importSource != 0) {
+            units->setImportSource(importSources.at(importSource - 1));
+            units->setImportReference(strings.at(field(UNITS, i, 3)));
+        }
+        for (size_t j = 0; j < field(UNITS, i, 4); ++j, ++unit) {
+            units->addUnit(strings.at(field(UNIT, unit, 0)),
+                           strings.at(field(UNIT, unit, 1)),
+                           doubleField(UNIT, unit, 2),
+                           doubleField(UNIT, unit, 4),
+                           strings.at(field(UNIT, unit, 6)));
+        }
+        model->addUnits(units);
+    }
+
+    std::vector<ComponentPtr> components;
+    std::vector<VariablePtr> variables;
+    for (size_t i = 0; i < mCounts[COMPONENTS]; ++i) {
+        auto component = Component::create(strings.at(field(COMPONENTS, i, 0)));
+        component->setId(strings.at(field(COMPONENTS, i, 1)));
+        component->setEncapsulationId(strings.at(field(COMPONENTS, i, 2)));
+        component->setMath(strings.at(field(COMPONENTS, i, 3)));
+        auto importSource = field(COMPONENTS, i, 4);
+        if (importSource != 0) {
+            component->setImportSource(importSources.at(importSource - 1));
+            component->setImportReference(strings.at(field(COMPONENTS, i, 5)));
+        }
+        for (size_t j = 0; j < field(COMPONENTS, i, 7); ++j) {
+            auto index = variables.size();
+            auto variable = Variable::create(strings.at(field(VARIABLES, index, 0)));
+            variable->setId(strings.at(field(VARIABLES, index, 1)));
+            const auto &units = strings.at(field(VARIABLES, index, 2));
+            if (!units.empty()) {
+                variable->setUnits(units);
+            }
+            variable->setInitialValue(strings.at(field(VARIABLES, index, 3)));
+            variable->setInterfaceType(strings.at(field(VARIABLES, index, 4)));
+            component->addVariable(variable);
+            variables.push_back(variable);
+        }
+        auto parent = field(COMPONENTS, i, 6);
+        if (parent == 0) {
+            model->addComponent(component);
+        } else {
+            components.at(parent - 1)->addComponent(component);
+        }
+        components.push_back(component);
+    }
+
+    size_t reset = 0;
+    for (size_t i = 0; i < mCounts[COMPONENTS]; ++i) {
+        for (size_t j = 0; j < field(COMPONENTS, i, 8); ++j, ++reset) {
+            auto newReset = Reset::create();
+            auto variable = field(RESETS, reset, 0);
+            if (variable != 0) {
+                newReset->setVariable(variables.at(variable - 1));
+            }
+            auto testVariable = field(RESETS, reset, 1);
+            if (testVariable != 0) {
+                newReset->setTestVariable(variables.at(testVariable - 1));
+            }
+            if (field(RESETS, reset, 3) != 0) {
+                newReset->setOrder(int(field(RESETS, reset, 2)));
+            }
+            newReset->setId(strings.at(field(RESETS, reset, 4)));
+            newReset->setTestValue(strings.at(field(RESETS, reset, 5)));
+            newReset->setTestValueId(strings.at(field(RESETS, reset, 6)));
+            newReset->setResetValue(strings.at(field(RESETS, reset, 7)));
+            newReset->setResetValueId(strings.at(field(RESETS, reset, 8)));
+            components.at(i)->addReset(newReset);
+        }
+    }
+
+    for (size_t i = 0; i < mCounts[EQUIVALENCES]; ++i) {
+        Variable::addEquivalence(variables.at(field(EQUIVALENCES, i, 0) - 1),
+                                 variables.at(field(EQUIVALENCES, i, 1) - 1),
+                                 strings.at(field(EQUIVALENCES, i, 2)),
+                                 strings.at(field(EQUIVALENCES, i, 3)));
+    }
+
+    model->linkUnits();
+}
+
+ModelSnapshotStatus readModelSnapshot(const ModelPtr &model, const char *data, size_t size, unsigned int &version)
+{
+    ModelSnapshotReader reader(data, size);
+    auto res = reader.check(version);
+    if (res == ModelSnapshotStatus::OK) {
+        reader.read(model);
+    }
+    return res;
+}
+
+} // namespace libcellml
@@ -0,0 +1,86 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "libcellml/types.h"
+
+namespace libcellml {
+
+/**
+ * @brief The version of the model snapshot format.
+ *
+ * The version of the model snapshot format, which must be incremented
+ * whenever the format changes.
+ */
+static const unsigned int MODEL_SNAPSHOT_VERSION = 1;
+
+/**
+ * @brief The status of reading a model snapshot.
+ *
+ * The status of reading a model snapshot, i.e. whether the snapshot could be
+ * read, was invalid or was written using an unsupported version of the model
+ * snapshot format.
+ */
+enum class ModelSnapshotStatus
+{
+    OK,
+    INVALID,
+    UNSUPPORTED_VERSION
+};
+
+/**
+ * @brief Write a snapshot of the given @p model.
+ *
+ * Write a binary snapshot of the given @p model. A snapshot consists of a
+ * header followed by tables of fixed-size records made of 32-bit words, in
+ * the native byte order. Records refer to strings and to other records by
+ * their index in the corresponding table, and tables are located using
+ * offsets relative to the start of the snapshot, so that a snapshot can be
+ * read in place, e.g. from a memory mapped file.
+ *
+ * Strings are only stored once, no matter how many entities use them. Math
+ * is stored as it is held by components and resets. Imported models are not
+ * part of a snapshot, only their import sources are.
+ *
+ * @param model The @c ModelPtr to write a snapshot of.
+ *
+ * @return The snapshot as a @c std::string of bytes.
+ */
+std::string writeModelSnapshot(const ModelPtr &model);
+
+/**
+ * @brief Read a model snapshot.
+ *
+ * Read the model snapshot held in the @p size bytes of @p data into
+ * @p model, which is expected to be empty. The whole snapshot is checked
+ * before @p model gets populated, so @p model is left untouched if the
+ * snapshot is invalid or was written using an unsupported version of the
+ * model snapshot format.
+ *
+ * @param model The @c ModelPtr to populate.
+ * @param data The snapshot to read.
+ * @param size The size of the snapshot.
+ * @param version The version of the model snapshot format used by the
+ * snapshot, if known.
+ *
+ * @return The @c ModelSnapshotStatus of reading the snapshot.
+ */
+ModelSnapshotStatus readModelSnapshot(const ModelPtr &model, const char *data, size_t size, unsigned int &version);
+
+} // namespace libcellml
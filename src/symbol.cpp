@@ -0,0 +1,201 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "symbol.h"
+
+#include <atomic>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+
+namespace libcellml {
+
+struct InternShard;
+
+/**
+ * @brief The SymbolEntry struct.
+ *
+ * An entry of the intern table, i.e. an interned string together with the
+ * number of symbols which refer to it.
+ */
+struct SymbolEntry
+{
+    const std::string *mString = nullptr; /**< The interned string, i.e. the key of this entry in its shard. */
+    InternShard *mShard = nullptr; /**< The shard to which this entry belongs. */
+    std::atomic<size_t> mReferenceCount {0}; /**< The number of symbols which refer to this entry. */
+};
+
+/**
+ * @brief The InternShard struct.
+ *
+ * A shard of the process-wide table of interned strings. Elements of an
+ * @c std::unordered_map keep their address when the map grows, which is what
+ * makes them usable as symbol ids. Strings are spread over several shards, each
+ * with its own mutex, so that threads interning different strings rarely wait
+ * for one another.
+ */
+struct InternShard
+{
+    std::mutex mMutex; /**< Mutex guarding the entries. */
+    std::unordered_map<std::string, SymbolEntry> mEntries; /**< The entries of this shard. */
+};
+
+static const size_t INTERN_SHARD_COUNT = 16;
+
+/**
+ * @brief Get the intern shard for the given @p string.
+ *
+ * Get the shard of the process-wide intern table in which @p string is to be
+ * interned. The shards are created the first time they are needed and are
+ * never destroyed, so that symbols remain valid even while static objects are
+ * being destroyed.
+ *
+ * @param string The @c std::string to intern.
+ *
+ * @return The intern shard for @p string.
+ */
+static InternShard &internShard(const std::string &string)
+{
+    static auto shards = new InternShard[INTERN_SHARD_COUNT];
+
+    return shards[std::hash<std::string>()(string) % INTERN_SHARD_COUNT];
+}
+
+/**
+ * @brief Add a reference to the given @p entry.
+ *
+ * Add a reference to @p entry, if any. A symbol which is being copied holds a
+ * reference to its entry, so the entry cannot be released in the meantime and
+ * no locking is needed.
+ *
+ * @param entry The @c SymbolEntry to reference.
+ */
+static void addReference(SymbolEntry *entry)
+{
+    if (entry != nullptr) {
+        entry->mReferenceCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Remove a reference to the given @p entry.
+ *
+ * Remove a reference to @p entry, if any, and release @p entry if it was the
+ * last one. Only the last reference requires locking the shard of @p entry,
+ * so that @p entry cannot be looked up while it is being released.
+ *
+ * @param entry The @c SymbolEntry to dereference.
+ */
+static void removeReference(SymbolEntry *entry)
+{
+    if (entry == nullptr) {
+        return;
+    }
+
+    size_t referenceCount = entry->mReferenceCount.load(std::memory_order_relaxed);
+
+    while (referenceCount > 1) {
+        if (entry->mReferenceCount.compare_exchange_weak(referenceCount, referenceCount - 1, std::memory_order_acq_rel)) {
+            return;
+        }
+    }
+
+    InternShard *shard = entry->mShard;
+    std::lock_guard<std::mutex> lock(shard->mMutex);
+
+    if (entry->mReferenceCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        shard->mEntries.erase(shard->mEntries.find(*entry->mString));
+    }
+}
+
+Symbol::Symbol(const std::string &string)
+{
+    if (string.empty()) {
+        return;
+    }
+
+    auto &shard = internShard(string);
+    std::lock_guard<std::mutex> lock(shard.mMutex);
+    auto entry = shard.mEntries.emplace(std::piecewise_construct, std::forward_as_tuple(string), std::forward_as_tuple()).first;
+
+    if (entry->second.mString == nullptr) {
+        entry->second.mString = &entry->first;
+        entry->second.mShard = &shard;
+    }
+
+    mEntry = &entry->second;
+
+    addReference(mEntry);
+}
+
+Symbol::Symbol(const Symbol &rhs) noexcept
+    : mEntry(rhs.mEntry)
+{
+    addReference(mEntry);
+}
+
+Symbol::Symbol(Symbol &&rhs) noexcept
+    : mEntry(rhs.mEntry)
+{
+    rhs.mEntry = nullptr;
+}
+
+Symbol::~Symbol()
+{
+    removeReference(mEntry);
+}
+
+Symbol &Symbol::operator=(Symbol rhs) noexcept
+{
+    swap(rhs);
+
+    return *this;
+}
+
+void Symbol::swap(Symbol &rhs) noexcept
+{
+    std::swap(mEntry, rhs.mEntry);
+}
+
+const std::string &Symbol::string() const
+{
+    static const std::string emptyString;
+
+    return (mEntry != nullptr) ? *mEntry->mString : emptyString;
+}
+
+size_t Symbol::id() const
+{
+    return reinterpret_cast<size_t>(mEntry);
+}
+
+bool Symbol::empty() const
+{
+    return mEntry == nullptr;
+}
+
+bool Symbol::operator==(const Symbol &rhs) const
+{
+    return mEntry == rhs.mEntry;
+}
+
+bool Symbol::operator!=(const Symbol &rhs) const
+{
+    return mEntry != rhs.mEntry;
+}
+
+} // namespace libcellml
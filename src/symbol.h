@@ -0,0 +1,173 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace libcellml {
+
+struct SymbolEntry;
+
+/**
+ * @brief The Symbol class.
+ *
+ * The Symbol class is an interned string. All the symbols created from equal
+ * strings refer to the same entry of a process-wide intern table, so a string
+ * which is used by many entities is only stored once and comparing two
+ * symbols only requires comparing their ids. Entries of the intern table are
+ * reference counted and released together with the last symbol that refers to
+ * them.
+ */
+class Symbol
+{
+public:
+    /**
+     * @brief Create an empty symbol.
+     *
+     * Create a symbol for the empty string.
+     */
+    Symbol() = default;
+
+    /**
+     * @brief Create a copy of the given @p rhs symbol.
+     *
+     * Create a symbol which refers to the same entry as @p rhs.
+     *
+     * @param rhs The @c Symbol to copy.
+     */
+    Symbol(const Symbol &rhs) noexcept;
+
+    /**
+     * @brief Move the given @p rhs symbol.
+     *
+     * Create a symbol which takes over the entry of @p rhs, leaving @p rhs
+     * empty.
+     *
+     * @param rhs The @c Symbol to move.
+     */
+    Symbol(Symbol &&rhs) noexcept;
+
+    /**
+     * @brief Destroy this symbol.
+     *
+     * Destroy this symbol, releasing its entry of the intern table if no other
+     * symbol refers to it.
+     */
+    ~Symbol();
+
+    /**
+     * @brief Assign the given @p rhs symbol to this symbol.
+     *
+     * @param rhs The @c Symbol to assign.
+     *
+     * @return This @c Symbol.
+     */
+    Symbol &operator=(Symbol rhs) noexcept;
+
+    /**
+     * @brief Create a symbol for the given @p string.
+     *
+     * Create a symbol for @p string, adding @p string to the intern table if
+     * it is not already in it.
+     *
+     * @param string The @c std::string to intern.
+     */
+    explicit Symbol(const std::string &string);
+
+    /**
+     * @brief Get the string of this symbol.
+     *
+     * Get the string of this symbol.
+     *
+     * @return The @c std::string of this symbol.
+     */
+    const std::string &string() const;
+
+    /**
+     * @brief Get the id of this symbol.
+     *
+     * Get the id of this symbol. Two symbols have the same id if, and only if,
+     * they were created from equal strings. The id of the empty symbol is
+     * zero. The id of a string may change once all the symbols created from
+     * it have been destroyed.
+     *
+     * @return The id of this symbol.
+     */
+    size_t id() const;
+
+    /**
+     * @brief Swap this symbol with the given @p rhs symbol.
+     *
+     * @param rhs The @c Symbol to swap with.
+     */
+    void swap(Symbol &rhs) noexcept;
+
+    /**
+     * @brief Test whether this symbol is empty.
+     *
+     * Test whether this symbol is for the empty string.
+     *
+     * @return @c true if this symbol is empty, @c false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Test whether this symbol is equal to @p rhs.
+     *
+     * @param rhs The @c Symbol to compare with.
+     *
+     * @return @c true if both symbols were created from equal strings,
+     * @c false otherwise.
+     */
+    bool operator==(const Symbol &rhs) const;
+
+    /**
+     * @brief Test whether this symbol is different from @p rhs.
+     *
+     * @param rhs The @c Symbol to compare with.
+     *
+     * @return @c true if both symbols were created from different strings,
+     * @c false otherwise.
+     */
+    bool operator!=(const Symbol &rhs) const;
+
+private:
+    SymbolEntry *mEntry = nullptr; /**< Entry of the intern table, @c nullptr for the empty string. */
+};
+
+} // namespace libcellml
+
+namespace std {
+
+/**
+ * @brief Hash function for a @c libcellml::Symbol.
+ *
+ * Hash function for a @c libcellml::Symbol, so that symbols can be used as
+ * keys of unordered containers.
+ */
+template<>
+struct hash<libcellml::Symbol>
+{
+    size_t operator()(const libcellml::Symbol &symbol) const
+    {
+        return std::hash<size_t>()(symbol.id());
+    }
+};
+
+} // namespace std
@@ -14,6 +14,7 @@ See the License for the specific language governing permissions and
 limitations under the License.
 */
 
+#include "symbol.h"
 #include "utilities.h"
 
 #include "libcellml/importsource.h"
@@ -104,8 +105,8 @@ static const std::map<Units::StandardUnit, const std::string> standardUnitToStri
  */
 struct Unit
 {
-    std::string mReference; /**< Reference to the units for the unit.*/
-    std::string mPrefix; /**< String expression of the prefix for the unit.*/
+    Symbol mReference; /**< Reference to the units for the unit.*/
+    Symbol mPrefix; /**< String expression of the prefix for the unit.*/
     std::string mExponent; /**< Exponent for the unit.*/
     std::string mMultiplier; /**< Multiplier for the unit.*/
     std::string mId; /**< Id for the unit.*/
@@ -125,8 +126,9 @@ struct Units::UnitsImpl
 
 std::vector<Unit>::iterator Units::UnitsImpl::findUnit(const std::string &reference)
 {
+    Symbol symbol(reference);
     return std::find_if(mUnits.begin(), mUnits.end(),
-                        [=](const Unit &u) -> bool { return u.mReference == reference; });
+                        [=](const Unit &u) -> bool { return u.mReference == symbol; });
 }
 
 /**
@@ -141,13 +143,16 @@ std::vector<Unit>::iterator Units::UnitsImpl::findUnit(const std::string &refere
  * @param uExp The exponential of the units.
  * @param logMult The log multiplier of the units.
  * @param direction The direction to update multiplier. Either 1 or -1.
+ * @param history The units being travelled through, so that cyclic units
+ * are not travelled through forever.
  *
  * @return Either @c true or @c false, depending if the units were successfully updated.
  */
 bool updateUnitMultiplier(double &multiplier,
                           const UnitsPtr &units,
                           double uExp, double logMult,
-                          int direction)
+                          int direction,
+                          std::vector<const Units *> &history)
 {
     bool updated = false;
     auto unitsName = units->name();
@@ -175,10 +180,13 @@ bool updateUnitMultiplier(double &multiplier,
                 auto model = owningModel(units);
                 if (model != nullptr) {
                     auto refUnits = model->units(ref);
-                    if ((refUnits == nullptr) || refUnits->isImport()) {
+                    if ((refUnits == nullptr) || refUnits->isImport()
+                        || (std::find(history.begin(), history.end(), refUnits.get()) != history.end())) {
                         return false;
                     }
-                    updated = updateUnitMultiplier(multiplier, refUnits, exp * uExp, logMult + mult * uExp + standardPrefixList.at(pre) * uExp, direction);
+                    history.push_back(refUnits.get());
+                    updated = updateUnitMultiplier(multiplier, refUnits, exp * uExp, logMult + mult * uExp + standardPrefixList.at(pre) * uExp, direction, history);
+                    history.pop_back();
                 }
             }
         }
@@ -234,17 +242,17 @@ void Units::addUnit(const std::string &reference, const std::string &prefix, dou
                     double multiplier, const std::string &id)
 {
     Unit u;
-    u.mReference = reference;
+    u.mReference = Symbol(reference);
     // Allow all nonzero user-specified prefixes
     try {
         int prefixInteger = std::stoi(prefix);
         if (prefixInteger != 0.0) {
-            u.mPrefix = prefix;
+            u.mPrefix = Symbol(prefix);
         }
     } catch (std::invalid_argument &) {
-        u.mPrefix = prefix;
+        u.mPrefix = Symbol(prefix);
     } catch (std::out_of_range &) {
-        u.mPrefix = prefix;
+        u.mPrefix = Symbol(prefix);
     }
     if (exponent != 1.0) {
         u.mExponent = convertToString(exponent);
@@ -256,6 +264,7 @@ void Units::addUnit(const std::string &reference, const std::string &prefix, dou
         u.mId = id;
     }
     mPimpl->mUnits.push_back(u);
+    markAsModified();
 }
 
 void Units::addUnit(const std::string &reference, Prefix prefix, double exponent,
@@ -339,8 +348,8 @@ void Units::unitAttributes(size_t index, std::string &reference, std::string &pr
     if (index < mPimpl->mUnits.size()) {
         u = mPimpl->mUnits.at(index);
     }
-    reference = u.mReference;
-    prefix = u.mPrefix;
+    reference = u.mReference.string();
+    prefix = u.mPrefix.string();
     if (!u.mExponent.empty()) {
         exponent = std::stod(u.mExponent);
     } else {
@@ -360,6 +369,7 @@ bool Units::removeUnit(const std::string &reference)
     auto result = mPimpl->findUnit(reference);
     if (result != mPimpl->mUnits.end()) {
         mPimpl->mUnits.erase(result);
+        markAsModified();
         status = true;
     }
 
@@ -371,6 +381,7 @@ bool Units::removeUnit(size_t index)
     bool status = false;
     if (index < mPimpl->mUnits.size()) {
         mPimpl->mUnits.erase(mPimpl->mUnits.begin() + int64_t(index));
+        markAsModified();
         status = true;
     }
 
@@ -386,6 +397,7 @@ bool Units::removeUnit(StandardUnit standardRef)
 void Units::removeAllUnits()
 {
     mPimpl->mUnits.clear();
+    markAsModified();
 }
 
 void Units::setSourceUnits(const ImportSourcePtr &importSource, const std::string &name)
@@ -408,8 +420,11 @@ double Units::scalingFactor(const UnitsPtr &units1, const UnitsPtr &units2)
         if ((units1->unitCount() != 0) && (units2->unitCount() != 0)) {
             double multiplier = 0.0;
 
-            updateUnits1 = updateUnitMultiplier(multiplier, units2, 1, 0, 1);
-            updateUnits2 = updateUnitMultiplier(multiplier, units1, 1, 0, -1);
+            std::vector<const Units *> history = {units2.get()};
+
+            updateUnits1 = updateUnitMultiplier(multiplier, units2, 1, 0, 1, history);
+            history = {units1.get()};
+            updateUnits2 = updateUnitMultiplier(multiplier, units1, 1, 0, -1, history);
 
             if (updateUnits1 && updateUnits2) {
                 return std::pow(10, multiplier);
@@ -426,7 +441,7 @@ double Units::scalingFactor(const UnitsPtr &units1, const UnitsPtr &units2)
 
 using UnitsMap = std::map<std::string, double>;
 
-void updateUnitsMap(const UnitsPtr &units, UnitsMap &unitsMap, double exp = 1.0)
+void updateUnitsMap(const UnitsPtr &units, UnitsMap &unitsMap, std::vector<const Units *> &history, double exp = 1.0)
 {
     if (units->isBaseUnit()) {
         auto found = unitsMap.find(units->name());
@@ -456,11 +471,14 @@ void updateUnitsMap(const UnitsPtr &units, UnitsMap &unitsMap, double exp = 1.0)
                 auto model = owningModel(units);
                 if (model != nullptr) {
                     auto refUnits = model->units(ref);
-                    if ((refUnits == nullptr) || refUnits->isImport()) {
+                    if ((refUnits == nullptr) || refUnits->isImport()
+                        || (std::find(history.begin(), history.end(), refUnits.get()) != history.end())) {
                         unitsMap.clear();
                         break;
                     }
-                    updateUnitsMap(refUnits, unitsMap, exp);
+                    history.push_back(refUnits.get());
+                    updateUnitsMap(refUnits, unitsMap, history, exp);
+                    history.pop_back();
                 }
             }
         }
@@ -470,7 +488,8 @@ void updateUnitsMap(const UnitsPtr &units, UnitsMap &unitsMap, double exp = 1.0)
 UnitsMap createUnitsMap(const UnitsPtr &units)
 {
     UnitsMap unitsMap;
-    updateUnitsMap(units, unitsMap);
+    std::vector<const Units *> history = {units.get()};
+    updateUnitsMap(units, unitsMap, history);
     return unitsMap;
 }
 
@@ -28,6 +28,11 @@ limitations under the License.
 #include "libcellml/component.h"
 #include "libcellml/model.h"
 #include "libcellml/namedentity.h"
+#include "libcellml/reset.h"
+#include "libcellml/units.h"
+#include "libcellml/variable.h"
+
+#include "componentmath.h"
 
 namespace libcellml {
 
@@ -404,6 +409,17 @@ std::string sha1(const std::string &string)
     return result.str();
 }
 
+std::string sha1(const std::vector<std::string> &strings)
+{
+    std::string string;
+
+    for (const auto &s : strings) {
+        string += std::to_string(s.size()) + ":" + s;
+    }
+
+    return sha1(string);
+}
+
 std::string entityName(const EntityPtr &entity)
 {
     std::string name;
@@ -442,19 +458,74 @@ void removeComponentFromEntity(const EntityPtr &entity, const ComponentPtr &comp
     componentEntity->removeComponent(component, false);
 }
 
-size_t getVariableIndexInComponent(const ComponentPtr &component, const VariablePtr &variable)
+VariablePtr cloneVariable(const Variable &variable, const UnitsCopyMap &unitsCopies)
+{
+    auto v = Variable::create();
+    auto units = variable.units();
+
+    if (units != nullptr) {
+        auto unitsCopy = unitsCopies.find(units.get());
+        v->setUnits((unitsCopy != unitsCopies.end()) ? unitsCopy->second : units->clone());
+    }
+    v->setInitialValue(variable.initialValue());
+    v->setInterfaceType(variable.interfaceType());
+    v->setId(variable.id());
+    v->setName(variable.name());
+
+    return v;
+}
+
+static VariablePtr resetVariableCopy(const VariablePtr &variable, const ComponentPtr &componentCopy, const VariableCopyMap &variableCopies)
+{
+    // Only the variables of the component itself are to be used by its resets.
+
+    if (variable != nullptr) {
+        auto variableCopy = variableCopies.find(variable.get());
+        if ((variableCopy != variableCopies.end()) && (variableCopy->second->parent() == componentCopy)) {
+            return variableCopy->second;
+        }
+    }
+
+    return nullptr;
+}
+
+ComponentPtr cloneComponent(const Component &component, const UnitsCopyMap &unitsCopies, VariableCopyMap &variableCopies)
 {
-    size_t index = 0;
-    bool found = false;
-    while (index < component->variableCount() && !found) {
-        if (component->variable(index) == variable) {
-            found = true;
-        } else {
-            ++index;
+    auto c = Component::create();
+
+    c->setId(component.id());
+    c->setName(component.name());
+    ComponentMath::shareMath(component, c);
+
+    c->setImportSource(component.importSource());
+    c->setImportReference(component.importReference());
+
+    for (size_t index = 0; index < component.variableCount(); ++index) {
+        auto v = component.variable(index);
+        auto vClone = cloneVariable(*v, unitsCopies);
+        c->addVariable(vClone);
+        variableCopies.emplace(v.get(), vClone);
+    }
+
+    for (size_t index = 0; index < component.resetCount(); ++index) {
+        auto r = component.reset(index);
+        auto rClone = r->clone();
+        c->addReset(rClone);
+        auto v = resetVariableCopy(r->variable(), c, variableCopies);
+        if (v != nullptr) {
+            rClone->setVariable(v);
         }
+        auto testVariable = resetVariableCopy(r->testVariable(), c, variableCopies);
+        if (testVariable != nullptr) {
+            rClone->setTestVariable(testVariable);
+        }
+    }
+
+    for (size_t index = 0; index < component.componentCount(); ++index) {
+        c->addComponent(cloneComponent(*component.component(index), unitsCopies, variableCopies));
     }
 
-    return index;
+    return c;
 }
 
 } // namespace libcellml
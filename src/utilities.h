@@ -22,6 +22,8 @@ limitations under the License.
 #include <string>
 #include <vector>
 
+#include "internaltypes.h"
+
 namespace libcellml {
 
 /**
@@ -340,6 +342,21 @@ bool areEqual(double value1, double value2);
  */
 std::string sha1(const std::string &string);
 
+/**
+ * @brief Compute the SHA-1 value of the @p strings list of @c std::string.
+ *
+ * Compute and return the SHA-1 value of the @p strings list of
+ * @c std::string. Each string is prefixed with its length before being
+ * hashed, so that two different lists never hash to the same value simply
+ * because their concatenations are identical.
+ *
+ * @param strings The list of @c std::string values for which we want the
+ * SHA-1 value.
+ *
+ * @return The @c std::string SHA-1 value.
+ */
+std::string sha1(const std::vector<std::string> &strings);
+
 /**
  * @brief Get the name of the entity.
  *
@@ -404,17 +421,36 @@ bool isStandardUnitName(const std::string &name);
 bool isStandardPrefixName(const std::string &name);
 
 /**
- * @brief Get the index of the @p variable in the @p component.
+ * @brief Clone the given @p variable.
+ *
+ * Clone the given @p variable. If the units of @p variable have a copy in
+ * @p unitsCopies then the clone uses that copy, otherwise it uses a clone of
+ * those units.
+ *
+ * @param variable The @c Variable to clone.
+ * @param unitsCopies The copies of the units that are already cloned.
+ *
+ * @return The cloned @c VariablePtr.
+ */
+VariablePtr cloneVariable(const Variable &variable, const UnitsCopyMap &unitsCopies);
+
+/**
+ * @brief Clone the given @p component and the components it encapsulates.
+ *
+ * Clone the given @p component and the components it encapsulates, with
+ * their variables and resets, but without any of their variable
+ * equivalences. The variables of the cloned components are added to
+ * @p variableCopies, so that equivalences can then be rewired using it.
+ *
+ * @sa cloneVariable
  *
- * Searches through the @p component for the @p variable returning the index
- * of the @p variable if it was found.  If the @p variable was not found then
- * the number of variables in the @p component is returned.
+ * @param component The @c Component to clone.
+ * @param unitsCopies The copies of the units that are already cloned.
+ * @param variableCopies The map to which the copies of the variables are
+ * added.
  *
- * @param component The @c ComponentPtr to search for the @c VariablePtr in.
- * @param variable The @c VariablePtr to return the index of.
- * @return The index of the @p variable found in the component.  Returns the
- * number of variables in the component if the variable was not found.
+ * @return The cloned @c ComponentPtr.
  */
-size_t getVariableIndexInComponent(const ComponentPtr &component, const VariablePtr &variable);
+ComponentPtr cloneComponent(const Component &component, const UnitsCopyMap &unitsCopies, VariableCopyMap &variableCopies);
 
 } // namespace libcellml
@@ -18,8 +18,12 @@ limitations under the License.
 
 #include <algorithm>
 #include <cmath>
+#include <functional>
+#include <limits>
 #include <libxml/uri.h>
+#include <map>
 #include <stdexcept>
+#include <unordered_map>
 
 #include "libcellml/component.h"
 #include "libcellml/importsource.h"
@@ -27,12 +31,25 @@ limitations under the License.
 #include "libcellml/reset.h"
 #include "libcellml/units.h"
 #include "libcellml/variable.h"
+#include "componentmath.h"
 #include "namespaces.h"
 #include "utilities.h"
 #include "xmldoc.h"
 
 namespace libcellml {
 
+/**
+ * @brief The ValidationResult struct.
+ *
+ * The errors found when validating part of a model, e.g. a component, together
+ * with the revision of that part and of what it depends on at the time.
+ */
+struct ValidationResult
+{
+    size_t mRevision = 0; /**< The revision of what was validated, or 0 if nothing was validated. */
+    std::vector<ErrorPtr> mErrors; /**< The errors that were found. */
+};
+
 /**
  * @brief The Validator::ValidatorImpl struct.
  *
@@ -41,6 +58,88 @@ namespace libcellml {
 struct Validator::ValidatorImpl
 {
     Validator *mValidator = nullptr;
+    MathMLValidation mMathMLValidation = MathMLValidation::DTD;
+
+    bool mIncremental = false;
+    std::weak_ptr<Model> mModel; /**< The model that was last validated incrementally. */
+    std::string mModelName; /**< The name of that model. */
+    MathMLValidation mModelMathMLValidation = MathMLValidation::DTD; /**< The kind of MathML validation used for that model. */
+    std::vector<const Units *> mModelUnits; /**< The units of that model. */
+    size_t mModelUnitsRevision = 0; /**< The revision of those units. */
+    std::unordered_map<const Component *, ValidationResult> mComponentResults;
+    std::unordered_map<const Component *, ValidationResult> mPreviousComponentResults;
+    ValidationResult mUnitsResult;
+    ValidationResult mConnectionsResult;
+
+    /**
+     * @brief Prepare the incremental validation of the given @p model.
+     *
+     * Forget the results of the previous validation if they cannot be used
+     * for @p model, i.e. if the previous validation was for another model, or
+     * if the name or the units of @p model have been modified since.
+     *
+     * @param model The model to be validated.
+     */
+    void prepareIncrementalValidation(const ModelPtr &model);
+
+    /**
+     * @brief Forget the results of the previous validation.
+     */
+    void clearValidationResults();
+
+    /**
+     * @brief Get the revision of what the validation of the given @p component depends on.
+     *
+     * @param component The component.
+     *
+     * @return The revision of the component, its import source, the units of
+     * its variables, and the variables of its resets.
+     */
+    size_t componentRevision(const ComponentPtr &component) const;
+
+    /**
+     * @brief Get the revision of what the validation of the connections of the given @p model depends on.
+     *
+     * @param model The model.
+     *
+     * @return The revision of the top-level components of the model, and of
+     * the equivalent variables of their variables and of their units.
+     */
+    size_t connectionsRevision(const ModelPtr &model) const;
+
+    /**
+     * @brief Get the result of the previous validation of the given @p component.
+     *
+     * @param component The component.
+     *
+     * @return The result of the previous validation of the component, which
+     * is empty if the component was not validated then.
+     */
+    ValidationResult &componentResult(const ComponentPtr &component);
+
+    /**
+     * @brief Validate part of a model, unless it has not been modified.
+     *
+     * Log the errors of @p result again if @p revision is that of @p result,
+     * i.e. if what @p result is about has not been modified since it was
+     * validated, otherwise call @p validate and keep the errors it logs in
+     * @p result.
+     *
+     * @param result The result of the previous validation.
+     * @param revision The current revision of what is to be validated.
+     * @param validate The function validating what is to be validated.
+     */
+    void validateIncrementally(ValidationResult &result, size_t revision, const std::function<void()> &validate);
+
+    /**
+     * @brief Validate the units of the given @p model.
+     *
+     * Validate the units of @p model, including their imports, and check
+     * that they are not cyclic.
+     *
+     * @param model The model whose units are to be validated.
+     */
+    void validateModelUnits(const ModelPtr &model);
 
     /**
      * @brief Validate the given name is unique in the model.
@@ -169,6 +268,18 @@ struct Validator::ValidatorImpl
      */
     void validateMath(const std::string &input, const ComponentPtr &component);
 
+    /**
+     * @brief Validate the math in the parsed XML @p doc.
+     *
+     * Validate the math in the parsed XML @p doc using the CellML 2.0
+     * Specification and the W3C MathML DTD. Any errors will be logged in the
+     * @c Validator. The @p doc is not modified.
+     *
+     * @param doc The parsed math @c XmlDocPtr to validate.
+     * @param component The component containing the math to be validated.
+     */
+    void validateMath(const XmlDocPtr &doc, const ComponentPtr &component);
+
     /**
      * @brief Traverse the node tree for invalid MathML elements.
      *
@@ -180,7 +291,51 @@ struct Validator::ValidatorImpl
      */
     void validateMathMLElements(const XmlNodePtr &node, const ComponentPtr &component);
 
-    void validateAndCleanCnNode(const XmlNodePtr &node, const ComponentPtr &component);
+    /**
+     * @brief Add a MathML error for the given @p node.
+     *
+     * Add a MathML error, which mentions the name and line number of the given
+     * @p node, to the validator.
+     *
+     * @param node The @c XmlNode the error is about.
+     * @param description The end of the description of the error.
+     * @param component The component the MathML belongs to.
+     */
+    void addMathMLError(const XmlNodePtr &node, const std::string &description, const ComponentPtr &component);
+
+    /**
+     * @brief Get the element children of the given @p node.
+     *
+     * Get the element children of the given @p node, skipping comments and
+     * reporting any non-whitespace text as an error.
+     *
+     * @param node The @c XmlNode to get the element children of.
+     * @param component The component the MathML belongs to.
+     *
+     * @return The element children of the given @p node.
+     */
+    std::vector<XmlNodePtr> mathMLChildren(const XmlNodePtr &node, const ComponentPtr &component);
+
+    /**
+     * @brief Natively validate the MathML @p node.
+     *
+     * Validate, in a single pass, the MathML @p node against the structure of
+     * the subset of MathML supported by CellML 2.0. This is an alternative to
+     * validating the MathML against the W3C MathML DTD. Any errors will be
+     * logged in the @c Validator.
+     *
+     * @param node The @c math @c XmlNode to validate.
+     * @param component The component the MathML belongs to.
+     */
+    void validateMathMLNatively(const XmlNodePtr &node, const ComponentPtr &component);
+
+    void validateMathMLExpression(const XmlNodePtr &node, const ComponentPtr &component);
+    void validateMathMLApply(const XmlNodePtr &node, const ComponentPtr &component);
+    void validateMathMLQualifier(const XmlNodePtr &node, const ComponentPtr &component);
+    void validateMathMLPiecewise(const XmlNodePtr &node, const ComponentPtr &component);
+    void validateMathMLCn(const XmlNodePtr &node, const ComponentPtr &component);
+
+    void validateAndCleanCnNode(const XmlNodePtr &node, const ComponentPtr &component, bool clean);
     void validateAndCleanCiNode(const XmlNodePtr &node, const ComponentPtr &component, const std::vector<std::string> &variableNames);
     bool validateCnUnits(const ComponentPtr &component, const std::string &unitsName, const std::string &textNode);
 
@@ -194,8 +349,9 @@ struct Validator::ValidatorImpl
      * @param node The @c XmlNode to validate CellML entities on and remove @c cellml:units from.
      * @param component The component that the math @c XmlNode @p node is contained within.
      * @param variableNames A @c vector list of the names of variables found within the @p component.
+     * @param clean Whether to remove CellML units from the @p node.
      */
-    void validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const std::vector<std::string> &variableNames);
+    void validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const std::vector<std::string> &variableNames, bool clean = true);
 
     /**
      * @brief Check if the provided @p node is a supported MathML element.
@@ -233,12 +389,14 @@ struct Validator::ValidatorImpl
     * @param standardList Nested map of the conversion between built-in units and the base units they contain
     * @param uExp Exponent of the current unit in its parent.
     * @param direction Specify whether we want to increment (1) or decrement (-1).
+    * @param history The names of the units being investigated, so that cyclic units are not investigated forever.
     */
     void updateBaseUnitCount(const ModelPtr &model,
                              std::map<std::string, double> &unitMap,
                              double &multiplier,
                              const std::string &uName,
-                             double uExp, double logMult, int direction);
+                             double uExp, double logMult, int direction,
+                             std::vector<std::string> &history);
 
     /**
     * @brief Checks dependency hierarchies of units in the model.
@@ -276,10 +434,23 @@ ValidatorPtr Validator::create() noexcept
     return std::shared_ptr<Validator> {new Validator {}};
 }
 
+void Validator::setMathMLValidation(MathMLValidation mathmlValidation)
+{
+    mPimpl->mMathMLValidation = mathmlValidation;
+}
+
+Validator::MathMLValidation Validator::mathmlValidation() const
+{
+    return mPimpl->mMathMLValidation;
+}
+
 void Validator::validateModel(const ModelPtr &model)
 {
     // Clear any pre-existing errors in ths validator instance.
     removeAllErrors();
+    if (mPimpl->mIncremental) {
+        mPimpl->prepareIncrementalValidation(model);
+    }
     // Check for a valid name attribute.
     if (!mPimpl->isCellmlIdentifier(model->name())) {
         ErrorPtr err = Error::create();
@@ -296,6 +467,164 @@ void Validator::validateModel(const ModelPtr &model)
             mPimpl->validateComponentTree(model, component, componentNames);
         }
     }
+    // Check for units in this model and validate any connections / variable
+    // equivalence networks in the model.
+    auto validateUnits = [=]() {
+        mPimpl->validateModelUnits(model);
+    };
+    auto validateConnections = [=]() {
+        mPimpl->validateConnections(model);
+    };
+    if (mPimpl->mIncremental) {
+        mPimpl->validateIncrementally(mPimpl->mUnitsResult, mPimpl->mModelUnitsRevision, validateUnits);
+        mPimpl->validateIncrementally(mPimpl->mConnectionsResult, mPimpl->connectionsRevision(model), validateConnections);
+        mPimpl->mPreviousComponentResults.clear();
+    } else {
+        validateUnits();
+        validateConnections();
+    }
+}
+
+void Validator::setIncremental(bool incremental)
+{
+    mPimpl->mIncremental = incremental;
+    if (!incremental) {
+        mPimpl->clearValidationResults();
+    }
+}
+
+bool Validator::isIncremental() const
+{
+    return mPimpl->mIncremental;
+}
+
+void Validator::ValidatorImpl::prepareIncrementalValidation(const ModelPtr &model)
+{
+    std::vector<const Units *> units;
+    size_t unitsRevision = 0;
+    for (size_t i = 0; i < model->unitsCount(); ++i) {
+        auto u = model->units(i);
+        units.push_back(u.get());
+        unitsRevision = std::max(unitsRevision, u->revision());
+        if (u->importSource() != nullptr) {
+            unitsRevision = std::max(unitsRevision, u->importSource()->revision());
+        }
+    }
+    // The validation of a component may depend on the name and units of its
+    // model, as well as on the kind of MathML validation.
+    if ((mModel.lock() != model)
+        || (mModelName != model->name())
+        || (mModelMathMLValidation != mMathMLValidation)
+        || (mModelUnits != units)
+        || (mModelUnitsRevision != unitsRevision)) {
+        clearValidationResults();
+        mModel = model;
+        mModelName = model->name();
+        mModelMathMLValidation = mMathMLValidation;
+        mModelUnits = units;
+        mModelUnitsRevision = unitsRevision;
+    }
+    // Only keep the results for the components that are still in the model.
+    mPreviousComponentResults.swap(mComponentResults);
+    mComponentResults.clear();
+}
+
+void Validator::ValidatorImpl::clearValidationResults()
+{
+    mModel.reset();
+    mModelUnits.clear();
+    mModelUnitsRevision = 0;
+    mComponentResults.clear();
+    mPreviousComponentResults.clear();
+    mUnitsResult = ValidationResult();
+    mConnectionsResult = ValidationResult();
+}
+
+size_t Validator::ValidatorImpl::componentRevision(const ComponentPtr &component) const
+{
+    size_t revision = component->revision();
+    if (component->importSource() != nullptr) {
+        revision = std::max(revision, component->importSource()->revision());
+    }
+    for (size_t i = 0; i < component->variableCount(); ++i) {
+        auto units = component->variable(i)->units();
+        if (units != nullptr) {
+            revision = std::max(revision, units->revision());
+        }
+    }
+    for (size_t i = 0; i < component->resetCount(); ++i) {
+        auto reset = component->reset(i);
+        for (const auto &variable : {reset->variable(), reset->testVariable()}) {
+            if (variable != nullptr) {
+                revision = std::max(revision, variable->revision());
+                if (variable->hasParent()) {
+                    revision = std::max(revision, variable->parent()->revision());
+                }
+            }
+        }
+    }
+
+    return revision;
+}
+
+size_t Validator::ValidatorImpl::connectionsRevision(const ModelPtr &model) const
+{
+    size_t revision = 0;
+    for (size_t i = 0; i < model->componentCount(); ++i) {
+        auto component = model->component(i);
+        revision = std::max(revision, component->revision());
+        for (size_t j = 0; j < component->variableCount(); ++j) {
+            auto variable = component->variable(j);
+            if (variable->units() != nullptr) {
+                revision = std::max(revision, variable->units()->revision());
+            }
+            for (size_t k = 0; k < variable->equivalentVariableCount(); ++k) {
+                auto equivalentVariable = variable->equivalentVariable(k);
+                revision = std::max(revision, equivalentVariable->revision());
+                if (equivalentVariable->hasParent()) {
+                    revision = std::max(revision, equivalentVariable->parent()->revision());
+                }
+                if (equivalentVariable->units() != nullptr) {
+                    revision = std::max(revision, equivalentVariable->units()->revision());
+                }
+            }
+        }
+    }
+
+    return revision;
+}
+
+ValidationResult &Validator::ValidatorImpl::componentResult(const ComponentPtr &component)
+{
+    auto &result = mComponentResults[component.get()];
+    auto previousResult = mPreviousComponentResults.find(component.get());
+    if (previousResult != mPreviousComponentResults.end()) {
+        result = std::move(previousResult->second);
+        mPreviousComponentResults.erase(previousResult);
+    }
+
+    return result;
+}
+
+void Validator::ValidatorImpl::validateIncrementally(ValidationResult &result, size_t revision, const std::function<void()> &validate)
+{
+    if ((result.mRevision == revision) && (revision != 0)) {
+        for (const auto &error : result.mErrors) {
+            mValidator->addError(error);
+        }
+        return;
+    }
+    size_t errorCount = mValidator->errorCount();
+    validate();
+    result.mRevision = revision;
+    result.mErrors.clear();
+    for (size_t i = errorCount; i < mValidator->errorCount(); ++i) {
+        result.mErrors.push_back(mValidator->error(i));
+    }
+}
+
+void Validator::ValidatorImpl::validateModelUnits(const ModelPtr &model)
+{
     // Check for units in this model.
     if (model->unitsCount() > 0) {
         std::vector<std::string> unitsNames;
@@ -310,12 +639,12 @@ void Validator::validateModel(const ModelPtr &model)
                     std::string unitsRef = units->importReference();
                     std::string importSource = units->importSource()->url();
                     bool foundImportError = false;
-                    if (!mPimpl->isCellmlIdentifier(unitsRef)) {
+                    if (!isCellmlIdentifier(unitsRef)) {
                         ErrorPtr err = Error::create();
                         err->setDescription("Imported units '" + unitsName + "' does not have a valid units_ref attribute.");
                         err->setUnits(units);
                         err->setRule(SpecificationRule::IMPORT_UNITS_REF);
-                        addError(err);
+                        mValidator->addError(err);
                         foundImportError = true;
                     }
                     // Check for a xlink:href.
@@ -325,7 +654,7 @@ void Validator::validateModel(const ModelPtr &model)
                         err->setDescription("Import of units '" + unitsName + "' does not have a valid locator xlink:href attribute.");
                         err->setImportSource(units->importSource());
                         err->setRule(SpecificationRule::IMPORT_HREF);
-                        addError(err);
+                        mValidator->addError(err);
                         foundImportError = true;
                     }
                     // Check if we already have another import from the same source with the same units_ref.
@@ -337,7 +666,7 @@ void Validator::validateModel(const ModelPtr &model)
                             err->setDescription("Model '" + model->name() + "' contains multiple imported units from '" + importSource + "' with the same units_ref attribute '" + unitsRef + "'.");
                             err->setModel(model);
                             err->setRule(SpecificationRule::IMPORT_UNITS_REF);
-                            addError(err);
+                            mValidator->addError(err);
                         }
                     }
                     // Push back the unique sources and refs.
@@ -350,7 +679,7 @@ void Validator::validateModel(const ModelPtr &model)
                     err->setDescription("Model '" + model->name() + "' contains multiple units with the name '" + unitsName + "'. Valid units names must be unique to their model.");
                     err->setModel(model);
                     err->setRule(SpecificationRule::UNITS_NAME_UNIQUE);
-                    addError(err);
+                    mValidator->addError(err);
                 }
                 unitsNames.push_back(unitsName);
             }
@@ -358,17 +687,14 @@ void Validator::validateModel(const ModelPtr &model)
         for (size_t i = 0; i < model->unitsCount(); ++i) {
             // Validate units.
             UnitsPtr units = model->units(i);
-            mPimpl->validateUnits(units, unitsNames);
+            validateUnits(units, unitsNames);
         }
     }
 
     // Check that unit relationships are not cyclical.
     if (model->unitsCount() > 0) {
-        mPimpl->validateNoUnitsAreCyclic(model);
+        validateNoUnitsAreCyclic(model);
     }
-
-    // Validate any connections / variable equivalence networks in the model.
-    mPimpl->validateConnections(model);
 }
 
 void Validator::ValidatorImpl::validateUniqueName(const ModelPtr &model, const std::string &name, std::vector<std::string> &names)
@@ -392,10 +718,17 @@ void Validator::ValidatorImpl::validateComponentTree(const ModelPtr &model, cons
         auto childComponent = component->component(i);
         validateComponentTree(model, childComponent, componentNames);
     }
-    if (component->isImport()) {
-        validateImportedComponent(component);
+    auto validate = [=]() {
+        if (component->isImport()) {
+            validateImportedComponent(component);
+        } else {
+            validateComponent(component);
+        }
+    };
+    if (mIncremental) {
+        validateIncrementally(componentResult(component), componentRevision(component), validate);
     } else {
-        validateComponent(component);
+        validate();
     }
 }
 
@@ -482,9 +815,11 @@ void Validator::ValidatorImpl::validateComponent(const ComponentPtr &component)
         validateReset(reset, component);
     }
 
-    // Validate math through the private implementation (for XML handling).
-    if (!component->math().empty()) {
-        validateMath(component->math(), component);
+    // Validate math through the private implementation (for XML handling),
+    // using the math already parsed for the component, if any.
+    XmlDocPtr mathDoc = ComponentMath::parsedMath(component);
+    if (mathDoc != nullptr) {
+        validateMath(mathDoc, component);
     }
 }
 
@@ -741,6 +1076,11 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
     XmlDocPtr doc = std::make_shared<XmlDoc>();
     // Parse as XML first.
     doc->parse(input);
+    validateMath(doc, component);
+}
+
+void Validator::ValidatorImpl::validateMath(const XmlDocPtr &doc, const ComponentPtr &component)
+{
     // Copy any XML parsing errors into the common validator error handler.
     if (doc->xmlErrorCount() > 0) {
         for (size_t i = 0; i < doc->xmlErrorCount(); ++i) {
@@ -779,8 +1119,20 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
 
     validateMathMLElements(nodeCopy, component);
 
-    // Iterate through ci/cn elements and remove cellml units attributes.
-    XmlNodePtr mathNode = node;
+    if (mMathMLValidation == MathMLValidation::NATIVE) {
+        // Validate the ci/cn elements and the structure of the math directly
+        // on the document, which we leave untouched.
+        validateAndCleanMathCiCnNodes(nodeCopy, component, variableNames, false);
+        validateMathMLNatively(node, component);
+
+        return;
+    }
+
+    // Iterate through ci/cn elements and remove cellml units attributes, doing
+    // so on a copy of the document since it may be shared.
+    XmlDocPtr cleanDoc = doc->copy();
+    XmlNodePtr mathNode = cleanDoc->rootNode();
+    node = mathNode;
     validateAndCleanMathCiCnNodes(node, component, variableNames);
 
     // Remove the cellml namespace definition.
@@ -788,21 +1140,16 @@ void Validator::ValidatorImpl::validateMath(const std::string &input, const Comp
         mathNode->removeNamespaceDefinition(CELLML_2_0_NS);
     }
 
-    // Get the MathML string with cellml:units attributes and namespace already removed.
-    std::string cleanMathml = mathNode->convertToString();
-
-    // Parse/validate the clean math string with the W3C MathML DTD.
-    XmlDocPtr mathmlDoc = std::make_shared<XmlDoc>();
-    mathmlDoc->parseMathML(cleanMathml);
+    // Validate the clean math, i.e. with cellml:units attributes and namespace
+    // already removed, against the W3C MathML DTD.
+    cleanDoc->validateMathML();
     // Copy any MathML validation errors into the common validator error handler.
-    if (mathmlDoc->xmlErrorCount() > 0) {
-        for (size_t i = 0; i < mathmlDoc->xmlErrorCount(); ++i) {
-            ErrorPtr err = Error::create();
-            err->setDescription("W3C MathML DTD error: " + mathmlDoc->xmlError(i));
-            err->setComponent(component);
-            err->setKind(Error::Kind::MATHML);
-            mValidator->addError(err);
-        }
+    for (size_t i = 0; i < cleanDoc->xmlErrorCount(); ++i) {
+        ErrorPtr err = Error::create();
+        err->setDescription("W3C MathML DTD error: " + cleanDoc->xmlError(i));
+        err->setComponent(component);
+        err->setKind(Error::Kind::MATHML);
+        mValidator->addError(err);
     }
 }
 
@@ -831,7 +1178,7 @@ std::string text(const XmlNodePtr &node)
     return {};
 }
 
-void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, const ComponentPtr &component)
+void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, const ComponentPtr &component, bool clean)
 {
     // Get cellml:units attribute.
     XmlAttributePtr attribute = node->firstAttribute();
@@ -879,6 +1226,9 @@ void Validator::ValidatorImpl::validateAndCleanCnNode(const XmlNodePtr &node, co
     // Now that we've validated this XML node's cellml:units attribute, remove it from the node.
     // This is done so we can validate a "clean" MathML string using the MathML DTD. The math
     // string stored on the component will not be affected.
+    if (!clean) {
+        return;
+    }
     for (const auto &cellmlAttribute : cellmlAttributesToRemove) {
         cellmlAttribute->removeAttribute();
     }
@@ -903,22 +1253,22 @@ void Validator::ValidatorImpl::validateAndCleanCiNode(const XmlNodePtr &node, co
     }
 }
 
-void Validator::ValidatorImpl::validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const std::vector<std::string> &variableNames)
+void Validator::ValidatorImpl::validateAndCleanMathCiCnNodes(XmlNodePtr &node, const ComponentPtr &component, const std::vector<std::string> &variableNames, bool clean)
 {
     if (node->isMathmlElement("cn")) {
-        validateAndCleanCnNode(node, component);
+        validateAndCleanCnNode(node, component, clean);
     } else if (node->isMathmlElement("ci")) {
         validateAndCleanCiNode(node, component, variableNames);
     }
     // Check children for ci/cn.
     XmlNodePtr childNode = node->firstChild();
     if (childNode != nullptr) {
-        validateAndCleanMathCiCnNodes(childNode, component, variableNames);
+        validateAndCleanMathCiCnNodes(childNode, component, variableNames, clean);
     }
     // Check siblings for ci/cn.
     node = node->next();
     if (node != nullptr) {
-        validateAndCleanMathCiCnNodes(node, component, variableNames);
+        validateAndCleanMathCiCnNodes(node, component, variableNames, clean);
     }
 }
 
@@ -949,6 +1299,315 @@ void Validator::ValidatorImpl::validateMathMLElements(const XmlNodePtr &node, co
     }
 }
 
+/**
+ * @brief The MathMLOperator struct.
+ *
+ * The structure of an operator of the subset of MathML supported by CellML
+ * 2.0, i.e. its number of arguments and the qualifier it may take.
+ */
+struct MathMLOperator
+{
+    size_t minimumArgumentCount; /**< The minimum number of arguments. */
+    size_t maximumArgumentCount; /**< The maximum number of arguments. */
+    std::string qualifier; /**< The name of the qualifier, if any. */
+    bool qualifierRequired; /**< Whether the qualifier is required. */
+};
+
+static const size_t UNBOUNDED = std::numeric_limits<size_t>::max();
+
+static const std::map<std::string, MathMLOperator> mathMLOperators = {
+    {"eq", {2, 2, "", false}},
+    {"neq", {2, 2, "", false}},
+    {"gt", {2, 2, "", false}},
+    {"lt", {2, 2, "", false}},
+    {"geq", {2, 2, "", false}},
+    {"leq", {2, 2, "", false}},
+    {"and", {2, UNBOUNDED, "", false}},
+    {"or", {2, UNBOUNDED, "", false}},
+    {"xor", {2, UNBOUNDED, "", false}},
+    {"not", {1, 1, "", false}},
+    {"plus", {1, UNBOUNDED, "", false}},
+    {"minus", {1, 2, "", false}},
+    {"times", {2, UNBOUNDED, "", false}},
+    {"divide", {2, 2, "", false}},
+    {"power", {2, 2, "", false}},
+    {"root", {1, 1, "degree", false}},
+    {"abs", {1, 1, "", false}},
+    {"exp", {1, 1, "", false}},
+    {"ln", {1, 1, "", false}},
+    {"log", {1, 1, "logbase", false}},
+    {"floor", {1, 1, "", false}},
+    {"ceiling", {1, 1, "", false}},
+    {"min", {2, UNBOUNDED, "", false}},
+    {"max", {2, UNBOUNDED, "", false}},
+    {"rem", {2, 2, "", false}},
+    {"diff", {1, 1, "bvar", true}},
+    {"sin", {1, 1, "", false}},
+    {"cos", {1, 1, "", false}},
+    {"tan", {1, 1, "", false}},
+    {"sec", {1, 1, "", false}},
+    {"csc", {1, 1, "", false}},
+    {"cot", {1, 1, "", false}},
+    {"sinh", {1, 1, "", false}},
+    {"cosh", {1, 1, "", false}},
+    {"tanh", {1, 1, "", false}},
+    {"sech", {1, 1, "", false}},
+    {"csch", {1, 1, "", false}},
+    {"coth", {1, 1, "", false}},
+    {"arcsin", {1, 1, "", false}},
+    {"arccos", {1, 1, "", false}},
+    {"arctan", {1, 1, "", false}},
+    {"arcsec", {1, 1, "", false}},
+    {"arccsc", {1, 1, "", false}},
+    {"arccot", {1, 1, "", false}},
+    {"arcsinh", {1, 1, "", false}},
+    {"arccosh", {1, 1, "", false}},
+    {"arctanh", {1, 1, "", false}},
+    {"arcsech", {1, 1, "", false}},
+    {"arccsch", {1, 1, "", false}},
+    {"arccoth", {1, 1, "", false}},
+};
+
+static const std::vector<std::string> mathMLConstants = {
+    "pi", "exponentiale", "notanumber", "infinity", "true", "false"};
+
+static std::string withArticle(const std::string &name)
+{
+    static const std::string VOWELS = "aeiou";
+
+    return ((VOWELS.find(name[0]) != std::string::npos) ? "an '" : "a '") + name + "'";
+}
+
+static std::string argumentCount(size_t count)
+{
+    return std::to_string(count) + ((count == 1) ? " argument" : " arguments");
+}
+
+void Validator::ValidatorImpl::addMathMLError(const XmlNodePtr &node, const std::string &description, const ComponentPtr &component)
+{
+    ErrorPtr err = Error::create();
+    err->setDescription("Math has " + withArticle(node->name()) + " element on line " + std::to_string(node->lineNumber()) + " which " + description + ".");
+    err->setComponent(component);
+    err->setKind(Error::Kind::MATHML);
+    mValidator->addError(err);
+}
+
+std::vector<XmlNodePtr> Validator::ValidatorImpl::mathMLChildren(const XmlNodePtr &node, const ComponentPtr &component)
+{
+    std::vector<XmlNodePtr> res;
+    XmlNodePtr childNode = node->firstChild();
+    while (childNode != nullptr) {
+        if (childNode->isText()) {
+            std::string textInNode = text(childNode);
+            if (!textInNode.empty()) {
+                addMathMLError(node, "contains the unexpected text '" + textInNode + "'", component);
+            }
+        } else if (!childNode->isComment()) {
+            res.push_back(childNode);
+        }
+        childNode = childNode->next();
+    }
+    return res;
+}
+
+void Validator::ValidatorImpl::validateMathMLNatively(const XmlNodePtr &node, const ComponentPtr &component)
+{
+    for (const auto &childNode : mathMLChildren(node, component)) {
+        validateMathMLExpression(childNode, component);
+    }
+}
+
+void Validator::ValidatorImpl::validateMathMLExpression(const XmlNodePtr &node, const ComponentPtr &component)
+{
+    // Unsupported elements have already been reported, so skip them.
+    if (!isSupportedMathMLElement(node)) {
+        return;
+    }
+
+    std::string name = node->name();
+    if (name == "apply") {
+        validateMathMLApply(node, component);
+    } else if (name == "piecewise") {
+        validateMathMLPiecewise(node, component);
+    } else if (name == "cn") {
+        validateMathMLCn(node, component);
+    } else if (name == "ci") {
+        XmlNodePtr childNode = node->firstChild();
+        if ((childNode == nullptr) || !childNode->isText() || (childNode->next() != nullptr)) {
+            addMathMLError(node, "should only contain the name of a variable", component);
+        }
+    } else if (std::find(mathMLConstants.begin(), mathMLConstants.end(), name) != mathMLConstants.end()) {
+        if (!mathMLChildren(node, component).empty()) {
+            addMathMLError(node, "should be empty", component);
+        }
+    } else {
+        addMathMLError(node, "is not allowed here", component);
+    }
+}
+
+void Validator::ValidatorImpl::validateMathMLApply(const XmlNodePtr &node, const ComponentPtr &component)
+{
+    std::vector<XmlNodePtr> childNodes = mathMLChildren(node, component);
+    if (childNodes.empty()) {
+        addMathMLError(node, "is empty", component);
+        return;
+    }
+
+    XmlNodePtr operatorNode = childNodes.front();
+    if (!isSupportedMathMLElement(operatorNode)) {
+        return;
+    }
+
+    auto iter = mathMLOperators.find(operatorNode->name());
+    if (iter == mathMLOperators.end()) {
+        addMathMLError(node, "does not start with an operator", component);
+        return;
+    }
+
+    // Qualifiers, if any, must come straight after the operator.
+    const MathMLOperator &mathmlOperator = iter->second;
+    size_t argumentsCount = 0;
+    bool hasQualifier = false;
+    for (size_t i = 1; i < childNodes.size(); ++i) {
+        XmlNodePtr childNode = childNodes.at(i);
+        if (!isSupportedMathMLElement(childNode)) {
+            ++argumentsCount;
+        } else if ((childNode->name() == "bvar") || (childNode->name() == "degree") || (childNode->name() == "logbase")) {
+            if ((childNode->name() == mathmlOperator.qualifier) && !hasQualifier && (argumentsCount == 0)) {
+                hasQualifier = true;
+                validateMathMLQualifier(childNode, component);
+            } else {
+                addMathMLError(childNode, "is not allowed here", component);
+            }
+        } else {
+            ++argumentsCount;
+            validateMathMLExpression(childNode, component);
+        }
+    }
+
+    if (mathmlOperator.qualifierRequired && !hasQualifier) {
+        addMathMLError(operatorNode, "requires " + withArticle(mathmlOperator.qualifier) + " element", component);
+    }
+
+    if ((argumentsCount < mathmlOperator.minimumArgumentCount)
+        || (argumentsCount > mathmlOperator.maximumArgumentCount)) {
+        std::string expected;
+        if (mathmlOperator.minimumArgumentCount == mathmlOperator.maximumArgumentCount) {
+            expected = "exactly " + argumentCount(mathmlOperator.minimumArgumentCount);
+        } else if (mathmlOperator.maximumArgumentCount == UNBOUNDED) {
+            expected = "at least " + argumentCount(mathmlOperator.minimumArgumentCount);
+        } else {
+            expected = "between " + std::to_string(mathmlOperator.minimumArgumentCount) + " and " + argumentCount(mathmlOperator.maximumArgumentCount);
+        }
+        addMathMLError(operatorNode, "takes " + expected + " but has " + std::to_string(argumentsCount), component);
+    }
+}
+
+void Validator::ValidatorImpl::validateMathMLQualifier(const XmlNodePtr &node, const ComponentPtr &component)
+{
+    std::vector<XmlNodePtr> childNodes = mathMLChildren(node, component);
+
+    if (node->name() == "bvar") {
+        // A bvar element contains a ci element, optionally with a degree
+        // element.
+        size_t ciCount = 0;
+        size_t degreeCount = 0;
+        for (const auto &childNode : childNodes) {
+            if (childNode->isMathmlElement("ci")) {
+                ++ciCount;
+                validateMathMLExpression(childNode, component);
+            } else if (childNode->isMathmlElement("degree") && (degreeCount == 0)) {
+                ++degreeCount;
+                validateMathMLQualifier(childNode, component);
+            } else if (isSupportedMathMLElement(childNode)) {
+                addMathMLError(childNode, "is not allowed here", component);
+            }
+        }
+        if (ciCount != 1) {
+            addMathMLError(node, "should contain exactly one 'ci' element", component);
+        }
+
+        return;
+    }
+
+    // A degree or logbase element contains exactly one expression.
+    if (childNodes.size() != 1) {
+        addMathMLError(node, "should contain exactly one expression", component);
+    }
+    for (const auto &childNode : childNodes) {
+        validateMathMLExpression(childNode, component);
+    }
+}
+
+void Validator::ValidatorImpl::validateMathMLPiecewise(const XmlNodePtr &node, const ComponentPtr &component)
+{
+    std::vector<XmlNodePtr> childNodes = mathMLChildren(node, component);
+    if (childNodes.empty()) {
+        addMathMLError(node, "is empty", component);
+        return;
+    }
+
+    // A piecewise element contains piece elements, optionally followed by one
+    // otherwise element.
+    bool hasOtherwise = false;
+    for (const auto &childNode : childNodes) {
+        if (!isSupportedMathMLElement(childNode)) {
+            continue;
+        }
+        bool isPiece = childNode->name() == "piece";
+        if ((!isPiece && (childNode->name() != "otherwise")) || hasOtherwise) {
+            addMathMLError(childNode, "is not allowed here", component);
+            continue;
+        }
+        hasOtherwise = !isPiece;
+
+        std::vector<XmlNodePtr> expressionNodes = mathMLChildren(childNode, component);
+        size_t expectedCount = isPiece ? 2 : 1;
+        if (expressionNodes.size() != expectedCount) {
+            addMathMLError(childNode, "should contain exactly " + std::to_string(expectedCount) + (isPiece ? " expressions" : " expression"), component);
+        }
+        for (const auto &expressionNode : expressionNodes) {
+            validateMathMLExpression(expressionNode, component);
+        }
+    }
+}
+
+void Validator::ValidatorImpl::validateMathMLCn(const XmlNodePtr &node, const ComponentPtr &component)
+{
+    std::string type = node->hasAttribute("type") ? node->attribute("type") : "real";
+    if ((type != "real") && (type != "e-notation")) {
+        addMathMLError(node, "has an unsupported type '" + type + "'", component);
+        return;
+    }
+
+    // A real number is a single number while a number in e-notation is a
+    // significand and an exponent separated by a sep element.
+    std::vector<std::string> parts = {""};
+    XmlNodePtr childNode = node->firstChild();
+    while (childNode != nullptr) {
+        if (childNode->isMathmlElement("sep")) {
+            parts.emplace_back();
+        } else if (childNode->isText()) {
+            parts.back() += text(childNode);
+        } else if (!childNode->isComment()) {
+            addMathMLError(childNode, "is not allowed here", component);
+        }
+        childNode = childNode->next();
+    }
+
+    if (type == "real") {
+        if (parts.size() != 1) {
+            addMathMLError(node, "should not contain a 'sep' element", component);
+        } else if (!isCellMLReal(parts.front())) {
+            addMathMLError(node, "does not contain a real number", component);
+        }
+    } else if (parts.size() != 2) {
+        addMathMLError(node, "should contain exactly one 'sep' element", component);
+    } else if (!isCellMLReal(parts.front()) || !isCellMLInteger(parts.back())) {
+        addMathMLError(node, "does not contain a number in e-notation", component);
+    }
+}
+
 void Validator::ValidatorImpl::validateConnections(const ModelPtr &model)
 {
     std::string hints;
@@ -1057,6 +1716,7 @@ bool Validator::ValidatorImpl::unitsAreEquivalent(const ModelPtr &model,
     }
 
     std::string ref;
+    std::vector<std::string> history;
     hints = "";
     multiplier = 0.0;
 
@@ -1067,23 +1727,23 @@ bool Validator::ValidatorImpl::unitsAreEquivalent(const ModelPtr &model,
     if (model->hasUnits(v1->units()->name())) {
         UnitsPtr u1 = Units::create();
         u1 = model->units(v1->units()->name());
-        updateBaseUnitCount(model, unitMap, multiplier, u1->name(), 1, 0, 1);
+        updateBaseUnitCount(model, unitMap, multiplier, u1->name(), 1, 0, 1, history);
     } else if (unitMap.find(v1->units()->name()) != unitMap.end()) {
         ref = v1->units()->name();
         unitMap.at(ref) += 1.0;
     } else if (isStandardUnitName(v1->units()->name())) {
-        updateBaseUnitCount(model, unitMap, multiplier, v1->units()->name(), 1, 0, 1);
+        updateBaseUnitCount(model, unitMap, multiplier, v1->units()->name(), 1, 0, 1, history);
     }
 
     if (model->hasUnits(v2->units()->name())) {
         UnitsPtr u2 = Units::create();
         u2 = model->units(v2->units()->name());
-        updateBaseUnitCount(model, unitMap, multiplier, u2->name(), 1, 0, -1);
+        updateBaseUnitCount(model, unitMap, multiplier, u2->name(), 1, 0, -1, history);
     } else if (unitMap.find(v2->units()->name()) != unitMap.end()) {
         ref = v2->units()->name();
         unitMap.at(v2->units()->name()) -= 1.0;
     } else if (isStandardUnitName(v2->units()->name())) {
-        updateBaseUnitCount(model, unitMap, multiplier, v2->units()->name(), 1, 0, -1);
+        updateBaseUnitCount(model, unitMap, multiplier, v2->units()->name(), 1, 0, -1, history);
     }
 
     // Remove "dimensionless" from base unit testing.
@@ -1127,11 +1787,17 @@ void Validator::ValidatorImpl::updateBaseUnitCount(const ModelPtr &model,
                                                    double &multiplier,
                                                    const std::string &uName,
                                                    double uExp, double logMult,
-                                                   int direction)
+                                                   int direction,
+                                                   std::vector<std::string> &history)
 {
+    if (std::find(history.begin(), history.end(), uName) != history.end()) {
+        // Cyclic units, which are reported as such, have no base units.
+        return;
+    }
     if (model->hasUnits(uName)) {
         UnitsPtr u = model->units(uName);
         if (!u->isBaseUnit()) {
+            history.push_back(uName);
             std::string ref;
             std::string pre;
             std::string id;
@@ -1142,7 +1808,7 @@ void Validator::ValidatorImpl::updateBaseUnitCount(const ModelPtr &model,
                 u->unitAttributes(i, ref, pre, exp, expMult, id);
                 mult = std::log10(expMult);
                 if (!isStandardUnitName(ref)) {
-                    updateBaseUnitCount(model, unitMap, multiplier, ref, exp * uExp, logMult + mult * uExp + standardPrefixList.at(pre) * uExp, direction);
+                    updateBaseUnitCount(model, unitMap, multiplier, ref, exp * uExp, logMult + mult * uExp + standardPrefixList.at(pre) * uExp, direction, history);
                 } else {
                     for (const auto &iter : standardUnitsList.at(ref)) {
                         unitMap.at(iter.first) += direction * (iter.second * exp * uExp);
@@ -1150,6 +1816,7 @@ void Validator::ValidatorImpl::updateBaseUnitCount(const ModelPtr &model,
                     multiplier += direction * (logMult + (standardMultiplierList.at(ref) + mult + standardPrefixList.at(pre)) * exp);
                 }
             }
+            history.pop_back();
         } else if (unitMap.find(uName) == unitMap.end()) {
             unitMap.emplace(std::pair<std::string, double>(uName, direction * uExp));
             multiplier += direction * logMult;
@@ -25,6 +25,7 @@ limitations under the License.
 #include "libcellml/model.h"
 #include "libcellml/units.h"
 
+#include "symbol.h"
 #include "utilities.h"
 
 namespace libcellml {
@@ -54,7 +55,7 @@ struct Variable::VariableImpl
     std::map<VariableWeakPtr, std::string, std::owner_less<VariableWeakPtr>> mMappingIdMap; /**< Mapping id map for equivalent variable.*/
     std::map<VariableWeakPtr, std::string, std::owner_less<VariableWeakPtr>> mConnectionIdMap; /**< Connection id map for equivalent variable.*/
     std::string mInitialValue; /**< Initial value for this Variable.*/
-    std::string mInterfaceType; /**< Interface type for this Variable.*/
+    Symbol mInterfaceType; /**< Interface type for this Variable.*/
     UnitsPtr mUnits = nullptr; /**< The units defined for this Variable.*/
 
     /**
@@ -257,6 +258,7 @@ void Variable::removeAllEquivalences()
         }
     }
     mPimpl->mEquivalentVariables.clear();
+    markAsModified();
 }
 
 VariablePtr Variable::equivalentVariable(size_t index) const
@@ -356,6 +358,7 @@ bool Variable::VariableImpl::setEquivalentTo(const VariablePtr &equivalentVariab
     if (!hasEquivalentVariable(equivalentVariable)) {
         VariableWeakPtr weakEquivalentVariable = equivalentVariable;
         mEquivalentVariables.push_back(weakEquivalentVariable);
+        mVariable->markAsModified();
         return true;
     }
 
@@ -377,6 +380,7 @@ bool Variable::VariableImpl::unsetEquivalentTo(const VariablePtr &equivalentVari
         if (connectionIdResult != mConnectionIdMap.end()) {
             mConnectionIdMap.erase(connectionIdResult);
         }
+        mVariable->markAsModified();
         status = true;
     }
 
@@ -387,6 +391,7 @@ void Variable::VariableImpl::setEquivalentMappingId(const VariablePtr &equivalen
 {
     VariableWeakPtr weakEquivalentVariable = equivalentVariable;
     mMappingIdMap[weakEquivalentVariable] = id;
+    mVariable->markAsModified();
 }
 
 std::string Variable::VariableImpl::equivalentMappingId(const VariablePtr &equivalentVariable) const
@@ -401,6 +406,7 @@ void Variable::VariableImpl::setEquivalentConnectionId(const VariablePtr &equiva
 {
     VariableWeakPtr weakEquivalentVariable = equivalentVariable;
     mConnectionIdMap[weakEquivalentVariable] = id;
+    mVariable->markAsModified();
 }
 
 std::string Variable::VariableImpl::equivalentConnectionId(const VariablePtr &equivalentVariable) const
@@ -422,16 +428,19 @@ void Variable::setUnits(const std::string &name)
         u->setName(name);
     }
     mPimpl->mUnits = u;
+    markAsModified();
 }
 
 void Variable::setUnits(const UnitsPtr &units)
 {
     mPimpl->mUnits = units;
+    markAsModified();
 }
 
 void Variable::removeUnits()
 {
     mPimpl->mUnits = nullptr;
+    markAsModified();
 }
 
 UnitsPtr Variable::units() const
@@ -442,16 +451,19 @@ UnitsPtr Variable::units() const
 void Variable::setInitialValue(const std::string &initialValue)
 {
     mPimpl->mInitialValue = initialValue;
+    markAsModified();
 }
 
 void Variable::setInitialValue(double initialValue)
 {
     mPimpl->mInitialValue = convertToString(initialValue);
+    markAsModified();
 }
 
 void Variable::setInitialValue(const VariablePtr &variable)
 {
     mPimpl->mInitialValue = variable->name();
+    markAsModified();
 }
 
 std::string Variable::initialValue() const
@@ -462,11 +474,13 @@ std::string Variable::initialValue() const
 void Variable::removeInitialValue()
 {
     mPimpl->mInitialValue.clear();
+    markAsModified();
 }
 
 void Variable::setInterfaceType(const std::string &interfaceType)
 {
-    mPimpl->mInterfaceType = interfaceType;
+    mPimpl->mInterfaceType = Symbol(interfaceType);
+    markAsModified();
 }
 
 void Variable::setInterfaceType(Variable::InterfaceType interfaceType)
@@ -478,12 +492,13 @@ void Variable::setInterfaceType(Variable::InterfaceType interfaceType)
 
 std::string Variable::interfaceType() const
 {
-    return mPimpl->mInterfaceType;
+    return mPimpl->mInterfaceType.string();
 }
 
 void Variable::removeInterfaceType()
 {
-    mPimpl->mInterfaceType.clear();
+    mPimpl->mInterfaceType = Symbol();
+    markAsModified();
 }
 
 void Variable::setEquivalenceMappingId(const VariablePtr &variable1, const VariablePtr &variable2, const std::string &mappingId)
@@ -546,17 +561,7 @@ void Variable::removeEquivalenceMappingId(const VariablePtr &variable1, const Va
 
 VariablePtr Variable::clone() const
 {
-    auto v = create();
-
-    if (mPimpl->mUnits != nullptr) {
-        v->setUnits(mPimpl->mUnits->clone());
-    }
-    v->setInitialValue(initialValue());
-    v->setInterfaceType(interfaceType());
-    v->setId(id());
-    v->setName(name());
-
-    return v;
+    return cloneVariable(*this, UnitsCopyMap());
 }
 
 } // namespace libcellml
@@ -0,0 +1,176 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "workqueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace libcellml {
+
+/**
+ * @brief The WorkQueue class.
+ *
+ * The queue of indices of the tasks to be run by a worker. The worker takes
+ * indices from the front of its queue while other workers, once their own
+ * queue is empty, steal indices from its back.
+ */
+class WorkQueue
+{
+public:
+    void push(size_t index)
+    {
+        mIndices.push_back(index);
+    }
+
+    bool pop(size_t &index)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mIndices.empty()) {
+            return false;
+        }
+        index = mIndices.front();
+        mIndices.pop_front();
+        return true;
+    }
+
+    bool steal(size_t &index)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mIndices.empty()) {
+            return false;
+        }
+        index = mIndices.back();
+        mIndices.pop_back();
+        return true;
+    }
+
+private:
+    std::mutex mMutex;
+    std::deque<size_t> mIndices;
+};
+
+/**
+ * @brief The TaskRun struct.
+ *
+ * The state shared by the workers running some tasks: their queues and the
+ * first exception thrown by a task, if any. Once a task has thrown, the
+ * workers stop taking new tasks.
+ */
+struct TaskRun
+{
+    explicit TaskRun(size_t workerCount)
+        : mQueues(workerCount)
+    {
+    }
+
+    std::vector<WorkQueue> mQueues; /**< The queues of all the workers. */
+    std::atomic<bool> mFailed {false}; /**< Whether a task has thrown an exception. */
+    std::mutex mExceptionMutex; /**< Mutex guarding the exception. */
+    std::exception_ptr mException; /**< The first exception thrown by a task. */
+
+    void fail(const std::exception_ptr &exception)
+    {
+        std::lock_guard<std::mutex> lock(mExceptionMutex);
+        if (mException == nullptr) {
+            mException = exception;
+        }
+        mFailed = true;
+    }
+};
+
+/**
+ * @brief Run tasks until there are none left.
+ *
+ * Run the tasks whose indices are in the queue of the given @p worker and,
+ * once that queue is empty, the tasks whose indices can be stolen from the
+ * queues of other workers. An exception thrown by a task is caught and kept
+ * in @p taskRun, so that it can be rethrown on the calling thread once all
+ * the workers are done.
+ *
+ * @param worker The index of the worker, i.e. of its queue in @p taskRun.
+ * @param taskRun The state shared by all the workers.
+ * @param run The function running a task.
+ */
+static void runTasks(size_t worker, TaskRun &taskRun,
+                     const std::function<void(size_t worker, size_t task)> &run)
+{
+    auto &queues = taskRun.mQueues;
+    size_t index = 0;
+    while (!taskRun.mFailed) {
+        bool found = queues.at(worker).pop(index);
+        for (size_t i = 1; !found && (i < queues.size()); ++i) {
+            found = queues.at((worker + i) % queues.size()).steal(index);
+        }
+        // No task gets added once running has started, so we are done if
+        // there is nothing left to steal.
+        if (!found) {
+            return;
+        }
+        try {
+            run(worker, index);
+        } catch (...) {
+            taskRun.fail(std::current_exception());
+        }
+    }
+}
+
+size_t concurrentWorkerCount(size_t taskCount, size_t threads)
+{
+    if (threads == 0) {
+        threads = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+    }
+    return std::min(threads, taskCount);
+}
+
+void runConcurrently(size_t taskCount, size_t workerCount,
+                     const std::function<void(size_t worker, size_t task)> &run)
+{
+    if (workerCount == 0) {
+        return;
+    }
+
+    TaskRun taskRun(workerCount);
+    for (size_t i = 0; i < taskCount; ++i) {
+        taskRun.mQueues.at(i * workerCount / taskCount).push(i);
+    }
+
+    std::vector<std::thread> workers;
+    try {
+        for (size_t worker = 1; worker < workerCount; ++worker) {
+            workers.emplace_back(runTasks, worker, std::ref(taskRun), std::cref(run));
+        }
+    } catch (...) {
+        // A thread could not be started, so let the workers that have been
+        // started finish their current task and stop.
+        taskRun.fail(std::current_exception());
+    }
+    runTasks(0, taskRun, run);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    if (taskRun.mException != nullptr) {
+        std::rethrow_exception(taskRun.mException);
+    }
+}
+
+} // namespace libcellml
@@ -0,0 +1,59 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace libcellml {
+
+/**
+ * @brief Get the number of workers to use for some tasks.
+ *
+ * Get the number of workers to use for @p taskCount tasks, using up to
+ * @p threads threads.
+ *
+ * @param taskCount The number of tasks.
+ * @param threads The maximum number of threads to use, or @c 0 to use as
+ * many threads as there are hardware threads.
+ *
+ * @return The number of workers, which is zero if there are no tasks.
+ */
+size_t concurrentWorkerCount(size_t taskCount, size_t threads);
+
+/**
+ * @brief Run tasks concurrently.
+ *
+ * Run the tasks indexed from @c 0 to @p taskCount - 1 using @p workerCount
+ * workers, the calling thread being the first of them. Each worker is given
+ * a contiguous share of the tasks and, once done with its share, steals
+ * tasks from the share of other workers. This keeps all workers busy even
+ * when some tasks take much longer than others.
+ *
+ * If a task throws an exception, the workers stop taking new tasks and, once
+ * all of them are done, the first exception thrown is rethrown on the calling
+ * thread.
+ *
+ * @param taskCount The number of tasks.
+ * @param workerCount The number of workers, as returned by concurrentWorkerCount().
+ * @param run The function running the given task on behalf of the given
+ * worker.
+ */
+void runConcurrently(size_t taskCount, size_t workerCount,
+                     const std::function<void(size_t worker, size_t task)> &run);
+
+} // namespace libcellml
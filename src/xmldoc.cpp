@@ -16,9 +16,13 @@ limitations under the License.
 
 #include "xmldoc.h"
 
+#include <cstdarg>
 #include <cstring>
+#include <libxml/parser.h>
 #include <libxml/tree.h>
+#include <libxml/valid.h>
 #include <libxml/xmlerror.h>
+#include <libxml/xmlreader.h>
 #include <string>
 #include <vector>
 
@@ -49,6 +53,139 @@ void structuredErrorCallback(void *userData, xmlErrorPtr error)
     doc->addXmlError(errorString);
 }
 
+/**
+ * @brief Callback for errors from the libxml2 text reader.
+ *
+ * Structured callback @c xmlStructuredErrorFunc for errors
+ * from the libxml2 text reader used to parse this document.
+ *
+ * @param userData Private data type used to store the @c XmlDoc.
+ *
+ * @param error The @c xmlErrorPtr to the error raised by libxml.
+ */
+void readerStructuredErrorCallback(void *userData, xmlErrorPtr error)
+{
+    std::string errorString = std::string(error->message);
+    // Swap libxml2 carriage return for a period.
+    if (errorString.substr(errorString.length() - 1) == "\n") {
+        errorString.replace(errorString.end() - 1, errorString.end(), ".");
+    }
+    auto doc = reinterpret_cast<XmlDoc *>(userData);
+    doc->addXmlError(errorString);
+}
+
+/**
+ * @brief Callback for errors from the libxml2 validation context.
+ *
+ * Generic callback @c xmlValidityErrorFunc for errors from the libxml2
+ * validation context used to validate this document against the MathML DTD.
+ *
+ * @param userData Private data type used to store the @c XmlDoc.
+ *
+ * @param format The @c printf-like format of the error.
+ */
+void validityErrorCallback(void *userData, const char *format, ...)
+{
+    va_list arguments;
+    va_start(arguments, format);
+    va_list argumentsCopy;
+    va_copy(argumentsCopy, arguments);
+    int length = vsnprintf(nullptr, 0, format, argumentsCopy);
+    va_end(argumentsCopy);
+    std::string errorString;
+    if (length > 0) {
+        std::vector<char> buffer(size_t(length) + 1);
+        vsnprintf(buffer.data(), buffer.size(), format, arguments);
+        errorString = std::string(buffer.data());
+    }
+    va_end(arguments);
+    // Swap libxml2 carriage return for a period.
+    if (!errorString.empty() && (errorString.substr(errorString.length() - 1) == "\n")) {
+        errorString.replace(errorString.end() - 1, errorString.end(), ".");
+    }
+    auto doc = reinterpret_cast<XmlDoc *>(userData);
+    doc->addXmlError(errorString);
+}
+
+/**
+ * @brief Build the content model of an element declaration.
+ *
+ * Scanner for @c xmlHashScan that builds the content model of the given
+ * element declaration, so that it does not get built (i.e. the DTD does not
+ * get modified) while validating a document against the DTD.
+ *
+ * @param payload The @c xmlElementPtr element declaration.
+ * @param data The @c xmlValidCtxtPtr validation context.
+ * @param name The name of the element (unused).
+ */
+void buildContentModel(void *payload, void *data, const xmlChar *name)
+{
+    (void)name;
+    auto element = reinterpret_cast<xmlElementPtr>(payload);
+    if ((element->type == XML_ELEMENT_DECL) && (element->etype == XML_ELEMENT_TYPE_ELEMENT)) {
+        xmlValidBuildContentModel(reinterpret_cast<xmlValidCtxtPtr>(data), element);
+    }
+}
+
+/**
+ * @brief Get the MathML DTD.
+ *
+ * Get the MathML DTD, which is loaded and prepared, once and for all, the
+ * first time it is needed. It is then only ever read, so that it can be used
+ * by several threads at the same time.
+ *
+ * @return The MathML @c xmlDtdPtr, or @c nullptr if it could not be loaded.
+ */
+xmlDtdPtr mathmlDtd()
+{
+    static const xmlDtdPtr dtd = []() {
+        xmlDtdPtr res = xmlParseDTD(nullptr, reinterpret_cast<const xmlChar *>(LIBCELLML_MATHML_DTD_LOCATION.c_str()));
+        if ((res != nullptr) && (res->elements != nullptr)) {
+            xmlValidCtxtPtr context = xmlNewValidCtxt();
+            xmlHashScan(reinterpret_cast<xmlHashTablePtr>(res->elements), buildContentModel, context);
+            xmlFreeValidCtxt(context);
+        }
+        return res;
+    }();
+    return dtd;
+}
+
+/**
+ * @brief Initialise libxml2.
+ *
+ * Initialise libxml2, once and for all, for the whole process. This is
+ * thread safe, as opposed to calling @c xmlInitParser() (and its clean-up
+ * counterparts) whenever an XML document is parsed.
+ */
+void initialiseLibXml()
+{
+    static const bool initialised = []() {
+        xmlInitParser();
+        return true;
+    }();
+    (void)initialised;
+}
+
+/**
+ * @brief Create a new libxml2 parser context for the given @p doc.
+ *
+ * Create a new libxml2 parser context, which reports its errors to @p doc
+ * through its own structured error handler rather than through the global
+ * libxml2 error handler, so that several documents can be parsed
+ * concurrently.
+ *
+ * @param doc The @c XmlDoc for which to create the parser context.
+ *
+ * @return The new @c xmlParserCtxtPtr, to be freed by the caller.
+ */
+xmlParserCtxtPtr newParserContext(XmlDoc *doc)
+{
+    xmlParserCtxtPtr context = xmlNewParserCtxt();
+    context->_private = reinterpret_cast<void *>(doc);
+    context->sax->serror = structuredErrorCallback;
+    return context;
+}
+
 /**
  * @brief The XmlDoc::XmlDocImpl struct.
  *
@@ -59,12 +196,14 @@ void structuredErrorCallback(void *userData, xmlErrorPtr error)
 struct XmlDoc::XmlDocImpl
 {
     xmlDocPtr mXmlDocPtr = nullptr;
+    std::vector<xmlNodePtr> mKeptNodes;
     std::vector<std::string> mXmlErrors;
 };
 
 XmlDoc::XmlDoc()
     : mPimpl(new XmlDocImpl())
 {
+    initialiseLibXml();
 }
 
 XmlDoc::~XmlDoc()
@@ -72,35 +211,98 @@ XmlDoc::~XmlDoc()
     if (mPimpl->mXmlDocPtr != nullptr) {
         xmlFreeDoc(mPimpl->mXmlDocPtr);
     }
+    for (const auto &node : mPimpl->mKeptNodes) {
+        xmlFreeNode(node);
+    }
     delete mPimpl;
 }
 
 void XmlDoc::parse(const std::string &input)
 {
-    xmlInitParser();
-    xmlParserCtxtPtr context = xmlNewParserCtxt();
-    context->_private = reinterpret_cast<void *>(this);
-    xmlSetStructuredErrorFunc(context, structuredErrorCallback);
-    mPimpl->mXmlDocPtr = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(input.c_str()), "/", nullptr, 0);
+    parse(input.c_str(), input.size());
+}
+
+void XmlDoc::parse(const char *data, size_t size)
+{
+    xmlParserCtxtPtr context = newParserContext(this);
+    mPimpl->mXmlDocPtr = xmlCtxtReadMemory(context, data, int(size), "/", nullptr, XML_PARSE_NOBLANKS);
     xmlFreeParserCtxt(context);
-    xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
+}
+
+void XmlDoc::parseStreaming(const char *data, size_t size,
+                            const std::function<bool(const XmlNodePtr &)> &rootHandler,
+                            const std::function<bool(const XmlNodePtr &)> &childHandler)
+{
+    xmlTextReaderPtr reader = xmlReaderForMemory(data, int(size), "/", nullptr, XML_PARSE_NOBLANKS);
+    if (reader != nullptr) {
+        xmlTextReaderSetStructuredErrorHandler(reader, readerStructuredErrorCallback, reinterpret_cast<void *>(this));
+        int status = xmlTextReaderRead(reader);
+        while (status == 1) {
+            int depth = xmlTextReaderDepth(reader);
+            if (depth == 0) {
+                if (xmlTextReaderNodeType(reader) == XML_READER_TYPE_ELEMENT) {
+                    XmlNodePtr root = std::make_shared<XmlNode>();
+                    root->setXmlNode(xmlTextReaderCurrentNode(reader));
+                    if (!rootHandler(root) || (xmlTextReaderIsEmptyElement(reader) == 1)) {
+                        break;
+                    }
+                }
+                status = xmlTextReaderRead(reader);
+            } else {
+                // Expand the subtree of the current child of the root element
+                // and hand it over, before skipping to the next child.
+                xmlNodePtr node = xmlTextReaderExpand(reader);
+                if (node != nullptr) {
+                    XmlNodePtr child = std::make_shared<XmlNode>();
+                    child->setXmlNode(node);
+                    if (childHandler(child)) {
+                        // Keep a copy of the subtree, since preserving it
+                        // would stop the reader from releasing any subsequent
+                        // subtree.
+                        xmlNodePtr copy = xmlCopyNode(node, 1);
+                        mPimpl->mKeptNodes.push_back(copy);
+                        child->setXmlNode(copy);
+                    }
+                }
+                status = xmlTextReaderNext(reader);
+            }
+        }
+        xmlFreeTextReader(reader);
+    }
 }
 
 void XmlDoc::parseMathML(const std::string &input)
 {
-    xmlInitParser();
-    std::string mathmlDtd = "<!DOCTYPE math SYSTEM \"" + LIBCELLML_MATHML_DTD_LOCATION + "\">";
-    std::string mathmlString = mathmlDtd + input;
-    xmlParserCtxtPtr context = xmlNewParserCtxt();
-    context->_private = reinterpret_cast<void *>(this);
-    xmlSetStructuredErrorFunc(context, structuredErrorCallback);
-    mPimpl->mXmlDocPtr = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(mathmlString.c_str()), "/", nullptr, XML_PARSE_DTDVALID);
+    xmlParserCtxtPtr context = newParserContext(this);
+    mPimpl->mXmlDocPtr = xmlCtxtReadDoc(context, reinterpret_cast<const xmlChar *>(input.c_str()), "/", nullptr, 0);
     xmlFreeParserCtxt(context);
-    xmlSetStructuredErrorFunc(nullptr, nullptr);
-    xmlCleanupParser();
-    xmlCleanupGlobals();
+    if (mPimpl->mXmlDocPtr != nullptr) {
+        validateMathML();
+    }
+}
+
+void XmlDoc::validateMathML()
+{
+    xmlDtdPtr dtd = mathmlDtd();
+    if (dtd == nullptr) {
+        addXmlError("The MathML DTD could not be loaded from '" + LIBCELLML_MATHML_DTD_LOCATION + "'.");
+        return;
+    }
+    xmlValidCtxtPtr context = xmlNewValidCtxt();
+    context->userData = reinterpret_cast<void *>(this);
+    context->error = validityErrorCallback;
+    context->warning = validityErrorCallback;
+    xmlValidateDtd(context, mPimpl->mXmlDocPtr, dtd);
+    xmlFreeValidCtxt(context);
+}
+
+XmlDocPtr XmlDoc::copy() const
+{
+    XmlDocPtr doc = std::make_shared<XmlDoc>();
+    if (mPimpl->mXmlDocPtr != nullptr) {
+        doc->mPimpl->mXmlDocPtr = xmlCopyDoc(mPimpl->mXmlDocPtr, 1);
+    }
+    return doc;
 }
 
 XmlNodePtr XmlDoc::rootNode() const
@@ -16,6 +16,7 @@ limitations under the License.
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -47,15 +48,72 @@ public:
      */
     void parse(const std::string &input);
 
+    /**
+     * @brief Parse an XML document from a buffer.
+     *
+     * Parses the @p size bytes of @p data as an XML document. The buffer is
+     * handed over to libxml2 as is, i.e. without being copied.
+     *
+     * @param data The buffer to parse.
+     * @param size The size of the buffer.
+     */
+    void parse(const char *data, size_t size);
+
+    /**
+     * @brief Parse an XML document from a buffer, one child of the root element at a time.
+     *
+     * Parses the @p size bytes of @p data as an XML document using a streaming
+     * reader. The root element, with its attributes but without its children,
+     * is passed to @p rootHandler. If @p rootHandler returns @c true then each
+     * child node of the root element, with its complete subtree, is passed in
+     * turn to @p childHandler. The subtree of a child node is released once
+     * @p childHandler has been called, unless @p childHandler returns @c true,
+     * in which case the @c XmlNodePtr given to @p childHandler is made to
+     * point to a copy of the subtree that is kept until this document is
+     * destroyed.
+     *
+     * The root element is not kept, i.e. rootNode() returns @c nullptr once
+     * parsing has finished.
+     *
+     * @param data The buffer to parse.
+     * @param size The size of the buffer.
+     * @param rootHandler The function to call for the root element.
+     * @param childHandler The function to call for each child node of the root element.
+     */
+    void parseStreaming(const char *data, size_t size,
+                        const std::function<bool(const XmlNodePtr &)> &rootHandler,
+                        const std::function<bool(const XmlNodePtr &)> &childHandler);
+
     /**
      * @brief Parse an XML string as MathML.
      *
-     * Parses the @p input @c std::string as a MathML string.
+     * Parses the @p input @c std::string as a MathML string and validates
+     * it against the MathML DTD (see validateMathML()).
      *
      * @param input The @c std::string to parse.
      */
     void parseMathML(const std::string &input);
 
+    /**
+     * @brief Validate this XML document against the MathML DTD.
+     *
+     * Validates this XML document against the W3C MathML DTD, which is
+     * loaded only once, the first time it is needed. Any validity error is
+     * added to the list of XML errors of this document.
+     */
+    void validateMathML();
+
+    /**
+     * @brief Create a copy of this XML document.
+     *
+     * Create a deep copy of the XML tree of this document, so that it can be
+     * modified without affecting this document. The XML errors raised while
+     * parsing this document are not copied.
+     *
+     * @return The @c XmlDocPtr copy of this document.
+     */
+    XmlDocPtr copy() const;
+
     /**
      * @brief Get the root XML element of the document.
      *
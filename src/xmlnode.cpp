@@ -75,7 +75,9 @@ void clearNamespace(const xmlNodePtr &node, xmlNsPtr ns)
     if (node->ns == ns) {
         node->ns = nullptr;
     }
-    xmlAttrPtr attr = node->properties;
+    // Only element nodes have attributes. In particular, the attribute field
+    // of a text node may hold the text itself (see XML_PARSE_COMPACT).
+    xmlAttrPtr attr = (node->type == XML_ELEMENT_NODE) ? node->properties : nullptr;
     while (attr != nullptr) {
         if (attr->ns == ns) {
             attr->ns = nullptr;
@@ -121,7 +123,7 @@ void XmlNode::removeNamespaceDefinition(const std::string &uri)
 
 bool XmlNode::hasNamespaceDefinition(const std::string &uri)
 {
-    if (mPimpl->mXmlNodePtr->nsDef != nullptr) {
+    if ((mPimpl->mXmlNodePtr->type == XML_ELEMENT_NODE) && (mPimpl->mXmlNodePtr->nsDef != nullptr)) {
         auto next = mPimpl->mXmlNodePtr->nsDef;
         while (next != nullptr) {
             std::string href;
@@ -140,7 +142,7 @@ bool XmlNode::hasNamespaceDefinition(const std::string &uri)
 XmlNamespaceMap XmlNode::definedNamespaces() const
 {
     XmlNamespaceMap namespaceMap;
-    if (mPimpl->mXmlNodePtr->nsDef != nullptr) {
+    if ((mPimpl->mXmlNodePtr->type == XML_ELEMENT_NODE) && (mPimpl->mXmlNodePtr->nsDef != nullptr)) {
         auto next = mPimpl->mXmlNodePtr->nsDef;
         while (next != nullptr) {
             std::string prefix;
@@ -194,6 +196,12 @@ std::string XmlNode::name() const
     return reinterpret_cast<const char *>(mPimpl->mXmlNodePtr->name);
 }
 
+size_t XmlNode::lineNumber() const
+{
+    long lineNumber = xmlGetLineNo(mPimpl->mXmlNodePtr);
+    return (lineNumber > 0) ? size_t(lineNumber) : 0;
+}
+
 bool XmlNode::hasAttribute(const char *attributeName) const
 {
     bool found = false;
@@ -217,7 +225,8 @@ std::string XmlNode::attribute(const char *attributeName) const
 
 XmlAttributePtr XmlNode::firstAttribute() const
 {
-    xmlAttrPtr attribute = mPimpl->mXmlNodePtr->properties;
+    // Only element nodes have attributes (see clearNamespace()).
+    xmlAttrPtr attribute = (mPimpl->mXmlNodePtr->type == XML_ELEMENT_NODE) ? mPimpl->mXmlNodePtr->properties : nullptr;
     XmlAttributePtr attributeHandle = nullptr;
     if (attribute != nullptr) {
         attributeHandle = std::make_shared<XmlAttribute>();
@@ -268,9 +277,6 @@ std::string XmlNode::convertToString(bool format) const
 {
     std::string contentString;
     xmlBufferPtr buffer = xmlBufferCreate();
-    if (format) {
-        xmlKeepBlanksDefault(0);
-    }
     int len = xmlNodeDump(buffer, mPimpl->mXmlNodePtr->doc, mPimpl->mXmlNodePtr, 0, format ? 1 : 0);
     if (len > 0) {
         contentString = std::string(reinterpret_cast<const char *>(buffer->content));
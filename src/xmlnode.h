@@ -192,6 +192,15 @@ public:
      */
     std::string name() const;
 
+    /**
+     * @brief Get the line number of the XML node.
+     *
+     * Get the line number, in the parsed XML document, of this XML node.
+     *
+     * @return The line number of this XML node, or @c 0 if it is not known.
+     */
+    size_t lineNumber() const;
+
     /**
      * @brief Check if this @c XmlNode has the specified attribute.
      *
@@ -0,0 +1,7 @@
+# Benchmarks are not unit tests: they are built, but they are not run by CTest.
+# Instead, they can be run, if needed, using the benchmarks executable.
+# Using absolute path relative to this file
+set(BENCHMARKS_SRCS
+  ${CMAKE_CURRENT_LIST_DIR}/model_flattening.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/parser.cpp
+)
@@ -0,0 +1,52 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+
+TEST(ModelFlatteningBenchmark, scalingWithImportedInstances)
+{
+    // Report the time it takes to flatten a model with an increasing number of
+    // imported instances. That time should be roughly proportional to the
+    // number of instances, i.e. going from 500 to 4000 instances should make
+    // flattening about eight times slower, not 64 times as would be the case
+    // if flattening was quadratic.
+
+    for (size_t instanceCount = 500; instanceCount <= 4000; instanceCount *= 2) {
+        auto duration = std::chrono::steady_clock::duration::max();
+
+        for (size_t i = 0; i < 3; ++i) {
+            auto model = createModelWithImportedInstances(instanceCount);
+            auto start = std::chrono::steady_clock::now();
+
+            model->flatten();
+
+            duration = std::min(duration, std::chrono::steady_clock::now() - start);
+
+            EXPECT_EQ(2 * instanceCount, model->componentCount());
+        }
+
+        std::cout << "[ BENCHMARK] " << instanceCount << " instance(s): "
+                  << std::chrono::duration_cast<std::chrono::microseconds>(duration).count() << " us" << std::endl;
+    }
+}
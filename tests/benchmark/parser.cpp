@@ -0,0 +1,64 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+TEST(ParserBenchmark, parseModels)
+{
+    // Report the number of files parsed per second using an increasing number
+    // of threads.
+
+    const size_t repeats = 10;
+    const std::vector<std::string> someFiles = {
+        resourcePath("sine_approximations.xml"),
+        resourcePath("invalid_cellml_2.0.xml"),
+        resourcePath("non_existent.xml"),
+        resourcePath("Ohara_Rudy_2011.cellml"),
+        resourcePath("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"),
+        resourcePath("generator/noble_model_1962/model.cellml"),
+        resourcePath("generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.cellml"),
+        resourcePath("generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml"),
+    };
+    std::vector<std::string> paths;
+
+    for (size_t i = 0; i < repeats; ++i) {
+        paths.insert(paths.end(), someFiles.begin(), someFiles.end());
+    }
+
+    libcellml::ParserPtr p = libcellml::Parser::create();
+    size_t maxThreads = std::max(size_t(std::thread::hardware_concurrency()), size_t(1));
+
+    for (size_t threads = 1; threads <= maxThreads; threads *= 2) {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<libcellml::Parser::ParsedModel> parsedModels = p->parseModels(paths, threads);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        EXPECT_EQ(paths.size(), parsedModels.size());
+
+        std::cout << "[ BENCHMARK] " << threads << " thread(s): "
+                  << size_t(double(paths.size()) / elapsed.count()) << " files/s" << std::endl;
+    }
+}
@@ -70,6 +70,27 @@ class GeneratorTestCase(unittest.TestCase):
         self.assertEqual(file_contents("generator/algebraic_eqn_computed_var_on_rhs/model.h"), g.interfaceCode())
         self.assertEqual(file_contents("generator/algebraic_eqn_computed_var_on_rhs/model.c"), g.implementationCode())
 
+    def test_modified_methods(self):
+        from libcellml import Parser
+        from libcellml import Generator
+
+        p = Parser()
+        m = p.parseModel(file_contents('generator/algebraic_eqn_computed_var_on_rhs/model.cellml'))
+
+        g = Generator()
+
+        self.assertFalse(g.isMethodModified(Generator.Method.COMPUTE_VARIABLES))
+
+        g.processModel(m)
+
+        self.assertTrue(g.isMethodModified(Generator.Method.INITIALIZE_STATES_AND_CONSTANTS))
+        self.assertTrue(g.isMethodModified(Generator.Method.COMPUTE_VARIABLES))
+
+        g.processModel(m)
+
+        self.assertFalse(g.isMethodModified(Generator.Method.INITIALIZE_STATES_AND_CONSTANTS))
+        self.assertFalse(g.isMethodModified(Generator.Method.COMPUTE_VARIABLES))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -21,6 +21,28 @@ class GeneratorProfileTestCase(unittest.TestCase):
         p.setProfile(GeneratorProfile.Profile.PYTHON)
         self.assertEqual(GeneratorProfile.Profile.PYTHON, p.profile())
 
+        p.setProfile(GeneratorProfile.Profile.C_STATIC)
+        self.assertEqual(GeneratorProfile.Profile.C_STATIC, p.profile())
+
+        p.setProfile(GeneratorProfile.Profile.PYTHON_NUMPY)
+        self.assertEqual(GeneratorProfile.Profile.PYTHON_NUMPY, p.profile())
+
+        self.assertEqual(0, GeneratorProfile.Profile.C)
+        self.assertEqual(1, GeneratorProfile.Profile.PYTHON)
+        self.assertEqual(2, GeneratorProfile.Profile.C_STATIC)
+        self.assertEqual(3, GeneratorProfile.Profile.PYTHON_NUMPY)
+
+    def test_compute_precision(self):
+        from libcellml import GeneratorProfile
+
+        p = GeneratorProfile()
+        self.assertEqual(GeneratorProfile.Precision.DOUBLE, p.computePrecision())
+
+        p.setComputePrecision(GeneratorProfile.Precision.SINGLE)
+        self.assertEqual(GeneratorProfile.Precision.SINGLE, p.computePrecision())
+        self.assertEqual('float', p.computeTypeString())
+        self.assertEqual('f', p.numberSuffixString())
+
     def test_has_interface(self):
         from libcellml import GeneratorProfile
 
@@ -0,0 +1,63 @@
+#
+# Tests the ImportLibrary class bindings.
+#
+import unittest
+
+
+class ImportLibraryTestCase(unittest.TestCase):
+
+    def test_create_destroy(self):
+        from libcellml import ImportLibrary
+
+        x = ImportLibrary()
+        del(x)
+
+    def test_models(self):
+        from libcellml import ImportLibrary
+
+        x = ImportLibrary()
+
+        # size_t modelCount()
+        self.assertEqual(x.modelCount(), 0)
+
+        # bool hasModel(const std::string &url)
+        self.assertFalse(x.hasModel('non_existent.xml'))
+
+        # ModelPtr model(const std::string &url)
+        self.assertIsNone(x.model('non_existent.xml'))
+
+        # void removeAllModels()
+        x.removeAllModels()
+        self.assertEqual(x.modelCount(), 0)
+
+    def test_thread_count(self):
+        from libcellml import ImportLibrary
+
+        x = ImportLibrary()
+
+        # size_t threadCount()
+        self.assertEqual(x.threadCount(), 1)
+
+        # void setThreadCount(size_t threadCount)
+        x.setThreadCount(3)
+        self.assertEqual(x.threadCount(), 3)
+        x.setThreadCount(0)
+        self.assertEqual(x.threadCount(), 0)
+
+    def test_resolve_imports(self):
+        from libcellml import ImportLibrary, Model
+
+        x = ImportLibrary()
+
+        # void resolveImports(const ModelPtr &model, const std::string &baseFile)
+        x.resolveImports(Model(), 'file.txt')
+        self.assertEqual(x.modelCount(), 0)
+
+        # void Model::resolveImports(const std::string &baseFile, const ImportLibraryPtr &importLibrary)
+        m = Model()
+        m.resolveImports('file.txt', x)
+        self.assertFalse(m.hasUnresolvedImports())
+
+
+if __name__ == '__main__':
+    unittest.main()
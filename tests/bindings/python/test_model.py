@@ -243,6 +243,21 @@ class ModelTestCase(unittest.TestCase):
         m = Model()
         m.resolveImports('file.txt')
 
+    def test_revision(self):
+        from libcellml import Model, Component, Variable
+
+        # size_t revision()
+        m = Model()
+        c = Component()
+        v = Variable()
+        m.addComponent(c)
+        c.addVariable(v)
+        revision = m.revision()
+        self.assertEqual(revision, v.revision())
+        v.setInitialValue(3.0)
+        self.assertGreater(m.revision(), revision)
+        self.assertEqual(m.revision(), v.revision())
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -34,6 +34,44 @@ class ParserTestCase(unittest.TestCase):
         p = Parser()
         self.assertIsInstance(p.parseModel('rubbish'), libcellml.Model)
 
+    def test_parse_model_from_file(self):
+        from libcellml import Parser
+
+        # ModelPtr parseModelFromFile(const std::string &path)
+        p = Parser()
+        self.assertIsNone(p.parseModelFromFile('non_existent.xml'))
+        self.assertEqual(p.errorCount(), 1)
+
+    def test_parse_models(self):
+        import libcellml
+        from libcellml import Parser
+
+        # std::vector<ParsedModel> parseModels(const std::vector<std::string> &paths, size_t threads)
+        p = Parser()
+        parsed_models = p.parseModels(['non_existent.xml', 'also_non_existent.xml'], 1)
+        self.assertEqual(len(parsed_models), 2)
+        for model, errors in parsed_models:
+            self.assertIsNone(model)
+            self.assertEqual(len(errors), 1)
+            self.assertIsInstance(errors[0], libcellml.Error)
+        self.assertEqual(p.parseModels([], 0), [])
+        self.assertRaises(TypeError, p.parseModels, [1], 1)
+
+    def test_parse_model_snapshot(self):
+        from libcellml import Model, Parser, Printer
+
+        # ModelPtr parseModelSnapshot(const std::string &snapshot)
+        p = Parser()
+        snapshot = Printer().printModelSnapshot(Model('snapshot'))
+        m = p.parseModelSnapshot(snapshot)
+        self.assertIsInstance(m, Model)
+        self.assertEqual(m.name(), 'snapshot')
+        self.assertIsNone(p.parseModelSnapshot(b'rubbish'))
+        self.assertRaises(TypeError, p.parseModelSnapshot, 'rubbish')
+
+        # ModelPtr parseModelSnapshotFromFile(const std::string &path)
+        self.assertIsNone(p.parseModelSnapshotFromFile('non_existent.bin'))
+
 
-if __name__ == '__main__':
+if __name == '__main__':
     unittest.main()
@@ -39,6 +39,13 @@ class PrinterTestCase(unittest.TestCase):
         # std::string printModel(Model *model)
         # This method shadows printModel(ModelPtr) so wasn't added
 
+    def test_print_model_snapshot(self):
+        from libcellml import Printer, Model
+
+        # std::string printModelSnapshot(const ModelPtr &model)
+        p = Printer()
+        self.assertIsInstance(p.printModelSnapshot(Model()), bytes)
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -35,6 +35,14 @@ class ValidatorTestCase(unittest.TestCase):
         v = Validator()
         v.validateModel(libcellml.Model())
 
+    def test_mathml_validation(self):
+        from libcellml import Validator
+
+        v = Validator()
+        self.assertEqual(Validator.MathMLValidation.DTD, v.mathmlValidation())
+        v.setMathMLValidation(Validator.MathMLValidation.NATIVE)
+        self.assertEqual(Validator.MathMLValidation.NATIVE, v.mathmlValidation())
+
 
 if __name__ == '__main__':
     unittest.main()
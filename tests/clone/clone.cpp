@@ -600,3 +600,113 @@ TEST(Clone, generateFromClonedModel)
 
     EXPECT_EQ(p->printModel(model), p->printModel(clonedModel));
 }
+
+TEST(Clone, modelWithVariableEquivalenceIds)
+{
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <units name=\"ms\">\n"
+        "    <unit prefix=\"milli\" units=\"second\"/>\n"
+        "  </units>\n"
+        "  <component name=\"component1\">\n"
+        "    <variable name=\"t\" units=\"ms\" interface=\"public\"/>\n"
+        "  </component>\n"
+        "  <component name=\"component2\">\n"
+        "    <variable name=\"t\" units=\"ms\" interface=\"public\"/>\n"
+        "  </component>\n"
+        "  <connection component_1=\"component1\" component_2=\"component2\" id=\"connection_id\">\n"
+        "    <map_variables variable_1=\"t\" variable_2=\"t\" id=\"t_mapping_id\"/>\n"
+        "  </connection>\n"
+        "</model>\n";
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(in);
+    libcellml::ModelPtr clonedModel = model->clone();
+
+    compareModel(model, clonedModel);
+
+    auto v1 = clonedModel->component("component1")->variable("t");
+    auto v2 = clonedModel->component("component2")->variable("t");
+
+    EXPECT_EQ("t_mapping_id", libcellml::Variable::equivalenceMappingId(v1, v2));
+    EXPECT_EQ("connection_id", libcellml::Variable::equivalenceConnectionId(v1, v2));
+
+    // The variables of the cloned model use the units of the cloned model.
+
+    EXPECT_EQ(clonedModel->units("ms"), v1->units());
+    EXPECT_NE(model->units("ms"), v1->units());
+    EXPECT_FALSE(clonedModel->hasUnlinkedUnits());
+
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+
+    EXPECT_EQ(in, printer->printModel(clonedModel));
+}
+
+TEST(Clone, componentMathCopiedOnWrite)
+{
+    const std::string math =
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "  <apply>\n"
+        "    <eq/>\n"
+        "    <ci>x</ci>\n"
+        "    <cn>1</cn>\n"
+        "  </apply>\n"
+        "</math>\n";
+    const std::string otherMath = "<math xmlns=\"http://www.w3.org/1998/Math/MathML\"/>\n";
+
+    auto c = libcellml::Component::create("component");
+
+    c->appendMath(math);
+
+    auto cClone = c->clone();
+    auto cOtherClone = c->clone();
+
+    EXPECT_EQ(math, cClone->math());
+
+    // Modifying the math of a clone does not affect the original component or
+    // its other clones, and vice versa.
+
+    cClone->appendMath(otherMath);
+
+    EXPECT_EQ(math, c->math());
+    EXPECT_EQ(math, cOtherClone->math());
+    EXPECT_EQ(math + otherMath, cClone->math());
+
+    c->setMath(otherMath);
+
+    EXPECT_EQ(otherMath, c->math());
+    EXPECT_EQ(math, cOtherClone->math());
+
+    cOtherClone->removeMath();
+
+    EXPECT_EQ("", cOtherClone->math());
+    EXPECT_EQ(otherMath, c->math());
+    EXPECT_EQ(math + otherMath, cClone->math());
+}
+
+TEST(Clone, generateFromModifiedClonedModel)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    std::string implementationCode = generator->implementationCode();
+
+    // Clones share the math of the original model, so modifying that of a
+    // clone must not affect the original model.
+
+    auto clonedModel = model->clone();
+
+    clonedModel->component("membrane")->removeMath();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(implementationCode, generator->implementationCode());
+
+    generator->processModel(clonedModel);
+
+    EXPECT_NE(size_t(0), generator->errorCount());
+}
@@ -0,0 +1,248 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+
+#ifndef _WIN32
+#    include <dirent.h>
+#    include <sys/stat.h>
+
+#    ifdef __APPLE__
+static const std::string SHARED_LIBRARY_EXTENSION = ".dylib";
+#    else
+static const std::string SHARED_LIBRARY_EXTENSION = ".so";
+#    endif
+#endif
+
+static std::string uniqueCacheDirectory()
+{
+    return testing::TempDir() + "libcellml_compiled_model_cache_"
+           + std::to_string(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+}
+
+static libcellml::ModelPtr hodgkinHuxleyModel()
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+
+    return parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+}
+
+static libcellml::GeneratorPtr processedGenerator(const libcellml::ModelPtr &model)
+{
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    return generator;
+}
+
+TEST(CompiledModelCache, settings)
+{
+    libcellml::CompiledModelCachePtr compiledModelCache = libcellml::CompiledModelCache::create();
+
+    EXPECT_NE(std::string::npos, compiledModelCache->cacheDirectory().find("libcellml"));
+    EXPECT_NE(std::string::npos, compiledModelCache->compilerCommand().find("<INPUT>"));
+    EXPECT_NE(std::string::npos, compiledModelCache->compilerCommand().find("<OUTPUT>"));
+
+    compiledModelCache->setCacheDirectory("some/directory");
+    compiledModelCache->setCompilerCommand("some command");
+
+    EXPECT_EQ("some/directory", compiledModelCache->cacheDirectory());
+    EXPECT_EQ("some command", compiledModelCache->compilerCommand());
+}
+
+TEST(CompiledModelCache, invalidGenerator)
+{
+    const std::vector<std::string> expectedErrors = {
+        "The generator has not processed a valid model.",
+        "The generator has not processed a valid model.",
+        "The generator profile does not generate double precision C code with an interface.",
+    };
+
+    libcellml::CompiledModelCachePtr compiledModelCache = libcellml::CompiledModelCache::create();
+
+    EXPECT_EQ(nullptr, compiledModelCache->methods(nullptr).computeRates);
+    EXPECT_EQ(nullptr, compiledModelCache->methods(libcellml::Generator::create()).computeRates);
+
+    libcellml::ModelPtr model = hodgkinHuxleyModel();
+    libcellml::GeneratorPtr generator = processedGenerator(model);
+
+    generator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON));
+
+    EXPECT_EQ(nullptr, compiledModelCache->methods(generator).computeRates);
+
+    EXPECT_EQ_ERRORS(expectedErrors, compiledModelCache);
+}
+
+#ifndef _WIN32
+TEST(CompiledModelCache, invalidCompilerCommand)
+{
+    const std::vector<std::string> expectedErrors = {
+        "Compiler command 'cc -o <OUTPUT>' does not contain both the <INPUT> and <OUTPUT> placeholders.",
+    };
+
+    libcellml::ModelPtr model = hodgkinHuxleyModel();
+    libcellml::CompiledModelCachePtr compiledModelCache = libcellml::CompiledModelCache::create();
+
+    compiledModelCache->setCacheDirectory(uniqueCacheDirectory());
+    compiledModelCache->setCompilerCommand("cc -o <OUTPUT>");
+
+    EXPECT_EQ(nullptr, compiledModelCache->methods(processedGenerator(model)).computeRates);
+
+    EXPECT_EQ_ERRORS(expectedErrors, compiledModelCache);
+
+    compiledModelCache->removeAllErrors();
+    compiledModelCache->setCompilerCommand("false <INPUT> <OUTPUT>");
+
+    EXPECT_EQ(nullptr, compiledModelCache->methods(processedGenerator(model)).computeRates);
+    EXPECT_EQ(size_t(1), compiledModelCache->errorCount());
+}
+
+TEST(CompiledModelCache, nonPrivateCacheDirectory)
+{
+    // A cache directory that other users can modify must not be used.
+
+    std::string cacheDirectory = uniqueCacheDirectory();
+    const std::vector<std::string> expectedErrors = {
+        "Cache directory '" + cacheDirectory + "' does not belong to the current user or can be modified by other users.",
+    };
+
+    mkdir(cacheDirectory.c_str(), 0700);
+    chmod(cacheDirectory.c_str(), 0777);
+
+    libcellml::CompiledModelCachePtr compiledModelCache = libcellml::CompiledModelCache::create();
+
+    compiledModelCache->setCacheDirectory(cacheDirectory);
+
+    EXPECT_EQ(nullptr, compiledModelCache->methods(processedGenerator(hodgkinHuxleyModel())).computeRates);
+
+    EXPECT_EQ_ERRORS(expectedErrors, compiledModelCache);
+
+    rmdir(cacheDirectory.c_str());
+}
+
+TEST(CompiledModelCache, hodgkinHuxleySquidAxonModel1952)
+{
+    // Use a compiler command that keeps track of the number of times it has
+    // been invoked.
+
+    std::string cacheDirectory = uniqueCacheDirectory();
+    std::string compilationLog = cacheDirectory + ".log";
+    std::string compilerCommand = libcellml::CompiledModelCache::create()->compilerCommand() + " && echo compiled >> \"" + compilationLog + "\"";
+    libcellml::ModelPtr model = hodgkinHuxleyModel();
+    libcellml::GeneratorPtr generator = processedGenerator(model);
+    libcellml::CompiledModelCachePtr compiledModelCache = libcellml::CompiledModelCache::create();
+
+    compiledModelCache->setCacheDirectory(cacheDirectory);
+    compiledModelCache->setCompilerCommand(compilerCommand);
+
+    libcellml::CompiledModelCache::Methods methods = compiledModelCache->methods(generator);
+
+    EXPECT_EQ(size_t(0), compiledModelCache->errorCount());
+    ASSERT_NE(nullptr, methods.initializeStatesAndConstants);
+    ASSERT_NE(nullptr, methods.computeComputedConstants);
+    ASSERT_NE(nullptr, methods.computeRates);
+    ASSERT_NE(nullptr, methods.computeVariables);
+
+    std::vector<double> states(generator->stateCount());
+    std::vector<double> rates(generator->stateCount());
+    std::vector<double> variables(generator->variableCount());
+
+    methods.initializeStatesAndConstants(states.data(), variables.data());
+    methods.computeComputedConstants(variables.data());
+    methods.computeRates(0.0, states.data(), rates.data(), variables.data());
+    methods.computeVariables(0.0, states.data(), rates.data(), variables.data());
+
+    EXPECT_EQ(0.05, states[0]);
+    EXPECT_EQ(0.6, states[1]);
+    EXPECT_EQ(0.325, states[2]);
+    EXPECT_EQ(0.0, states[3]);
+    EXPECT_EQ(-10.613, variables[6]);
+    EXPECT_EQ(-115.0, variables[8]);
+    EXPECT_EQ(12.0, variables[14]);
+
+    // Asking again for the same model must give us the same methods.
+
+    EXPECT_EQ(methods.computeRates, compiledModelCache->methods(processedGenerator(model)).computeRates);
+
+    // A new cache using the same cache directory must find the compiled model
+    // on disk, i.e. without compiling it again.
+
+    libcellml::CompiledModelCachePtr otherCompiledModelCache = libcellml::CompiledModelCache::create();
+
+    otherCompiledModelCache->setCacheDirectory(cacheDirectory);
+    otherCompiledModelCache->setCompilerCommand(compilerCommand);
+
+    EXPECT_NE(nullptr, otherCompiledModelCache->methods(generator).computeRates);
+    EXPECT_EQ(size_t(0), otherCompiledModelCache->errorCount());
+
+    std::ifstream log(compilationLog);
+    std::string line;
+    size_t compilationCount = 0;
+
+    while (std::getline(log, line)) {
+        ++compilationCount;
+    }
+
+    EXPECT_EQ(size_t(1), compilationCount);
+
+    std::remove(compilationLog.c_str());
+
+    // The cache directory must only contain our model directory, i.e. no
+    // temporary files must have been left behind, and the shared library must
+    // only be accessible to the current user.
+
+    std::vector<std::string> modelDirectories;
+    DIR *directory = opendir(cacheDirectory.c_str());
+
+    for (struct dirent *entry = readdir(directory); entry != nullptr; entry = readdir(directory)) {
+        if (entry->d_name[0] != '.') {
+            modelDirectories.emplace_back(entry->d_name);
+        }
+    }
+
+    closedir(directory);
+
+    ASSERT_EQ(size_t(1), modelDirectories.size());
+
+    std::string library = cacheDirectory + "/" + modelDirectories.front() + "/model" + SHARED_LIBRARY_EXTENSION;
+    struct stat info = {};
+
+    ASSERT_EQ(0, stat(library.c_str(), &info));
+    EXPECT_EQ(0, int(info.st_mode & (S_IWGRP | S_IWOTH)));
+
+    // A shared library that other users can modify must not be loaded.
+
+    chmod(library.c_str(), 0777);
+
+    libcellml::CompiledModelCachePtr yetAnotherCompiledModelCache = libcellml::CompiledModelCache::create();
+
+    yetAnotherCompiledModelCache->setCacheDirectory(cacheDirectory);
+    yetAnotherCompiledModelCache->setCompilerCommand(compilerCommand);
+
+    EXPECT_EQ(nullptr, yetAnotherCompiledModelCache->methods(generator).computeRates);
+    EXPECT_EQ("Shared library '" + library + "' does not belong to the current user or can be modified by other users.",
+              yetAnotherCompiledModelCache->error(0)->description());
+}
+#endif
@@ -1093,12 +1093,40 @@ TEST(Generator, hodgkinHuxleySquidAxonModel1952)
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.h"), generator->interfaceCode());
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.c"), generator->implementationCode());
 
+    generator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::C_STATIC));
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.static.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.static.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr floatProfile = libcellml::GeneratorProfile::create();
+
+    floatProfile->setStatesTypeString("float");
+    floatProfile->setVariablesTypeString("float");
+    floatProfile->setComputePrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    generator->setProfile(floatProfile);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.float.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.float.c"), generator->implementationCode());
+
+    // Single precision storage with double precision computations.
+
+    floatProfile->setComputePrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.mixed.c"), generator->implementationCode());
+
     libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
 
     generator->setProfile(profile);
 
     EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
+
+    generator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON_NUMPY));
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.numpy.py"), generator->implementationCode());
 }
 
 TEST(Generator, nobleModel1962)
@@ -1136,6 +1164,120 @@ TEST(Generator, nobleModel1962)
     EXPECT_EQ(fileContents("generator/noble_model_1962/model.py"), generator->implementationCode());
 }
 
+TEST(Generator, resets)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/resets/model.cellml"));
+
+    EXPECT_EQ(size_t(0), parser->errorCount());
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(size_t(0), generator->errorCount());
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+
+    EXPECT_EQ(size_t(2), generator->stateCount());
+    EXPECT_EQ(size_t(5), generator->variableCount());
+
+    EXPECT_EQ(fileContents("generator/resets/model.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/resets/model.c"), generator->implementationCode());
+
+    generator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::C_STATIC));
+
+    EXPECT_EQ(fileContents("generator/resets/model.static.h"), generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/resets/model.static.c"), generator->implementationCode());
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/resets/model.py"), generator->implementationCode());
+}
+
+TEST(Generator, invalidResets)
+{
+    const std::vector<std::string> expectedErrors = {
+        "Reset in component 'main' of model 'resets' must have a variable, a test variable, a test value and a reset value.",
+        "The test value and the reset value of reset in component 'main' of model 'resets' must each consist of a single MathML expression.",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/resets/model.cellml"));
+    libcellml::ComponentPtr component = model->component("main");
+
+    component->reset(0)->removeResetValue();
+    component->reset(1)->setTestValue("<math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+                                      "  <ci>v_th</ci>\n"
+                                      "  <ci>v_reset</ci>\n"
+                                      "</math>\n");
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ_ERRORS(expectedErrors, generator);
+
+    EXPECT_EQ(libcellml::Generator::ModelType::INVALID, generator->modelType());
+}
+
+TEST(Generator, resetOfNonStateVariable)
+{
+    const std::vector<std::string> expectedErrors = {
+        "Variable 'tau' in component 'main' of model 'resets' is reset, but it is not a state variable.",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/resets/model.cellml"));
+    libcellml::ComponentPtr component = model->component("main");
+
+    component->reset(1)->setVariable(component->variable("tau"));
+
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ_ERRORS(expectedErrors, generator);
+
+    EXPECT_EQ(libcellml::Generator::ModelType::INVALID, generator->modelType());
+    EXPECT_EQ(EMPTY_STRING, generator->implementationCode());
+}
+
+TEST(Generator, fingerprint)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    EXPECT_EQ(EMPTY_STRING, generator->fingerprint());
+
+    generator->processModel(model);
+
+    std::string fingerprint = generator->fingerprint();
+
+    EXPECT_EQ(size_t(40), fingerprint.size());
+
+    libcellml::ModelPtr otherModel = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    libcellml::GeneratorPtr otherGenerator = libcellml::Generator::create();
+
+    otherGenerator->processModel(otherModel);
+
+    EXPECT_EQ(fingerprint, otherGenerator->fingerprint());
+
+    otherGenerator->setProfile(libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON));
+
+    EXPECT_NE(fingerprint, otherGenerator->fingerprint());
+
+    model->component("membrane")->variable("Cm")->setInitialValue("2.0");
+
+    generator->processModel(model);
+
+    EXPECT_NE(fingerprint, generator->fingerprint());
+}
+
 TEST(Generator, coverage)
 {
     libcellml::ParserPtr parser = libcellml::Parser::create();
@@ -1165,6 +1307,16 @@ TEST(Generator, coverage)
 
     libcellml::GeneratorProfilePtr profile = generator->profile();
 
+    profile->setStatesTypeString("float");
+    profile->setVariablesTypeString("float");
+    profile->setComputePrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ(fileContents("generator/coverage/model.float.c"), generator->implementationCode());
+
+    profile->setStatesTypeString("double");
+    profile->setVariablesTypeString("double");
+    profile->setComputePrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+
     profile->setInterfaceCreateStatesArrayMethodString("double * createStatesVector();\n");
     profile->setImplementationCreateStatesArrayMethodString("double * createStatesVector()\n"
                                                             "{\n"
@@ -1309,4 +1461,9 @@ TEST(Generator, coverage)
 
     EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
     EXPECT_EQ(fileContents("generator/coverage/model.modified.profile.py"), generator->implementationCode());
+
+    profile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON_NUMPY);
+
+    EXPECT_EQ(EMPTY_STRING, generator->interfaceCode());
+    EXPECT_EQ(fileContents("generator/coverage/model.numpy.py"), generator->implementationCode());
 }
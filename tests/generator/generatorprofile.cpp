@@ -42,6 +42,16 @@ TEST(GeneratorProfile, defaultGeneralValues)
     EXPECT_EQ(true, generatorProfile->hasInterface());
 }
 
+TEST(GeneratorProfile, profileValues)
+{
+    // New profiles are appended so that existing values remain stable.
+
+    EXPECT_EQ(0, static_cast<int>(libcellml::GeneratorProfile::Profile::C));
+    EXPECT_EQ(1, static_cast<int>(libcellml::GeneratorProfile::Profile::PYTHON));
+    EXPECT_EQ(2, static_cast<int>(libcellml::GeneratorProfile::Profile::C_STATIC));
+    EXPECT_EQ(3, static_cast<int>(libcellml::GeneratorProfile::Profile::PYTHON_NUMPY));
+}
+
 TEST(GeneratorProfile, defaultRelationalAndLogicalOperatorValues)
 {
     libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
@@ -160,18 +170,18 @@ TEST(GeneratorProfile, defaultArithmeticFunctionValues)
     EXPECT_EQ("", generatorProfile->geqFunctionString());
     EXPECT_EQ("", generatorProfile->andFunctionString());
     EXPECT_EQ("", generatorProfile->orFunctionString());
-    EXPECT_EQ("double xor(double x, double y)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> xor(<COMPUTE_TYPE> x, <COMPUTE_TYPE> y)\n"
               "{\n"
               "    return (x != 0.0) ^ (y != 0.0);\n"
               "}\n",
               generatorProfile->xorFunctionString());
     EXPECT_EQ("", generatorProfile->notFunctionString());
-    EXPECT_EQ("double min(double x, double y)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> min(<COMPUTE_TYPE> x, <COMPUTE_TYPE> y)\n"
               "{\n"
               "    return (x < y)?x:y;\n"
               "}\n",
               generatorProfile->minFunctionString());
-    EXPECT_EQ("double max(double x, double y)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> max(<COMPUTE_TYPE> x, <COMPUTE_TYPE> y)\n"
               "{\n"
               "    return (x > y)?x:y;\n"
               "}\n",
@@ -182,68 +192,68 @@ TEST(GeneratorProfile, defaultTrigonometricFunctionValues)
 {
     libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
 
-    EXPECT_EQ("double sec(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> sec(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return 1.0/cos(x);\n"
               "}\n",
               generatorProfile->secFunctionString());
-    EXPECT_EQ("double csc(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> csc(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return 1.0/sin(x);\n"
               "}\n",
               generatorProfile->cscFunctionString());
-    EXPECT_EQ("double cot(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> cot(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return 1.0/tan(x);\n"
               "}\n",
               generatorProfile->cotFunctionString());
-    EXPECT_EQ("double sech(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> sech(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return 1.0/cosh(x);\n"
               "}\n",
               generatorProfile->sechFunctionString());
-    EXPECT_EQ("double csch(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> csch(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return 1.0/sinh(x);\n"
               "}\n",
               generatorProfile->cschFunctionString());
-    EXPECT_EQ("double coth(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> coth(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return 1.0/tanh(x);\n"
               "}\n",
               generatorProfile->cothFunctionString());
-    EXPECT_EQ("double asec(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> asec(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return acos(1.0/x);\n"
               "}\n",
               generatorProfile->asecFunctionString());
-    EXPECT_EQ("double acsc(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> acsc(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return asin(1.0/x);\n"
               "}\n",
               generatorProfile->acscFunctionString());
-    EXPECT_EQ("double acot(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> acot(<COMPUTE_TYPE> x)\n"
               "{\n"
               "    return atan(1.0/x);\n"
               "}\n",
               generatorProfile->acotFunctionString());
-    EXPECT_EQ("double asech(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> asech(<COMPUTE_TYPE> x)\n"
               "{\n"
-              "    double oneOverX = 1.0/x;\n"
+              "    <COMPUTE_TYPE> oneOverX = 1.0/x;\n"
               "\n"
               "    return log(oneOverX+sqrt(oneOverX*oneOverX-1.0));\n"
               "}\n",
               generatorProfile->asechFunctionString());
-    EXPECT_EQ("double acsch(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> acsch(<COMPUTE_TYPE> x)\n"
               "{\n"
-              "    double oneOverX = 1.0/x;\n"
+              "    <COMPUTE_TYPE> oneOverX = 1.0/x;\n"
               "\n"
               "    return log(oneOverX+sqrt(oneOverX*oneOverX+1.0));\n"
               "}\n",
               generatorProfile->acschFunctionString());
-    EXPECT_EQ("double acoth(double x)\n"
+    EXPECT_EQ("<COMPUTE_TYPE> acoth(<COMPUTE_TYPE> x)\n"
               "{\n"
-              "    double oneOverX = 1.0/x;\n"
+              "    <COMPUTE_TYPE> oneOverX = 1.0/x;\n"
               "\n"
               "    return 0.5*log((1.0+oneOverX)/(1.0-oneOverX));\n"
               "}\n",
@@ -279,6 +289,12 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("extern const size_t VARIABLE_COUNT;\n", generatorProfile->interfaceVariableCountString());
     EXPECT_EQ("const size_t VARIABLE_COUNT = <VARIABLE_COUNT>;\n", generatorProfile->implementationVariableCountString());
 
+    EXPECT_EQ("extern const size_t ROOT_COUNT;\n", generatorProfile->interfaceRootCountString());
+    EXPECT_EQ("const size_t ROOT_COUNT = <ROOT_COUNT>;\n", generatorProfile->implementationRootCountString());
+
+    EXPECT_EQ("", generatorProfile->interfaceModelInstanceTypeString());
+    EXPECT_EQ("", generatorProfile->implementationModelInstanceTypeString());
+
     EXPECT_EQ("typedef enum {\n"
               "    CONSTANT,\n"
               "    COMPUTED_CONSTANT,\n"
@@ -328,65 +344,93 @@ TEST(GeneratorProfile, defaultMiscellaneousValues)
     EXPECT_EQ("rates", generatorProfile->ratesArrayString());
     EXPECT_EQ("variables", generatorProfile->variablesArrayString());
 
-    EXPECT_EQ("return (double *) malloc(<ARRAY_SIZE>*sizeof(double));\n",
+    EXPECT_EQ("roots", generatorProfile->rootsArrayString());
+    EXPECT_EQ("rootsFound", generatorProfile->rootsFoundArrayString());
+
+    EXPECT_EQ("<STATES_TYPE> resetValue<INDEX>", generatorProfile->resetValueDeclarationString());
+    EXPECT_EQ("resetValue<INDEX>", generatorProfile->resetValueString());
+
+    EXPECT_EQ("double", generatorProfile->statesTypeString());
+    EXPECT_EQ("double", generatorProfile->variablesTypeString());
+    EXPECT_EQ("double", generatorProfile->computeTypeString());
+
+    EXPECT_EQ("", generatorProfile->numberSuffixString());
+
+    EXPECT_EQ("return (<ARRAY_TYPE> *) malloc(<ARRAY_SIZE>*sizeof(<ARRAY_TYPE>));\n",
               generatorProfile->returnCreatedArrayString());
 
-    EXPECT_EQ("double * createStatesArray();\n",
+    EXPECT_EQ("<STATES_TYPE> * createStatesArray();\n",
               generatorProfile->interfaceCreateStatesArrayMethodString());
-    EXPECT_EQ("double * createStatesArray()\n"
+    EXPECT_EQ("<STATES_TYPE> * createStatesArray()\n"
               "{\n"
               "<CODE>"
               "}\n",
               generatorProfile->implementationCreateStatesArrayMethodString());
 
-    EXPECT_EQ("double * createVariablesArray();\n",
+    EXPECT_EQ("<VARIABLES_TYPE> * createVariablesArray();\n",
               generatorProfile->interfaceCreateVariablesArrayMethodString());
-    EXPECT_EQ("double * createVariablesArray()\n"
+    EXPECT_EQ("<VARIABLES_TYPE> * createVariablesArray()\n"
               "{\n"
               "<CODE>"
               "}\n",
               generatorProfile->implementationCreateVariablesArrayMethodString());
 
-    EXPECT_EQ("void deleteArray(double *array);\n",
+    EXPECT_EQ("void deleteArray(void *array);\n",
               generatorProfile->interfaceDeleteArrayMethodString());
-    EXPECT_EQ("void deleteArray(double *array)\n"
+    EXPECT_EQ("void deleteArray(void *array)\n"
               "{\n"
               "    free(array);\n"
               "}\n",
               generatorProfile->implementationDeleteArrayMethodString());
 
-    EXPECT_EQ("void initializeStatesAndConstants(double *states, double *variables);\n",
+    EXPECT_EQ("void initializeStatesAndConstants(<STATES_TYPE> *states, <VARIABLES_TYPE> *variables);\n",
               generatorProfile->interfaceInitializeStatesAndConstantsMethodString());
-    EXPECT_EQ("void initializeStatesAndConstants(double *states, double *variables)\n"
+    EXPECT_EQ("void initializeStatesAndConstants(<STATES_TYPE> *states, <VARIABLES_TYPE> *variables)\n"
               "{\n"
               "<CODE>"
               "}\n",
               generatorProfile->implementationInitializeStatesAndConstantsMethodString());
 
-    EXPECT_EQ("void computeComputedConstants(double *variables);\n",
+    EXPECT_EQ("void computeComputedConstants(<VARIABLES_TYPE> *variables);\n",
               generatorProfile->interfaceComputeComputedConstantsMethodString());
-    EXPECT_EQ("void computeComputedConstants(double *variables)\n"
+    EXPECT_EQ("void computeComputedConstants(<VARIABLES_TYPE> *variables)\n"
               "{\n"
               "<CODE>"
               "}\n",
               generatorProfile->implementationComputeComputedConstantsMethodString());
 
-    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *variables);\n",
+    EXPECT_EQ("void computeRates(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables);\n",
               generatorProfile->interfaceComputeRatesMethodString());
-    EXPECT_EQ("void computeRates(double voi, double *states, double *rates, double *variables)\n"
+    EXPECT_EQ("void computeRates(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables)\n"
               "{\n"
               "<CODE>"
               "}\n",
               generatorProfile->implementationComputeRatesMethodString());
 
-    EXPECT_EQ("void computeVariables(double voi, double *states, double *rates, double *variables);\n",
+    EXPECT_EQ("void computeVariables(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables);\n",
               generatorProfile->interfaceComputeVariablesMethodString());
-    EXPECT_EQ("void computeVariables(double voi, double *states, double *rates, double *variables)\n"
+    EXPECT_EQ("void computeVariables(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <STATES_TYPE> *rates, <VARIABLES_TYPE> *variables)\n"
               "{\n"
               "<CODE>"
               "}\n",
               generatorProfile->implementationComputeVariablesMethodString());
 
+    EXPECT_EQ("void computeRoots(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, <COMPUTE_TYPE> *roots);\n",
+              generatorProfile->interfaceComputeRootsMethodString());
+    EXPECT_EQ("void computeRoots(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, <COMPUTE_TYPE> *roots)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationComputeRootsMethodString());
+
+    EXPECT_EQ("void applyResets(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, int *rootsFound);\n",
+              generatorProfile->interfaceApplyResetsMethodString());
+    EXPECT_EQ("void applyResets(<COMPUTE_TYPE> voi, <STATES_TYPE> *states, <VARIABLES_TYPE> *variables, int *rootsFound)\n"
+              "{\n"
+              "<CODE>"
+              "}\n",
+              generatorProfile->implementationApplyResetsMethodString());
+
     EXPECT_EQ("", generatorProfile->emptyMethodString());
 
     EXPECT_EQ("    ", generatorProfile->indentString());
@@ -420,6 +464,61 @@ TEST(GeneratorProfile, generalSettings)
     EXPECT_EQ(falseValue, generatorProfile->hasInterface());
 }
 
+TEST(GeneratorProfile, computePrecision)
+{
+    libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::DOUBLE, generatorProfile->computePrecision());
+
+    generatorProfile->setComputePrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::SINGLE, generatorProfile->computePrecision());
+    EXPECT_EQ("double", generatorProfile->statesTypeString());
+    EXPECT_EQ("double", generatorProfile->variablesTypeString());
+    EXPECT_EQ("float", generatorProfile->computeTypeString());
+    EXPECT_EQ("f", generatorProfile->numberSuffixString());
+    EXPECT_EQ("powf", generatorProfile->powerString());
+    EXPECT_EQ("fmodf", generatorProfile->remString());
+    EXPECT_EQ("atanhf", generatorProfile->atanhString());
+    EXPECT_EQ("<COMPUTE_TYPE> sec(<COMPUTE_TYPE> x)\n"
+              "{\n"
+              "    return 1.0f/cosf(x);\n"
+              "}\n",
+              generatorProfile->secFunctionString());
+    EXPECT_EQ("<COMPUTE_TYPE> acoth(<COMPUTE_TYPE> x)\n"
+              "{\n"
+              "    <COMPUTE_TYPE> oneOverX = 1.0f/x;\n"
+              "\n"
+              "    return 0.5f*logf((1.0f+oneOverX)/(1.0f-oneOverX));\n"
+              "}\n",
+              generatorProfile->acothFunctionString());
+
+    // Going back to double precision restores the default profile.
+
+    generatorProfile->setComputePrecision(libcellml::GeneratorProfile::Precision::DOUBLE);
+
+    libcellml::GeneratorProfilePtr defaultGeneratorProfile = libcellml::GeneratorProfile::create();
+
+    EXPECT_EQ(defaultGeneratorProfile->computeTypeString(), generatorProfile->computeTypeString());
+    EXPECT_EQ(defaultGeneratorProfile->numberSuffixString(), generatorProfile->numberSuffixString());
+    EXPECT_EQ(defaultGeneratorProfile->powerString(), generatorProfile->powerString());
+    EXPECT_EQ(defaultGeneratorProfile->secFunctionString(), generatorProfile->secFunctionString());
+    EXPECT_EQ(defaultGeneratorProfile->acothFunctionString(), generatorProfile->acothFunctionString());
+
+    // A Python profile always computes in double precision.
+
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+    generatorProfile->setComputePrecision(libcellml::GeneratorProfile::Precision::SINGLE);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::SINGLE, generatorProfile->computePrecision());
+    EXPECT_EQ("", generatorProfile->numberSuffixString());
+    EXPECT_EQ("pow", generatorProfile->powerString());
+
+    generatorProfile->setProfile(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    EXPECT_EQ(libcellml::GeneratorProfile::Precision::DOUBLE, generatorProfile->computePrecision());
+}
+
 TEST(GeneratorProfile, relationalAndLogicalOperators)
 {
     libcellml::GeneratorProfilePtr generatorProfile = libcellml::GeneratorProfile::create();
@@ -711,6 +810,12 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceVariableCountString(value);
     generatorProfile->setImplementationVariableCountString(value);
 
+    generatorProfile->setInterfaceRootCountString(value);
+    generatorProfile->setImplementationRootCountString(value);
+
+    generatorProfile->setInterfaceModelInstanceTypeString(value);
+    generatorProfile->setImplementationModelInstanceTypeString(value);
+
     generatorProfile->setVariableTypeObjectString(value);
 
     generatorProfile->setConstantVariableTypeString(value);
@@ -738,6 +843,18 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setRatesArrayString(value);
     generatorProfile->setVariablesArrayString(value);
 
+    generatorProfile->setRootsArrayString(value);
+    generatorProfile->setRootsFoundArrayString(value);
+
+    generatorProfile->setResetValueDeclarationString(value);
+    generatorProfile->setResetValueString(value);
+
+    generatorProfile->setStatesTypeString(value);
+    generatorProfile->setVariablesTypeString(value);
+    generatorProfile->setComputeTypeString(value);
+
+    generatorProfile->setNumberSuffixString(value);
+
     generatorProfile->setReturnCreatedArrayString(value);
 
     generatorProfile->setInterfaceCreateStatesArrayMethodString(value);
@@ -761,6 +878,12 @@ TEST(GeneratorProfile, miscellaneous)
     generatorProfile->setInterfaceComputeVariablesMethodString(value);
     generatorProfile->setImplementationComputeVariablesMethodString(value);
 
+    generatorProfile->setInterfaceComputeRootsMethodString(value);
+    generatorProfile->setImplementationComputeRootsMethodString(value);
+
+    generatorProfile->setInterfaceApplyResetsMethodString(value);
+    generatorProfile->setImplementationApplyResetsMethodString(value);
+
     generatorProfile->setEmptyMethodString(value);
 
     generatorProfile->setIndentString(value);
@@ -795,6 +918,12 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceVariableCountString());
     EXPECT_EQ(value, generatorProfile->implementationVariableCountString());
 
+    EXPECT_EQ(value, generatorProfile->interfaceRootCountString());
+    EXPECT_EQ(value, generatorProfile->implementationRootCountString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceModelInstanceTypeString());
+    EXPECT_EQ(value, generatorProfile->implementationModelInstanceTypeString());
+
     EXPECT_EQ(value, generatorProfile->variableTypeObjectString());
 
     EXPECT_EQ(value, generatorProfile->constantVariableTypeString());
@@ -822,6 +951,18 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->ratesArrayString());
     EXPECT_EQ(value, generatorProfile->variablesArrayString());
 
+    EXPECT_EQ(value, generatorProfile->rootsArrayString());
+    EXPECT_EQ(value, generatorProfile->rootsFoundArrayString());
+
+    EXPECT_EQ(value, generatorProfile->resetValueDeclarationString());
+    EXPECT_EQ(value, generatorProfile->resetValueString());
+
+    EXPECT_EQ(value, generatorProfile->statesTypeString());
+    EXPECT_EQ(value, generatorProfile->variablesTypeString());
+    EXPECT_EQ(value, generatorProfile->computeTypeString());
+
+    EXPECT_EQ(value, generatorProfile->numberSuffixString());
+
     EXPECT_EQ(value, generatorProfile->returnCreatedArrayString());
 
     EXPECT_EQ(value, generatorProfile->interfaceCreateStatesArrayMethodString());
@@ -845,6 +986,12 @@ TEST(GeneratorProfile, miscellaneous)
     EXPECT_EQ(value, generatorProfile->interfaceComputeVariablesMethodString());
     EXPECT_EQ(value, generatorProfile->implementationComputeVariablesMethodString());
 
+    EXPECT_EQ(value, generatorProfile->interfaceComputeRootsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationComputeRootsMethodString());
+
+    EXPECT_EQ(value, generatorProfile->interfaceApplyResetsMethodString());
+    EXPECT_EQ(value, generatorProfile->implementationApplyResetsMethodString());
+
     EXPECT_EQ(value, generatorProfile->emptyMethodString());
 
     EXPECT_EQ(value, generatorProfile->indentString());
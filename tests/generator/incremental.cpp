@@ -0,0 +1,249 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+static const std::vector<libcellml::Generator::Method> METHODS = {
+    libcellml::Generator::Method::INITIALIZE_STATES_AND_CONSTANTS,
+    libcellml::Generator::Method::COMPUTE_COMPUTED_CONSTANTS,
+    libcellml::Generator::Method::COMPUTE_RATES,
+    libcellml::Generator::Method::COMPUTE_VARIABLES,
+    libcellml::Generator::Method::COMPUTE_ROOTS,
+    libcellml::Generator::Method::APPLY_RESETS,
+};
+
+static libcellml::ModelPtr generatorModel(const std::string &name)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+
+    return parser->parseModel(fileContents("generator/" + name + "/model.cellml"));
+}
+
+static std::vector<libcellml::Generator::Method> modifiedMethods(const libcellml::GeneratorPtr &generator)
+{
+    std::vector<libcellml::Generator::Method> res;
+
+    for (const auto &method : METHODS) {
+        if (generator->isMethodModified(method)) {
+            res.push_back(method);
+        }
+    }
+
+    return res;
+}
+
+static std::string freshImplementationCode(const libcellml::ModelPtr &model,
+                                           const libcellml::GeneratorProfilePtr &profile = nullptr)
+{
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    if (profile != nullptr) {
+        generator->setProfile(profile);
+    }
+
+    generator->processModel(model);
+
+    return generator->implementationCode();
+}
+
+TEST(IncrementalGeneration, noModifiedMethodsBeforeProcessing)
+{
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    EXPECT_TRUE(modifiedMethods(generator).empty());
+}
+
+TEST(IncrementalGeneration, initialValueModifications)
+{
+    libcellml::ModelPtr model = generatorModel("hodgkin_huxley_squid_axon_model_1952");
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+
+    libcellml::GeneratorVariablePtr variable = generator->variable(0);
+    std::string code = generator->implementationCode();
+
+    // Processing an unmodified model reuses our analysis and doesn't modify
+    // any method.
+
+    generator->processModel(model);
+
+    EXPECT_TRUE(modifiedMethods(generator).empty());
+    EXPECT_EQ(variable, generator->variable(0));
+    EXPECT_EQ(code, generator->implementationCode());
+
+    // Setting an initial value to its current value modifies the model, but
+    // not its code.
+
+    libcellml::VariablePtr gNa = model->component("sodium_channel", true)->variable("g_Na");
+    libcellml::VariablePtr m = model->component("sodium_channel_m_gate", true)->variable("m");
+
+    gNa->setInitialValue(gNa->initialValue());
+
+    generator->processModel(model);
+
+    EXPECT_TRUE(modifiedMethods(generator).empty());
+    EXPECT_EQ(code, generator->implementationCode());
+
+    // Modifying the initial value of a constant and of a state only modifies
+    // the initializeStatesAndConstants() method.
+
+    gNa->setInitialValue("100");
+    m->setInitialValue("0.1");
+
+    generator->processModel(model);
+
+    EXPECT_EQ(std::vector<libcellml::Generator::Method> {libcellml::Generator::Method::INITIALIZE_STATES_AND_CONSTANTS},
+              modifiedMethods(generator));
+    EXPECT_EQ(variable, generator->variable(0));
+    EXPECT_NE(code, generator->implementationCode());
+    EXPECT_EQ(freshImplementationCode(model), generator->implementationCode());
+
+    // The code of our methods must follow a change of profile.
+
+    libcellml::GeneratorProfilePtr profile = libcellml::GeneratorProfile::create(libcellml::GeneratorProfile::Profile::PYTHON);
+
+    generator->setProfile(profile);
+
+    EXPECT_EQ(freshImplementationCode(model, profile), generator->implementationCode());
+
+    // The code of our methods must also follow a modification of an initial
+    // value, even if the model hasn't been processed again since.
+
+    m->setInitialValue("0.2");
+
+    EXPECT_EQ(freshImplementationCode(model, profile), generator->implementationCode());
+}
+
+TEST(IncrementalGeneration, structuralModifications)
+{
+    libcellml::ModelPtr model = generatorModel("hodgkin_huxley_squid_axon_model_1952");
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    libcellml::GeneratorVariablePtr variable = generator->variable(0);
+    std::string code = generator->implementationCode();
+
+    // Modifying the units of a variable modifies the structure of the model, so
+    // our analysis cannot be reused.
+
+    libcellml::VariablePtr gL = model->component("leakage_current", true)->variable("g_L");
+
+    gL->setUnits("millivolt");
+
+    generator->processModel(model);
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+    EXPECT_NE(variable, generator->variable(0));
+    EXPECT_NE(code, generator->implementationCode());
+    EXPECT_EQ(freshImplementationCode(model), generator->implementationCode());
+
+    // Neither can it be reused if a variable is replaced with an identical
+    // copy of itself.
+
+    libcellml::ComponentPtr membrane = model->component("membrane");
+    libcellml::VariablePtr cm = membrane->variable("Cm");
+
+    membrane->removeVariable(cm);
+    membrane->addVariable(cm->clone());
+
+    generator->processModel(model);
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+    EXPECT_EQ(freshImplementationCode(model), generator->implementationCode());
+
+    // Removing the initial value of a constant results in an invalid model,
+    // the analysis of which is never reused.
+
+    gL->setInitialValue("");
+
+    generator->processModel(model);
+
+    EXPECT_EQ(libcellml::Generator::ModelType::UNDERCONSTRAINED, generator->modelType());
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+
+    generator->processModel(model);
+
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+
+    gL->setInitialValue("0.3");
+
+    generator->processModel(model);
+
+    EXPECT_EQ(libcellml::Generator::ModelType::ODE, generator->modelType());
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+    EXPECT_EQ(freshImplementationCode(model), generator->implementationCode());
+}
+
+TEST(IncrementalGeneration, resetModifications)
+{
+    libcellml::ModelPtr model = generatorModel("resets");
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    std::string code = generator->implementationCode();
+
+    // Modifying the initial value of a variable used by a reset only modifies
+    // the initializeStatesAndConstants() method.
+
+    model->component("main")->variable("v_th")->setInitialValue("2");
+
+    generator->processModel(model);
+
+    EXPECT_EQ(std::vector<libcellml::Generator::Method> {libcellml::Generator::Method::INITIALIZE_STATES_AND_CONSTANTS},
+              modifiedMethods(generator));
+    EXPECT_EQ(freshImplementationCode(model), generator->implementationCode());
+
+    // Modifying the order of a reset modifies the structure of the model.
+
+    libcellml::ResetPtr reset = model->component("main")->reset(0);
+
+    reset->setOrder(reset->order() + 10);
+
+    generator->processModel(model);
+
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+    EXPECT_NE(code, generator->implementationCode());
+    EXPECT_EQ(freshImplementationCode(model), generator->implementationCode());
+}
+
+TEST(IncrementalGeneration, otherModel)
+{
+    libcellml::ModelPtr model = generatorModel("hodgkin_huxley_squid_axon_model_1952");
+    libcellml::GeneratorPtr generator = libcellml::Generator::create();
+
+    generator->processModel(model);
+
+    // Processing a model that is identical to the one we processed is not the
+    // same as processing that model again.
+
+    libcellml::ModelPtr otherModel = model->clone();
+
+    generator->processModel(otherModel);
+
+    EXPECT_EQ(METHODS, modifiedMethods(generator));
+    EXPECT_EQ(freshImplementationCode(otherModel), generator->implementationCode());
+}
@@ -552,3 +552,147 @@ TEST(Model, setAndCheckIdsAllEntities)
     const std::string a = printer->printModel(m);
     EXPECT_EQ(a, e);
 }
+
+TEST(Model, lookUpEntitiesByNameAfterRenaming)
+{
+    libcellml::ModelPtr m = libcellml::Model::create("model");
+    libcellml::ComponentPtr c1 = libcellml::Component::create("c1");
+    libcellml::ComponentPtr c2 = libcellml::Component::create("c2");
+    libcellml::ComponentPtr c3 = libcellml::Component::create("c3");
+    libcellml::VariablePtr v = libcellml::Variable::create("v");
+    libcellml::UnitsPtr u = libcellml::Units::create("u");
+
+    m->addComponent(c1);
+    m->addComponent(c2);
+    c2->addComponent(c3);
+    c3->addVariable(v);
+    m->addUnits(u);
+
+    EXPECT_EQ(c1, m->component("c1"));
+    EXPECT_EQ(c3, m->component("c3"));
+    EXPECT_EQ(nullptr, m->component("c3", false));
+    EXPECT_EQ(v, c3->variable("v"));
+    EXPECT_EQ(u, m->units("u"));
+
+    // Renaming an entity must be reflected when looking it up by name.
+
+    c1->setName("renamedC1");
+    c3->setName("renamedC3");
+    v->setName("renamedV");
+    u->setName("renamedU");
+
+    EXPECT_EQ(nullptr, m->component("c1"));
+    EXPECT_EQ(c1, m->component("renamedC1"));
+    EXPECT_EQ(nullptr, m->component("c3"));
+    EXPECT_EQ(c3, m->component("renamedC3"));
+    EXPECT_TRUE(m->containsComponent("renamedC3"));
+    EXPECT_EQ(nullptr, c3->variable("v"));
+    EXPECT_EQ(v, c3->variable("renamedV"));
+    EXPECT_FALSE(m->hasUnits("u"));
+    EXPECT_EQ(u, m->units("renamedU"));
+
+    // So must adding, moving and removing components.
+
+    libcellml::ComponentPtr c4 = libcellml::Component::create("c4");
+
+    c3->addComponent(c4);
+
+    EXPECT_EQ(c4, m->component("c4"));
+
+    c1->addComponent(c4);
+
+    EXPECT_EQ(c4, m->component("c4"));
+    EXPECT_EQ(c4, c1->component("c4"));
+    EXPECT_EQ(nullptr, c2->component("c4"));
+
+    c1->removeComponent(c4);
+
+    EXPECT_EQ(nullptr, m->component("c4"));
+}
+
+TEST(Model, lookUpEntitiesByNameAfterMovingAndRenaming)
+{
+    // Adding a variable or units that is already owned moves it, so that a
+    // renamed entity is never left behind in the name index of a previous
+    // owner.
+
+    libcellml::ModelPtr m1 = libcellml::Model::create("m1");
+    libcellml::ModelPtr m2 = libcellml::Model::create("m2");
+    libcellml::ComponentPtr c1 = libcellml::Component::create("c1");
+    libcellml::ComponentPtr c2 = libcellml::Component::create("c2");
+    libcellml::VariablePtr v = libcellml::Variable::create("a");
+    libcellml::UnitsPtr u = libcellml::Units::create("u");
+
+    m1->addUnits(u);
+    m2->addUnits(u);
+    c1->addVariable(v);
+    c2->addVariable(v);
+
+    EXPECT_EQ(size_t(0), m1->unitsCount());
+    EXPECT_EQ(size_t(1), m2->unitsCount());
+    EXPECT_EQ(m2, u->parent());
+    EXPECT_EQ(size_t(0), c1->variableCount());
+    EXPECT_EQ(size_t(1), c2->variableCount());
+    EXPECT_EQ(c2, v->parent());
+
+    u->setName("renamed");
+    v->setName("b");
+
+    EXPECT_FALSE(m1->hasUnits("renamed"));
+    EXPECT_EQ(nullptr, m1->units("renamed"));
+    EXPECT_TRUE(m2->hasUnits("renamed"));
+    EXPECT_EQ(u, m2->units("renamed"));
+    EXPECT_FALSE(c1->hasVariable("b"));
+    EXPECT_EQ(nullptr, c1->variable("b"));
+    EXPECT_TRUE(c2->hasVariable("b"));
+    EXPECT_EQ(v, c2->variable("b"));
+
+    // Adding an entity to its current owner moves it to the end of its list.
+
+    libcellml::UnitsPtr other = libcellml::Units::create("other");
+
+    m2->addUnits(other);
+    m2->addUnits(u);
+
+    EXPECT_EQ(size_t(2), m2->unitsCount());
+    EXPECT_EQ(other, m2->units(0));
+    EXPECT_EQ(u, m2->units(1));
+    EXPECT_EQ(u, m2->units("renamed"));
+}
+
+TEST(Model, lookUpEntitiesWithSameName)
+{
+    // The first entity with a given name is the one that is found, whatever
+    // the order in which entities are added, removed and renamed.
+
+    libcellml::ModelPtr m = libcellml::Model::create("model");
+    libcellml::ComponentPtr c1 = libcellml::Component::create("c");
+    libcellml::ComponentPtr c2 = libcellml::Component::create("c");
+    libcellml::ComponentPtr c3 = libcellml::Component::create("other");
+    libcellml::ComponentPtr c4 = libcellml::Component::create("d");
+    libcellml::ComponentPtr c5 = libcellml::Component::create("d");
+
+    m->addComponent(c1);
+    m->addComponent(c2);
+    m->addComponent(c3);
+    c3->addComponent(c4);
+    m->addComponent(c5);
+
+    EXPECT_EQ(c1, m->component("c"));
+    EXPECT_EQ(c5, m->component("d"));
+    EXPECT_EQ(c4, c3->component("d"));
+
+    m->removeComponent(c1);
+
+    EXPECT_EQ(c2, m->component("c"));
+
+    c3->setName("c");
+    m->removeComponent(c2);
+
+    EXPECT_EQ(c3, m->component("c"));
+
+    m->removeComponent(c5);
+
+    EXPECT_EQ(c4, m->component("d"));
+    EXPECT_EQ(nullptr, m->component("d", false));
+}
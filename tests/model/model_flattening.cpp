@@ -163,7 +163,8 @@ TEST(ModelFlattening, importedComponent)
         "      <apply id=\"actual_sin\">\n"
         "        <eq/>\n"
         "        <ci>sin</ci>\n"
-        "        <apply><sin/>\n"
+        "        <apply>\n"
+        "          <sin/>\n"
         "          <ci>x</ci>\n"
         "        </apply>\n"
         "      </apply>\n"
@@ -622,3 +623,60 @@ TEST(ModelFlattening, hodgkinHuxleyDefinedUsingImports)
     EXPECT_EQ("", generator->interfaceCode());
     EXPECT_EQ(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.py"), generator->implementationCode());
 }
+
+TEST(ModelFlattening, manyImportedInstances)
+{
+    auto model = createModelWithImportedInstances(3);
+
+    model->flatten();
+
+    EXPECT_FALSE(model->hasImports());
+    EXPECT_EQ(size_t(1), model->unitsCount());
+    EXPECT_EQ("channel", model->component("cell_0")->component(0)->name());
+    EXPECT_EQ("channel_1", model->component("cell_1")->component(0)->name());
+    EXPECT_EQ("channel_2", model->component("cell_2")->component(0)->name());
+
+    auto cellV = model->component("cell_2")->variable("V");
+
+    EXPECT_EQ(size_t(2), cellV->equivalentVariableCount());
+    EXPECT_TRUE(cellV->hasEquivalentVariable(model->component("electrode_2")->variable("V")));
+    EXPECT_TRUE(cellV->hasEquivalentVariable(model->component("channel_2")->variable("V")));
+
+    // All the instances share the model's units rather than having their own
+    // copy of them.
+
+    auto mV = model->units("mV");
+
+    EXPECT_EQ(mV, model->component("cell_1")->variable("V")->units());
+    EXPECT_EQ(mV, model->component("cell_2")->variable("V")->units());
+    EXPECT_EQ(mV, model->component("channel_1")->variable("V")->units());
+    EXPECT_FALSE(model->hasUnlinkedUnits());
+
+    auto validator = libcellml::Validator::create();
+
+    validator->validateModel(model);
+
+    EXPECT_EQ(size_t(0), validator->errorCount());
+}
+
+TEST(ModelFlattening, namesWithManyImportedInstances)
+{
+    // Each instance gets its own copy of the channel, whose name is made
+    // unique using the next free suffix.
+
+    const size_t instanceCount = 1000;
+    auto model = createModelWithImportedInstances(instanceCount);
+
+    model->flatten();
+
+    EXPECT_FALSE(model->hasImports());
+    EXPECT_EQ(2 * instanceCount, model->componentCount());
+    EXPECT_EQ("channel", model->component("cell_0")->component(0)->name());
+
+    for (size_t i = 1; i < instanceCount; ++i) {
+        auto channel = model->component("cell_" + std::to_string(i))->component(0);
+
+        EXPECT_EQ("channel_" + std::to_string(i), channel->name());
+        EXPECT_TRUE(channel->variable("V")->hasEquivalentVariable(model->component("cell_" + std::to_string(i))->variable("V")));
+    }
+}
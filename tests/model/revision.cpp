@@ -0,0 +1,181 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include "test_utils.h"
+
+TEST(Revision, newEntities)
+{
+    auto model = libcellml::Model::create();
+    auto component = libcellml::Component::create();
+
+    EXPECT_LT(model->revision(), component->revision());
+}
+
+TEST(Revision, modificationsPropagateToAncestors)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto membrane = model->component("membrane");
+    auto sodiumChannel = model->component("sodium_channel");
+    auto potassiumChannel = model->component("potassium_channel");
+    auto revision = model->revision();
+
+    EXPECT_LE(membrane->revision(), revision);
+    EXPECT_LE(sodiumChannel->revision(), revision);
+
+    // Modifying a variable modifies its component and model, but nothing else.
+
+    sodiumChannel->variable("g_Na")->setInitialValue(120.5);
+
+    EXPECT_LT(revision, model->revision());
+    EXPECT_EQ(model->revision(), sodiumChannel->revision());
+    EXPECT_EQ(model->revision(), sodiumChannel->variable("g_Na")->revision());
+    EXPECT_LE(potassiumChannel->revision(), revision);
+    EXPECT_LE(membrane->revision(), revision);
+
+    // Modifying the math of a component.
+
+    revision = model->revision();
+
+    potassiumChannel->appendMath("");
+
+    EXPECT_LT(revision, model->revision());
+    EXPECT_EQ(model->revision(), potassiumChannel->revision());
+    EXPECT_LE(sodiumChannel->revision(), revision);
+
+    // Modifying the units of the model.
+
+    revision = model->revision();
+
+    model->units("millivolt")->addUnit("second", 0.0);
+
+    EXPECT_LT(revision, model->revision());
+    EXPECT_EQ(model->revision(), model->units("millivolt")->revision());
+}
+
+TEST(Revision, equivalences)
+{
+    auto model = libcellml::Model::create();
+    auto component1 = libcellml::Component::create("component1");
+    auto component2 = libcellml::Component::create("component2");
+    auto component3 = libcellml::Component::create("component3");
+    auto variable1 = libcellml::Variable::create("variable");
+    auto variable2 = libcellml::Variable::create("variable");
+    auto variable3 = libcellml::Variable::create("variable");
+
+    model->addComponent(component1);
+    model->addComponent(component2);
+    model->addComponent(component3);
+    component1->addVariable(variable1);
+    component2->addVariable(variable2);
+    component3->addVariable(variable3);
+
+    auto revision = model->revision();
+
+    libcellml::Variable::addEquivalence(variable1, variable2);
+
+    EXPECT_LT(revision, component1->revision());
+    EXPECT_LT(revision, component2->revision());
+    EXPECT_GE(revision, component3->revision());
+
+    revision = model->revision();
+
+    libcellml::Variable::setEquivalenceMappingId(variable1, variable2, "mapping");
+
+    EXPECT_LT(revision, variable1->revision());
+    EXPECT_LT(revision, variable2->revision());
+
+    revision = model->revision();
+
+    libcellml::Variable::removeEquivalence(variable1, variable3);
+
+    EXPECT_EQ(revision, model->revision());
+
+    libcellml::Variable::removeEquivalence(variable1, variable2);
+
+    EXPECT_LT(revision, variable1->revision());
+    EXPECT_LT(revision, variable2->revision());
+}
+
+TEST(Revision, resets)
+{
+    auto model = libcellml::Model::create();
+    auto component = libcellml::Component::create();
+    auto reset = libcellml::Reset::create();
+
+    model->addComponent(component);
+    component->addReset(reset);
+
+    EXPECT_EQ(component, reset->parent());
+
+    auto revision = model->revision();
+
+    reset->setResetValue("<math xmlns=\"http://www.w3.org/1998/Math/MathML\"><cn>1</cn></math>");
+
+    EXPECT_LT(revision, model->revision());
+    EXPECT_EQ(model->revision(), reset->revision());
+
+    component->removeReset(reset);
+
+    EXPECT_EQ(nullptr, reset->parent());
+
+    revision = model->revision();
+
+    reset->setOrder(3);
+
+    EXPECT_EQ(revision, model->revision());
+}
+
+TEST(Revision, structure)
+{
+    auto model = libcellml::Model::create();
+    auto component = libcellml::Component::create("component");
+    auto units = libcellml::Units::create("units");
+    auto revision = model->revision();
+
+    model->addComponent(component);
+
+    EXPECT_LT(revision, model->revision());
+
+    revision = model->revision();
+
+    model->addUnits(units);
+
+    EXPECT_LT(revision, model->revision());
+
+    revision = model->revision();
+
+    component->setSourceComponent(libcellml::ImportSource::create(), "imported");
+
+    EXPECT_LT(revision, model->revision());
+
+    revision = model->revision();
+
+    model->takeComponent(0);
+
+    EXPECT_LT(revision, model->revision());
+
+    revision = model->revision();
+
+    component->setName("renamed");
+
+    EXPECT_EQ(revision, model->revision());
+}
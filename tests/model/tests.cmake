@@ -14,6 +14,7 @@ set(${CURRENT_TEST}_SRCS
   ${CMAKE_CURRENT_LIST_DIR}/model.cpp
   ${CMAKE_CURRENT_LIST_DIR}/units_import.cpp
   ${CMAKE_CURRENT_LIST_DIR}/model_flattening.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/revision.cpp
 )
 set(${CURRENT_TEST}_HDRS
 )
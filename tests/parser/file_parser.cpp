@@ -22,7 +22,9 @@ limitations under the License.
 
 #include <algorithm>
 #include <fstream>
+#include <limits>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 TEST(Parser, parseSineModelFromFile)
@@ -54,6 +56,139 @@ TEST(Parser, parseInvalidModelFromFile)
     EXPECT_EQ_ERRORS(expectedErrors, p);
 }
 
+TEST(Parser, parseModelFromFile)
+{
+    libcellml::ParserPtr p = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+    libcellml::ModelPtr model = p->parseModelFromFile(resourcePath("sine_approximations.xml"));
+
+    ASSERT_NE(nullptr, model);
+    EXPECT_EQ(size_t(0), p->errorCount());
+    EXPECT_EQ(printer->printModel(p->parseModel(fileContents("sine_approximations.xml"))), printer->printModel(model));
+}
+
+TEST(Parser, parseInvalidModelFromFileDirectly)
+{
+    const std::vector<std::string> expectedErrors = {
+        "LibXml2 error: Start tag expected, '<' not found.",
+        "Could not get a valid XML root node from the provided input.",
+    };
+
+    libcellml::ParserPtr p = libcellml::Parser::create();
+
+    EXPECT_NE(nullptr, p->parseModelFromFile(resourcePath("invalid_cellml_2.0.xml")));
+    EXPECT_EQ_ERRORS(expectedErrors, p);
+}
+
+TEST(Parser, parseModelFromNonExistentFile)
+{
+    const std::vector<std::string> expectedErrors = {
+        "File '" + resourcePath("non_existent.xml") + "' could not be opened.",
+    };
+
+    libcellml::ParserPtr p = libcellml::Parser::create();
+
+    EXPECT_EQ(nullptr, p->parseModelFromFile(resourcePath("non_existent.xml")));
+    EXPECT_EQ_ERRORS(expectedErrors, p);
+}
+
+TEST(Parser, parseModelFromBuffer)
+{
+    // The buffer need not be null terminated, so only its first bytes should
+    // get parsed.
+
+    const std::string model = "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\"/>";
+    const std::string buffer = model + "trailing bytes that are not part of the model";
+
+    libcellml::ParserPtr p = libcellml::Parser::create();
+    libcellml::ModelPtr m = p->parseModel(buffer.c_str(), model.size());
+
+    EXPECT_EQ(size_t(0), p->errorCount());
+    EXPECT_EQ("model", m->name());
+
+    m = p->parseModel(buffer.c_str(), 0);
+
+    EXPECT_EQ(size_t(1), p->errorCount());
+    EXPECT_EQ("Model is empty.", p->error(0)->description());
+    EXPECT_EQ(m, p->error(0)->model());
+}
+
+TEST(Parser, parseModelFromTooLargeBuffer)
+{
+    // The buffer is rejected before being read, so its actual size does not
+    // matter.
+
+    const std::string model = "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\"/>";
+    const size_t size = size_t(std::numeric_limits<int>::max()) + 1;
+
+    libcellml::ParserPtr p = libcellml::Parser::create();
+    libcellml::ModelPtr m = p->parseModel(model.c_str(), size);
+
+    EXPECT_EQ(size_t(1), p->errorCount());
+    EXPECT_EQ("Model is too large (" + std::to_string(size) + " bytes), the maximum size is " + std::to_string(std::numeric_limits<int>::max()) + " bytes.", p->error(0)->description());
+    EXPECT_EQ(libcellml::Error::Kind::MODEL, p->error(0)->kind());
+    EXPECT_EQ(m, p->error(0)->model());
+    EXPECT_EQ("", m->name());
+}
+
+static std::vector<std::string> parseModelsPaths()
+{
+    return {
+        resourcePath("sine_approximations.xml"),
+        resourcePath("invalid_cellml_2.0.xml"),
+        resourcePath("non_existent.xml"),
+        resourcePath("Ohara_Rudy_2011.cellml"),
+        resourcePath("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"),
+        resourcePath("generator/noble_model_1962/model.cellml"),
+        resourcePath("generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.cellml"),
+        resourcePath("generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml"),
+    };
+}
+
+TEST(Parser, parseModels)
+{
+    const std::vector<std::string> paths = parseModelsPaths();
+
+    libcellml::ParserPtr p = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+
+    p->addError(libcellml::Error::create());
+
+    for (size_t threads : {size_t(0), size_t(1), size_t(3), size_t(100)}) {
+        SCOPED_TRACE("threads = " + std::to_string(threads));
+
+        std::vector<libcellml::Parser::ParsedModel> parsedModels = p->parseModels(paths, threads);
+
+        // The errors of the parser itself are left untouched.
+
+        EXPECT_EQ(size_t(1), p->errorCount());
+
+        ASSERT_EQ(paths.size(), parsedModels.size());
+
+        for (size_t i = 0; i < paths.size(); ++i) {
+            SCOPED_TRACE(paths.at(i));
+
+            libcellml::ParserPtr serialParser = libcellml::Parser::create();
+            libcellml::ModelPtr serialModel = serialParser->parseModelFromFile(paths.at(i));
+
+            ASSERT_EQ(serialParser->errorCount(), parsedModels.at(i).errors.size());
+
+            for (size_t j = 0; j < serialParser->errorCount(); ++j) {
+                EXPECT_EQ(serialParser->error(j)->description(), parsedModels.at(i).errors.at(j)->description());
+            }
+
+            if (serialModel == nullptr) {
+                EXPECT_EQ(nullptr, parsedModels.at(i).model);
+            } else {
+                ASSERT_NE(nullptr, parsedModels.at(i).model);
+                EXPECT_EQ(printer->printModel(serialModel), printer->printModel(parsedModels.at(i).model));
+            }
+        }
+    }
+
+    EXPECT_TRUE(p->parseModels({}).empty());
+}
+
 TEST(Parser, parseOrdModelFromFile)
 {
     libcellml::ParserPtr p = libcellml::Parser::create();
@@ -155,3 +290,185 @@ TEST(Parser, simpleGeneratorModel)
     std::string a = model->component("my_component")->math();
     EXPECT_EQ(e, a);
 }
+
+static void expectSameModelWhenStreaming(const std::string &input)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ParserPtr streamingParser = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+
+    streamingParser->setStreaming(true);
+
+    libcellml::ModelPtr model = parser->parseModel(input);
+    libcellml::ModelPtr streamedModel = streamingParser->parseModel(input);
+
+    EXPECT_EQ(printer->printModel(model), printer->printModel(streamedModel));
+    ASSERT_EQ(parser->errorCount(), streamingParser->errorCount());
+    for (size_t i = 0; i < parser->errorCount(); ++i) {
+        EXPECT_EQ(parser->error(i)->description(), streamingParser->error(i)->description());
+        EXPECT_EQ(parser->error(i)->kind(), streamingParser->error(i)->kind());
+    }
+}
+
+TEST(Parser, streamingMode)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+
+    EXPECT_FALSE(parser->isStreaming());
+
+    parser->setStreaming(true);
+
+    EXPECT_TRUE(parser->isStreaming());
+
+    parser->setStreaming(false);
+
+    EXPECT_FALSE(parser->isStreaming());
+}
+
+TEST(Parser, streamingModeSameModels)
+{
+    const std::vector<std::string> fileNames = {
+        "Ohara_Rudy_2011.cellml",
+        "a_plus_b.cellml",
+        "complex_encapsulation.xml",
+        "complex_imports.xml",
+        "import_units_model.cellml",
+        "multiplecellmlnamespaces.cellml",
+        "sine_approximations.xml",
+        "units_definitions.cellml",
+        "generator/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+        "generator/resets/model.cellml",
+    };
+
+    for (const auto &fileName : fileNames) {
+        expectSameModelWhenStreaming(fileContents(fileName));
+    }
+}
+
+TEST(Parser, streamingModeSameErrors)
+{
+    const std::vector<std::string> inputs = {
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<component xmlns=\"http://www.cellml.org/cellml/2.0#\"/>\n",
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/1.1#\" name=\"model\"/>\n",
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\" invalid=\"attribute\">\n"
+        "  some text\n"
+        "  <!-- A comment. -->\n"
+        "  <invalid_element/>\n"
+        "  <encapsulation/>\n"
+        "</model>\n",
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <connection component_1=\"parent\" component_2=\"child\">\n"
+        "    <map_variables variable_1=\"x\" variable_2=\"x\"/>\n"
+        "  </connection>\n"
+        "  <encapsulation invalid=\"attribute\">\n"
+        "    <component_ref component=\"parent\">\n"
+        "      <component_ref component=\"child\"/>\n"
+        "    </component_ref>\n"
+        "  </encapsulation>\n"
+        "  <encapsulation>\n"
+        "    <component_ref component=\"child\"/>\n"
+        "  </encapsulation>\n"
+        "  <component name=\"parent\">\n"
+        "    <variable name=\"x\" units=\"dimensionless\" interface=\"private\"/>\n"
+        "  </component>\n"
+        "  <component name=\"child\">\n"
+        "    <variable name=\"x\" units=\"dimensionless\" interface=\"public\"/>\n"
+        "  </component>\n"
+        "</model>\n",
+    };
+
+    for (const auto &input : inputs) {
+        expectSameModelWhenStreaming(input);
+    }
+}
+
+TEST(Parser, streamingModeMalformedXml)
+{
+    const std::vector<std::string> expectedErrors = {
+        "LibXml2 error: Document is empty.",
+        "Could not get a valid XML root node from the provided input.",
+    };
+    const std::string input =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\">\n"
+        "  <component name=\"component\"/>\n"
+        "  <units name=\"units\">\n"
+        "    <unit units=\"second\">\n"
+        "  </units>\n"
+        "</model>\n";
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+
+    parser->setStreaming(true);
+
+    parser->parseModel(fileContents("invalid_cellml_2.0.xml"));
+
+    EXPECT_EQ_ERRORS(expectedErrors, parser);
+
+    parser->parseModel(input);
+
+    EXPECT_LT(size_t(0), parser->errorCount());
+    EXPECT_EQ(libcellml::Error::Kind::XML, parser->error(0)->kind());
+}
+
+TEST(Parser, concurrentParsers)
+{
+    const std::vector<std::string> fileNames = {
+        "Ohara_Rudy_2011.cellml",
+        "a_plus_b.cellml",
+        "complex_encapsulation.xml",
+        "invalid_cellml_2.0.xml",
+        "sine_approximations.xml",
+        "generator/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+    };
+    const size_t threadCount = 8;
+
+    // Parse our models sequentially to get our expected results.
+
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+    std::vector<std::string> inputs;
+    std::vector<std::string> expectedModels;
+    std::vector<size_t> expectedErrorCounts;
+
+    for (const auto &fileName : fileNames) {
+        libcellml::ParserPtr parser = libcellml::Parser::create();
+
+        inputs.push_back(fileContents(fileName));
+        expectedModels.push_back(printer->printModel(parser->parseModel(inputs.back())));
+        expectedErrorCounts.push_back(parser->errorCount());
+    }
+
+    // Parse our models concurrently, using one parser per thread, and make
+    // sure that we get the same results.
+
+    std::vector<std::vector<std::string>> models(threadCount);
+    std::vector<std::vector<size_t>> errorCounts(threadCount);
+    std::vector<std::thread> threads;
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i]() {
+            libcellml::ParserPtr parser = libcellml::Parser::create();
+            libcellml::PrinterPtr threadPrinter = libcellml::Printer::create();
+
+            parser->setStreaming(i % 2 == 1);
+
+            for (const auto &input : inputs) {
+                models[i].push_back(threadPrinter->printModel(parser->parseModel(input)));
+                errorCounts[i].push_back(parser->errorCount());
+            }
+        });
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (size_t i = 0; i < threadCount; ++i) {
+        EXPECT_EQ(expectedModels, models[i]);
+        EXPECT_EQ(expectedErrorCounts, errorCounts[i]);
+    }
+}
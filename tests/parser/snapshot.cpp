@@ -0,0 +1,210 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <cstdio>
+#include <fstream>
+
+static void expectSameModelAfterSnapshot(const libcellml::ModelPtr &model)
+{
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    std::string snapshot = printer->printModelSnapshot(model);
+    libcellml::ModelPtr snapshotModel = parser->parseModelSnapshot(snapshot);
+
+    EXPECT_EQ(size_t(0), parser->errorCount());
+    ASSERT_NE(nullptr, snapshotModel);
+    EXPECT_EQ(printer->printModel(model), printer->printModel(snapshotModel));
+}
+
+TEST(ParserSnapshot, sameModels)
+{
+    const std::vector<std::string> fileNames = {
+        "generator/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+        "generator/resets/model.cellml",
+        "modelflattening/reusable.xml",
+        "sine_approximations.xml",
+        "sine_approximations_import.xml",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+
+    for (const auto &fileName : fileNames) {
+        SCOPED_TRACE(fileName);
+
+        expectSameModelAfterSnapshot(parser->parseModel(fileContents(fileName)));
+    }
+}
+
+TEST(ParserSnapshot, sameModelWithIds)
+{
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"model\" id=\"model_id\">\n"
+        "  <import xlink:href=\"some_other_model.xml\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" id=\"import_id\">\n"
+        "    <component component_ref=\"a_component_in_that_model\" name=\"imported\" id=\"imported_id\"/>\n"
+        "  </import>\n"
+        "  <units name=\"per_second\" id=\"units_id\">\n"
+        "    <unit exponent=\"-1.5\" multiplier=\"0.25\" prefix=\"milli\" units=\"second\" id=\"unit_id\"/>\n"
+        "  </units>\n"
+        "  <component name=\"parent\" id=\"parent_id\">\n"
+        "    <variable name=\"x\" units=\"per_second\" initial_value=\"3\" interface=\"public_and_private\" id=\"x_id\"/>\n"
+        "    <variable name=\"y\" units=\"dimensionless\" interface=\"public_and_private\" id=\"y_id\"/>\n"
+        "    <reset variable=\"x\" test_variable=\"y\" order=\"-2\" id=\"reset_id\">\n"
+        "      <test_value id=\"test_value_id\">\n"
+        "        <math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "          <ci>y</ci>\n"
+        "        </math>\n"
+        "      </test_value>\n"
+        "      <reset_value id=\"reset_value_id\">\n"
+        "        <math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "          <cn cellml:units=\"per_second\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">1</cn>\n"
+        "        </math>\n"
+        "      </reset_value>\n"
+        "    </reset>\n"
+        "  </component>\n"
+        "  <component name=\"child1\" id=\"child1_id\">\n"
+        "    <variable name=\"x\" units=\"per_second\" interface=\"public\"/>\n"
+        "    <variable name=\"y\" units=\"dimensionless\" interface=\"public\"/>\n"
+        "  </component>\n"
+        "  <component name=\"child2\">\n"
+        "    <variable name=\"x\" units=\"per_second\" interface=\"public\"/>\n"
+        "  </component>\n"
+        "  <connection component_1=\"parent\" component_2=\"child1\" id=\"connection_id\">\n"
+        "    <map_variables variable_1=\"x\" variable_2=\"x\" id=\"map_x_id\"/>\n"
+        "    <map_variables variable_1=\"y\" variable_2=\"y\"/>\n"
+        "  </connection>\n"
+        "  <connection component_1=\"parent\" component_2=\"child2\">\n"
+        "    <map_variables variable_1=\"x\" variable_2=\"x\" id=\"map_x2_id\"/>\n"
+        "  </connection>\n"
+        "  <encapsulation id=\"encapsulation_id\">\n"
+        "    <component_ref component=\"parent\" id=\"component_ref_id\">\n"
+        "      <component_ref component=\"child1\"/>\n"
+        "      <component_ref component=\"child2\"/>\n"
+        "    </component_ref>\n"
+        "  </encapsulation>\n"
+        "</model>\n";
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+    libcellml::ModelPtr model = parser->parseModel(in);
+
+    EXPECT_EQ(size_t(0), parser->errorCount());
+
+    expectSameModelAfterSnapshot(model);
+
+    libcellml::ModelPtr snapshotModel = parser->parseModelSnapshot(printer->printModelSnapshot(model));
+    libcellml::ComponentPtr parent = snapshotModel->component("parent");
+
+    EXPECT_EQ(snapshotModel->units("per_second"), parent->variable("x")->units());
+    EXPECT_EQ(parent->variable("x"), parent->reset(0)->variable());
+    EXPECT_EQ(parent->variable("y"), parent->reset(0)->testVariable());
+    EXPECT_EQ("some_other_model.xml", snapshotModel->component("imported")->importSource()->url());
+}
+
+TEST(ParserSnapshot, emptyModel)
+{
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+
+    EXPECT_EQ("", printer->printModelSnapshot(nullptr));
+
+    expectSameModelAfterSnapshot(libcellml::Model::create());
+}
+
+TEST(ParserSnapshot, invalidSnapshots)
+{
+    const std::vector<std::string> expectedErrors = {
+        "Snapshot is not a valid model snapshot.",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+    std::string snapshot = printer->printModelSnapshot(parser->parseModel(fileContents("generator/resets/model.cellml")));
+
+    EXPECT_EQ(nullptr, parser->parseModelSnapshot(""));
+    EXPECT_EQ_ERRORS(expectedErrors, parser);
+
+    EXPECT_EQ(nullptr, parser->parseModelSnapshot(fileContents("sine_approximations.xml")));
+    EXPECT_EQ_ERRORS(expectedErrors, parser);
+
+    // Any truncated snapshot is invalid, as long as it is not truncated
+    // within its string data.
+
+    for (size_t size = 0; size < snapshot.size() / 2; ++size) {
+        EXPECT_EQ(nullptr, parser->parseModelSnapshot(snapshot.c_str(), size));
+        EXPECT_EQ_ERRORS(expectedErrors, parser);
+    }
+
+    // Corrupting words of a snapshot must never make us read outside of it.
+
+    for (size_t offset = 8; offset + 4 <= snapshot.size(); offset += 4) {
+        std::string corruptedSnapshot = snapshot;
+
+        corruptedSnapshot[offset] = char(0xff);
+        corruptedSnapshot[offset + 3] = char(0x7f);
+
+        parser->parseModelSnapshot(corruptedSnapshot);
+    }
+}
+
+TEST(ParserSnapshot, unsupportedVersion)
+{
+    const std::vector<std::string> expectedErrors = {
+        "Snapshot version 1234 is not supported, only version 1 is.",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+    std::string snapshot = printer->printModelSnapshot(libcellml::Model::create("model"));
+    unsigned int version = 1234;
+
+    snapshot.replace(8, sizeof(version), reinterpret_cast<const char *>(&version), sizeof(version));
+
+    EXPECT_EQ(nullptr, parser->parseModelSnapshot(snapshot));
+    EXPECT_EQ_ERRORS(expectedErrors, parser);
+}
+
+TEST(ParserSnapshot, snapshotFile)
+{
+    const std::vector<std::string> expectedErrors = {
+        "File 'non_existent_snapshot.bin' could not be opened.",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    std::string fileName = testing::TempDir() + "libcellml_model_snapshot.bin";
+
+    std::ofstream file(fileName, std::ios_base::binary);
+    file << printer->printModelSnapshot(model);
+    file.close();
+
+    libcellml::ModelPtr snapshotModel = parser->parseModelSnapshotFromFile(fileName);
+
+    EXPECT_EQ(size_t(0), parser->errorCount());
+    ASSERT_NE(nullptr, snapshotModel);
+    EXPECT_EQ(printer->printModel(model), printer->printModel(snapshotModel));
+
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(nullptr, parser->parseModelSnapshotFromFile("non_existent_snapshot.bin"));
+    EXPECT_EQ_ERRORS(expectedErrors, parser);
+}
@@ -13,6 +13,7 @@ set(${CURRENT_TEST}_SRCS
   ${CMAKE_CURRENT_LIST_DIR}/file_parser.cpp
   ${CMAKE_CURRENT_LIST_DIR}/libxml_user.cpp
   ${CMAKE_CURRENT_LIST_DIR}/parser.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/snapshot.cpp
 )
 #set(${CURRENT_TEST}_HDRS
 #  ${CMAKE_CURRENT_LIST_DIR}/<test_header_files.h>
@@ -0,0 +1,193 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_resources.h"
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <cstdio>
+#include <fstream>
+
+TEST(ImportLibrary, sharedImportedModels)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("complex_imports.xml"));
+    libcellml::ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+
+    model->resolveImports(resourcePath(), importLibrary);
+
+    EXPECT_FALSE(model->hasUnresolvedImports());
+    EXPECT_EQ(size_t(3), importLibrary->modelCount());
+    EXPECT_TRUE(importLibrary->hasModel(resourcePath("sin.xml")));
+    EXPECT_TRUE(importLibrary->hasModel(resourcePath("modelflattening/../sin.xml")));
+    EXPECT_FALSE(importLibrary->hasModel(resourcePath("level0.xml")));
+
+    libcellml::ModelPtr sinModel = importLibrary->model(resourcePath("sin.xml"));
+
+    EXPECT_EQ(sinModel, model->component("actual_sin")->importSource()->model());
+    EXPECT_EQ(importLibrary->model(resourcePath("parabolic_approx_sin.xml")), model->component("parabolic_approx_sin")->importSource()->model());
+    EXPECT_NE(sinModel, model->component("deriv_approx_sin")->importSource()->model());
+    EXPECT_EQ(size_t(3), importLibrary->modelCount());
+
+    // The imported models are kept warm across several resolutions.
+
+    libcellml::ModelPtr otherModel = parser->parseModel(fileContents("complex_imports.xml"));
+
+    otherModel->resolveImports(resourcePath(), importLibrary);
+
+    EXPECT_FALSE(otherModel->hasUnresolvedImports());
+    EXPECT_EQ(size_t(3), importLibrary->modelCount());
+    EXPECT_EQ(sinModel, otherModel->component("actual_sin")->importSource()->model());
+
+    // Removing all the models from the library means that imported models
+    // get parsed again, but it does not affect already resolved imports.
+
+    importLibrary->removeAllModels();
+
+    EXPECT_EQ(size_t(0), importLibrary->modelCount());
+    EXPECT_EQ(sinModel, model->component("actual_sin")->importSource()->model());
+
+    otherModel = parser->parseModel(fileContents("complex_imports.xml"));
+    otherModel->resolveImports(resourcePath(), importLibrary);
+
+    EXPECT_FALSE(otherModel->hasUnresolvedImports());
+    EXPECT_NE(sinModel, otherModel->component("actual_sin")->importSource()->model());
+}
+
+TEST(ImportLibrary, sharedImportedModelsWithinResolution)
+{
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(fileContents("level0.xml"));
+
+    model->resolveImports(resourcePath());
+
+    EXPECT_FALSE(model->hasUnresolvedImports());
+
+    libcellml::ModelPtr importedModel = model->component(0)->importSource()->model();
+
+    EXPECT_NE(nullptr, importedModel);
+
+    for (size_t i = 1; i < model->componentCount(); ++i) {
+        libcellml::ComponentPtr component = model->component(i);
+
+        if (component->isImport()) {
+            EXPECT_EQ(importedModel, component->importSource()->model());
+        }
+    }
+}
+
+TEST(ImportLibrary, modelThatCannotBeOpened)
+{
+    libcellml::ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+
+    EXPECT_EQ(nullptr, importLibrary->model(resourcePath("this_file_should_not_exist..._ever!.xml")));
+    EXPECT_EQ(size_t(0), importLibrary->modelCount());
+}
+
+TEST(ImportLibrary, threadCount)
+{
+    libcellml::ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+
+    EXPECT_EQ(size_t(1), importLibrary->threadCount());
+
+    importLibrary->setThreadCount(3);
+
+    EXPECT_EQ(size_t(3), importLibrary->threadCount());
+
+    importLibrary->setThreadCount(0);
+
+    EXPECT_EQ(size_t(0), importLibrary->threadCount());
+}
+
+TEST(ImportLibrary, sameResolutionWhateverThreadCount)
+{
+    const std::vector<std::string> fileNames = {
+        "level0.xml",
+        "modelflattening/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+        "modelflattening/importedcomponentusingimportedcomponent.xml",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::PrinterPtr printer = libcellml::Printer::create();
+
+    for (const auto &fileName : fileNames) {
+        SCOPED_TRACE(fileName);
+
+        std::string flattenedModel;
+
+        for (size_t threads : {1, 2, 8}) {
+            libcellml::ModelPtr model = parser->parseModel(fileContents(fileName));
+            libcellml::ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+
+            importLibrary->setThreadCount(threads);
+
+            model->resolveImports(resourcePath(fileName), importLibrary);
+            model->flatten();
+
+            if (threads == 1) {
+                flattenedModel = printer->printModel(model);
+            } else {
+                EXPECT_EQ(flattenedModel, printer->printModel(model));
+            }
+        }
+    }
+}
+
+TEST(ImportLibrary, importCycle)
+{
+    const std::string in =
+        "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" name=\"model\">\n"
+        "  <import xlink:href=\"libcellml_import_cycle_OTHER.xml\">\n"
+        "    <component name=\"imported\" component_ref=\"component\"/>\n"
+        "  </import>\n"
+        "  <component name=\"component\"/>\n"
+        "</model>\n";
+
+    std::string directory = testing::TempDir();
+    std::string a = "libcellml_import_cycle_a.xml";
+    std::string b = "libcellml_import_cycle_b.xml";
+    std::string aContents = in;
+    std::string bContents = in;
+
+    aContents.replace(aContents.find("libcellml_import_cycle_OTHER.xml"), 32, b);
+    bContents.replace(bContents.find("libcellml_import_cycle_OTHER.xml"), 32, a);
+
+    std::ofstream(directory + a) << aContents;
+    std::ofstream(directory + b) << bContents;
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(aContents);
+    libcellml::ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+
+    model->resolveImports(directory + a, importLibrary);
+
+    EXPECT_FALSE(model->hasUnresolvedImports());
+    EXPECT_EQ(size_t(2), importLibrary->modelCount());
+
+    libcellml::ModelPtr aModel = importLibrary->model(directory + a);
+    libcellml::ModelPtr bModel = importLibrary->model(directory + b);
+
+    EXPECT_EQ(bModel, model->component("imported")->importSource()->model());
+    EXPECT_EQ(aModel, bModel->component("imported")->importSource()->model());
+    EXPECT_EQ(bModel, aModel->component("imported")->importSource()->model());
+
+    std::remove((directory + a).c_str());
+    std::remove((directory + b).c_str());
+}
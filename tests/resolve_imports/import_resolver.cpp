@@ -0,0 +1,265 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "test_resources.h"
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <stdexcept>
+
+/**
+ * An import resolver which serves documents from an in-memory bundle and
+ * keeps track of the number of times that documents have been fetched.
+ */
+class BundleImportResolver: public libcellml::ImportResolver
+{
+public:
+    explicit BundleImportResolver(const std::map<std::string, std::string> &documents)
+        : mDocuments(documents)
+    {
+    }
+
+    std::string location(const std::string &url, const std::string &base) const override
+    {
+        return base.substr(0, base.find_last_of('/') + 1) + url;
+    }
+
+    Buffer fetch(const std::string &location) const override
+    {
+        Buffer res;
+        auto document = mDocuments.find(location);
+
+        ++mFetchCount;
+
+        if (document != mDocuments.end()) {
+            auto contents = std::make_shared<std::string>(document->second);
+
+            res.found = true;
+            res.data = contents->data();
+            res.size = contents->size();
+            res.owner = contents;
+        }
+
+        return res;
+    }
+
+    size_t fetchCount() const
+    {
+        return mFetchCount;
+    }
+
+private:
+    std::map<std::string, std::string> mDocuments;
+    mutable std::atomic<size_t> mFetchCount {0};
+};
+
+/**
+ * An import resolver which fails to fetch a given document by throwing an
+ * exception.
+ */
+class ThrowingImportResolver: public BundleImportResolver
+{
+public:
+    ThrowingImportResolver(const std::map<std::string, std::string> &documents, const std::string &failingLocation)
+        : BundleImportResolver(documents)
+        , mFailingLocation(failingLocation)
+    {
+    }
+
+    Buffer fetch(const std::string &location) const override
+    {
+        if (location == mFailingLocation) {
+            throw std::runtime_error("Cannot fetch '" + location + "'.");
+        }
+
+        return BundleImportResolver::fetch(location);
+    }
+
+private:
+    std::string mFailingLocation;
+};
+
+static const std::string BUNDLE_MAIN =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" name=\"main\">\n"
+    "  <import xlink:href=\"components/membrane.cellml\">\n"
+    "    <component name=\"membrane\" component_ref=\"membrane\"/>\n"
+    "  </import>\n"
+    "  <import xlink:href=\"components/membrane.cellml\">\n"
+    "    <component name=\"other_membrane\" component_ref=\"membrane\"/>\n"
+    "  </import>\n"
+    "  <import xlink:href=\"missing.cellml\">\n"
+    "    <component name=\"missing\" component_ref=\"missing\"/>\n"
+    "  </import>\n"
+    "</model>\n";
+
+static const std::string BUNDLE_MEMBRANE =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" xmlns:xlink=\"http://www.w3.org/1999/xlink\" name=\"membrane\">\n"
+    "  <import xlink:href=\"units.cellml\">\n"
+    "    <units name=\"mV\" units_ref=\"mV\"/>\n"
+    "  </import>\n"
+    "  <component name=\"membrane\">\n"
+    "    <variable name=\"V\" units=\"mV\" interface=\"public\"/>\n"
+    "  </component>\n"
+    "</model>\n";
+
+static const std::string BUNDLE_UNITS =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+    "<model xmlns=\"http://www.cellml.org/cellml/2.0#\" name=\"units\">\n"
+    "  <units name=\"mV\">\n"
+    "    <unit prefix=\"milli\" units=\"volt\"/>\n"
+    "  </units>\n"
+    "</model>\n";
+
+TEST(ImportResolver, defaultResolver)
+{
+    libcellml::ImportResolverPtr importResolver = libcellml::ImportResolver::create();
+    std::string location = importResolver->location("sin.xml", resourcePath("complex_imports.xml"));
+
+    EXPECT_EQ(location, importResolver->location("../sin.xml", resourcePath("modelflattening/model.xml")));
+    EXPECT_EQ(location, importResolver->location(resourcePath("sin.xml"), ""));
+
+    libcellml::ImportResolver::Buffer buffer = importResolver->fetch(location);
+
+    EXPECT_TRUE(buffer.found);
+    EXPECT_NE(nullptr, buffer.owner);
+    EXPECT_EQ(fileContents("sin.xml"), std::string(buffer.data, buffer.size));
+
+    buffer = importResolver->fetch(resourcePath("not_a_file.xml"));
+
+    EXPECT_FALSE(buffer.found);
+    EXPECT_EQ(nullptr, buffer.owner);
+}
+
+TEST(ImportResolver, inMemoryBundle)
+{
+    auto importResolver = std::make_shared<BundleImportResolver>(std::map<std::string, std::string> {
+        {"bundle/components/membrane.cellml", BUNDLE_MEMBRANE},
+        {"bundle/components/units.cellml", BUNDLE_UNITS},
+    });
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ModelPtr model = parser->parseModel(BUNDLE_MAIN);
+
+    model->resolveImports("bundle/main.cellml", importResolver);
+
+    // Each document is fetched only once, however many times it is imported,
+    // and a missing document leaves its imports unresolved.
+
+    EXPECT_EQ(size_t(3), importResolver->fetchCount());
+    EXPECT_TRUE(model->hasUnresolvedImports());
+    EXPECT_FALSE(model->component("missing")->importSource()->hasModel());
+
+    libcellml::ModelPtr membraneModel = model->component("membrane")->importSource()->model();
+
+    ASSERT_NE(nullptr, membraneModel);
+    EXPECT_EQ("membrane", membraneModel->name());
+    EXPECT_EQ(membraneModel, model->component("other_membrane")->importSource()->model());
+    EXPECT_FALSE(membraneModel->hasUnresolvedImports());
+    EXPECT_EQ("units", membraneModel->units("mV")->importSource()->model()->name());
+}
+
+TEST(ImportResolver, importLibrary)
+{
+    auto importResolver = std::make_shared<BundleImportResolver>(std::map<std::string, std::string> {
+        {"bundle/components/membrane.cellml", BUNDLE_MEMBRANE},
+        {"bundle/components/units.cellml", BUNDLE_UNITS},
+    });
+    libcellml::ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+
+    EXPECT_NE(nullptr, importLibrary->importResolver());
+
+    importLibrary->setImportResolver(importResolver);
+
+    EXPECT_EQ(importResolver, importLibrary->importResolver());
+
+    libcellml::ModelPtr membraneModel = importLibrary->model("bundle/components/membrane.cellml");
+
+    ASSERT_NE(nullptr, membraneModel);
+    EXPECT_FALSE(membraneModel->hasUnresolvedImports());
+    EXPECT_EQ(size_t(2), importLibrary->modelCount());
+    EXPECT_TRUE(importLibrary->hasModel("bundle/components/units.cellml"));
+    EXPECT_EQ(nullptr, importLibrary->model("bundle/missing.cellml"));
+
+    libcellml::ModelPtr model = libcellml::Parser::create()->parseModel(BUNDLE_MAIN);
+
+    importLibrary->resolveImports(model, "bundle/main.cellml");
+
+    EXPECT_EQ(membraneModel, model->component("membrane")->importSource()->model());
+    EXPECT_EQ(size_t(4), importResolver->fetchCount());
+
+    // Resetting the import resolver gives us back the default one.
+
+    importLibrary->setImportResolver(nullptr);
+
+    EXPECT_NE(nullptr, importLibrary->importResolver());
+    EXPECT_NE(importResolver, importLibrary->importResolver());
+}
+
+TEST(ImportResolver, throwingResolver)
+{
+    const std::map<std::string, std::string> documents = {
+        {"bundle/components/membrane.cellml", BUNDLE_MEMBRANE},
+        {"bundle/components/units.cellml", BUNDLE_UNITS},
+    };
+    libcellml::ImportLibraryPtr importLibrary = libcellml::ImportLibrary::create();
+    libcellml::ModelPtr model = libcellml::Parser::create()->parseModel(BUNDLE_MAIN);
+
+    importLibrary->setThreadCount(4);
+
+    // The exception thrown by the resolver, from whichever thread, is passed
+    // on to us and the documents fetched alongside the failing one are not
+    // kept.
+
+    importLibrary->setImportResolver(std::make_shared<ThrowingImportResolver>(documents, "bundle/missing.cellml"));
+
+    EXPECT_THROW(importLibrary->resolveImports(model, "bundle/main.cellml"), std::runtime_error);
+    EXPECT_EQ(size_t(0), importLibrary->modelCount());
+    EXPECT_FALSE(model->component("membrane")->importSource()->hasModel());
+
+    // The imports resolved before the exception was thrown remain resolved.
+
+    importLibrary->setImportResolver(std::make_shared<ThrowingImportResolver>(documents, "bundle/components/units.cellml"));
+
+    try {
+        importLibrary->resolveImports(model, "bundle/main.cellml");
+
+        FAIL() << "An exception should have been thrown.";
+    } catch (const std::runtime_error &exception) {
+        EXPECT_EQ("Cannot fetch 'bundle/components/units.cellml'.", std::string(exception.what()));
+    }
+
+    EXPECT_EQ(size_t(1), importLibrary->modelCount());
+
+    libcellml::ModelPtr membraneModel = model->component("membrane")->importSource()->model();
+
+    ASSERT_NE(nullptr, membraneModel);
+    EXPECT_TRUE(membraneModel->hasUnresolvedImports());
+
+    // The library can still be used once the resolver stops throwing.
+
+    importLibrary->setImportResolver(std::make_shared<BundleImportResolver>(documents));
+    importLibrary->resolveImports(membraneModel, "bundle/components/membrane.cellml");
+
+    EXPECT_EQ(size_t(2), importLibrary->modelCount());
+    EXPECT_FALSE(membraneModel->hasUnresolvedImports());
+}
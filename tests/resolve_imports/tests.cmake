@@ -11,6 +11,8 @@ list(APPEND LIBCELLML_TESTS ${CURRENT_TEST})
 # Using absolute path relative to this file
 set(${CURRENT_TEST}_SRCS
   ${CMAKE_CURRENT_LIST_DIR}/file_parser.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/import_library.cpp
+  ${CMAKE_CURRENT_LIST_DIR}/import_resolver.cpp
 )
 #set(${CURRENT_TEST}_HDRS
 #  ${CMAKE_CURRENT_LIST_DIR}/<test_header_files.h>
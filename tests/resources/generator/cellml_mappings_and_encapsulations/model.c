@@ -33,7 +33,7 @@ double * createVariablesArray()
     return (double *) malloc(2*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
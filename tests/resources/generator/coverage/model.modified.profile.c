@@ -297,7 +297,7 @@ double * createVariablesArray()
     return (double *) malloc(186*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
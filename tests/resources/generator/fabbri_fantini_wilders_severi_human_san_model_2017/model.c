@@ -279,7 +279,7 @@ double * createVariablesArray()
     return (double *) malloc(217*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
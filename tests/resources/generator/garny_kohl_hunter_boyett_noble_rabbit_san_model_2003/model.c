@@ -229,7 +229,7 @@ double * createVariablesArray()
     return (double *) malloc(185*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
@@ -51,7 +51,7 @@ double * createVariablesArray()
     return (double *) malloc(18*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
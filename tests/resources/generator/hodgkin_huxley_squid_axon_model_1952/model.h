@@ -35,7 +35,7 @@ extern const VariableInfoWithType VARIABLE_INFO[];
 
 double * createStatesArray();
 double * createVariablesArray();
-void deleteArray(double *array);
+void deleteArray(void *array);
 
 void initializeStatesAndConstants(double *states, double *variables);
 void computeComputedConstants(double *variables);
@@ -0,0 +1,89 @@
+/* The content of this file was generated using the static C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const VariableInfo VOI_INFO = {"time", "millisecond", "membrane"};
+
+const VariableInfo STATE_INFO[] = {
+    {"m", "dimensionless", "sodium_channel_m_gate"},
+    {"h", "dimensionless", "sodium_channel_h_gate"},
+    {"n", "dimensionless", "potassium_channel_n_gate"},
+    {"V", "millivolt", "membrane"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"g_L", "milliS_per_cm2", "leakage_current", CONSTANT},
+    {"Cm", "microF_per_cm2", "membrane", CONSTANT},
+    {"E_R", "millivolt", "membrane", CONSTANT},
+    {"g_K", "milliS_per_cm2", "potassium_channel", CONSTANT},
+    {"g_Na", "milliS_per_cm2", "sodium_channel", CONSTANT},
+    {"E_L", "millivolt", "leakage_current", COMPUTED_CONSTANT},
+    {"E_Na", "millivolt", "sodium_channel", COMPUTED_CONSTANT},
+    {"E_K", "millivolt", "potassium_channel", COMPUTED_CONSTANT},
+    {"i_Stim", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"i_L", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"i_Na", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"alpha_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"beta_m", "per_millisecond", "sodium_channel_m_gate", ALGEBRAIC},
+    {"alpha_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"beta_h", "per_millisecond", "sodium_channel_h_gate", ALGEBRAIC},
+    {"i_K", "microA_per_cm2", "membrane", ALGEBRAIC},
+    {"alpha_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC},
+    {"beta_n", "per_millisecond", "potassium_channel_n_gate", ALGEBRAIC}
+};
+
+void initializeStatesAndConstants(ModelInstance *instance)
+{
+    instance->states[0] = 0.05;
+    instance->states[1] = 0.6;
+    instance->states[2] = 0.325;
+    instance->states[3] = 0.0;
+    instance->variables[0] = 0.3;
+    instance->variables[1] = 1.0;
+    instance->variables[2] = 0.0;
+    instance->variables[3] = 36.0;
+    instance->variables[4] = 120.0;
+}
+
+void computeComputedConstants(ModelInstance *instance)
+{
+    instance->variables[6] = instance->variables[2]-10.613;
+    instance->variables[8] = instance->variables[2]-115.0;
+    instance->variables[14] = instance->variables[2]+12.0;
+}
+
+void computeRates(double voi, ModelInstance *instance, double *rates)
+{
+    instance->variables[10] = 0.1*(instance->states[3]+25.0)/(exp((instance->states[3]+25.0)/10.0)-1.0);
+    instance->variables[11] = 4.0*exp(instance->states[3]/18.0);
+    rates[0] = instance->variables[10]*(1.0-instance->states[0])-instance->variables[11]*instance->states[0];
+    instance->variables[12] = 0.07*exp(instance->states[3]/20.0);
+    instance->variables[13] = 1.0/(exp((instance->states[3]+30.0)/10.0)+1.0);
+    rates[1] = instance->variables[12]*(1.0-instance->states[1])-instance->variables[13]*instance->states[1];
+    instance->variables[16] = 0.01*(instance->states[3]+10.0)/(exp((instance->states[3]+10.0)/10.0)-1.0);
+    instance->variables[17] = 0.125*exp(instance->states[3]/80.0);
+    rates[2] = instance->variables[16]*(1.0-instance->states[2])-instance->variables[17]*instance->states[2];
+    instance->variables[5] = ((voi >= 10.0) && (voi <= 10.5))?-20.0:0.0;
+    instance->variables[7] = instance->variables[0]*(instance->states[3]-instance->variables[6]);
+    instance->variables[15] = instance->variables[3]*pow(instance->states[2], 4.0)*(instance->states[3]-instance->variables[14]);
+    instance->variables[9] = instance->variables[4]*pow(instance->states[0], 3.0)*instance->states[1]*(instance->states[3]-instance->variables[8]);
+    rates[3] = -(-instance->variables[5]+instance->variables[9]+instance->variables[15]+instance->variables[7])/instance->variables[1];
+}
+
+void computeVariables(double voi, ModelInstance *instance, double *rates)
+{
+    instance->variables[7] = instance->variables[0]*(instance->states[3]-instance->variables[6]);
+    instance->variables[9] = instance->variables[4]*pow(instance->states[0], 3.0)*instance->states[1]*(instance->states[3]-instance->variables[8]);
+    instance->variables[10] = 0.1*(instance->states[3]+25.0)/(exp((instance->states[3]+25.0)/10.0)-1.0);
+    instance->variables[11] = 4.0*exp(instance->states[3]/18.0);
+    instance->variables[12] = 0.07*exp(instance->states[3]/20.0);
+    instance->variables[13] = 1.0/(exp((instance->states[3]+30.0)/10.0)+1.0);
+    instance->variables[15] = instance->variables[3]*pow(instance->states[2], 4.0)*(instance->states[3]-instance->variables[14]);
+    instance->variables[16] = 0.01*(instance->states[3]+10.0)/(exp((instance->states[3]+10.0)/10.0)-1.0);
+    instance->variables[17] = 0.125*exp(instance->states[3]/80.0);
+}
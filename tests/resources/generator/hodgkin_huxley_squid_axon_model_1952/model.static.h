@@ -0,0 +1,44 @@
+/* The content of this file was generated using the static C profile of libCellML 0.2.0. */
+
+#pragma once
+
+#include <stddef.h>
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+#define STATE_COUNT 4
+#define VARIABLE_COUNT 18
+
+typedef struct {
+    double states[4];
+    double variables[18];
+} ModelInstance;
+
+typedef enum {
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+} VariableType;
+
+typedef struct {
+    char name[8];
+    char units[16];
+    char component[25];
+} VariableInfo;
+
+typedef struct {
+    char name[8];
+    char units[16];
+    char component[25];
+    VariableType type;
+} VariableInfoWithType;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfoWithType VARIABLE_INFO[];
+
+void initializeStatesAndConstants(ModelInstance *instance);
+void computeComputedConstants(ModelInstance *instance);
+void computeRates(double voi, ModelInstance *instance, double *rates);
+void computeVariables(double voi, ModelInstance *instance, double *rates);
@@ -50,7 +50,7 @@ double * createVariablesArray()
     return (double *) malloc(17*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
@@ -31,7 +31,7 @@ double * createVariablesArray()
     return (double *) malloc(1*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
@@ -30,7 +30,7 @@ double * createVariablesArray()
     return (double *) malloc(0*sizeof(double));
 }
 
-void deleteArray(double *array)
+void deleteArray(void *array)
 {
     free(array);
 }
@@ -0,0 +1,84 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const size_t STATE_COUNT = 2;
+const size_t VARIABLE_COUNT = 5;
+const size_t ROOT_COUNT = 3;
+
+const VariableInfo VOI_INFO = {"t", "ms", "main"};
+
+const VariableInfo STATE_INFO[] = {
+    {"v", "mV", "main"},
+    {"count", "dimensionless", "main"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"i_stim", "mV", "main", CONSTANT},
+    {"t_end", "ms", "main", CONSTANT},
+    {"tau", "ms", "main", CONSTANT},
+    {"v_reset", "mV", "main", CONSTANT},
+    {"v_th", "mV", "main", CONSTANT}
+};
+
+double * createStatesArray()
+{
+    return (double *) malloc(2*sizeof(double));
+}
+
+double * createVariablesArray()
+{
+    return (double *) malloc(5*sizeof(double));
+}
+
+void deleteArray(void *array)
+{
+    free(array);
+}
+
+void initializeStatesAndConstants(double *states, double *variables)
+{
+    states[0] = 0.0;
+    states[1] = 0.0;
+    variables[0] = 1.5;
+    variables[1] = 100.0;
+    variables[2] = 10.0;
+    variables[3] = 0.0;
+    variables[4] = 1.0;
+}
+
+void computeComputedConstants(double *variables)
+{
+}
+
+void computeRates(double voi, double *states, double *rates, double *variables)
+{
+    rates[0] = (variables[0]-states[0])/variables[2];
+    rates[1] = 0.0;
+}
+
+void computeVariables(double voi, double *states, double *rates, double *variables)
+{
+}
+
+void computeRoots(double voi, double *states, double *variables, double *roots)
+{
+    roots[0] = states[0]-variables[4];
+    roots[1] = states[0]-variables[4];
+    roots[2] = voi-(variables[1]-1.0);
+}
+
+void applyResets(double voi, double *states, double *variables, int *rootsFound)
+{
+    double resetValue0 = (rootsFound[0])?states[1]+1.0:states[1];
+    double resetValue1 = (rootsFound[1])?variables[3]:(rootsFound[2])?((states[1] > 2.0)?variables[3]:states[0]):states[0];
+
+    states[1] = resetValue0;
+    states[0] = resetValue1;
+}
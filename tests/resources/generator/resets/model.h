@@ -0,0 +1,46 @@
+/* The content of this file was generated using the C profile of libCellML 0.2.0. */
+
+#pragma once
+
+#include <stddef.h>
+
+extern const char VERSION[];
+extern const char LIBCELLML_VERSION[];
+
+extern const size_t STATE_COUNT;
+extern const size_t VARIABLE_COUNT;
+extern const size_t ROOT_COUNT;
+
+typedef enum {
+    CONSTANT,
+    COMPUTED_CONSTANT,
+    ALGEBRAIC
+} VariableType;
+
+typedef struct {
+    char name[8];
+    char units[14];
+    char component[5];
+} VariableInfo;
+
+typedef struct {
+    char name[8];
+    char units[14];
+    char component[5];
+    VariableType type;
+} VariableInfoWithType;
+
+extern const VariableInfo VOI_INFO;
+extern const VariableInfo STATE_INFO[];
+extern const VariableInfoWithType VARIABLE_INFO[];
+
+double * createStatesArray();
+double * createVariablesArray();
+void deleteArray(void *array);
+
+void initializeStatesAndConstants(double *states, double *variables);
+void computeComputedConstants(double *variables);
+void computeRates(double voi, double *states, double *rates, double *variables);
+void computeVariables(double voi, double *states, double *rates, double *variables);
+void computeRoots(double voi, double *states, double *variables, double *roots);
+void applyResets(double voi, double *states, double *variables, int *rootsFound);
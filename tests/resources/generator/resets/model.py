@@ -0,0 +1,83 @@
+# The content of this file was generated using the Python profile of libCellML 0.2.0.
+
+from enum import Enum
+from math import *
+
+
+__version__ = "0.1.0"
+LIBCELLML_VERSION = "0.2.0"
+
+STATE_COUNT = 2
+VARIABLE_COUNT = 5
+ROOT_COUNT = 3
+
+
+class VariableType(Enum):
+    CONSTANT = 1
+    COMPUTED_CONSTANT = 2
+    ALGEBRAIC = 3
+
+
+VOI_INFO = {"name": "t", "units": "ms", "component": "main"}
+
+STATE_INFO = [
+    {"name": "v", "units": "mV", "component": "main"},
+    {"name": "count", "units": "dimensionless", "component": "main"}
+]
+
+VARIABLE_INFO = [
+    {"name": "i_stim", "units": "mV", "component": "main", "type": VariableType.CONSTANT},
+    {"name": "t_end", "units": "ms", "component": "main", "type": VariableType.CONSTANT},
+    {"name": "tau", "units": "ms", "component": "main", "type": VariableType.CONSTANT},
+    {"name": "v_reset", "units": "mV", "component": "main", "type": VariableType.CONSTANT},
+    {"name": "v_th", "units": "mV", "component": "main", "type": VariableType.CONSTANT}
+]
+
+
+def gt_func(x, y):
+    return 1.0 if x > y else 0.0
+
+
+def create_states_array():
+    return [nan]*2
+
+
+def create_variables_array():
+    return [nan]*5
+
+
+def initialize_states_and_constants(states, variables):
+    states[0] = 0.0
+    states[1] = 0.0
+    variables[0] = 1.5
+    variables[1] = 100.0
+    variables[2] = 10.0
+    variables[3] = 0.0
+    variables[4] = 1.0
+
+
+def compute_computed_constants(variables):
+    pass
+
+
+def compute_rates(voi, states, rates, variables):
+    rates[0] = (variables[0]-states[0])/variables[2]
+    rates[1] = 0.0
+
+
+def compute_variables(voi, states, rates, variables):
+    pass
+
+
+def compute_roots(voi, states, variables, roots):
+    roots[0] = states[0]-variables[4]
+    roots[1] = states[0]-variables[4]
+    roots[2] = voi-(variables[1]-1.0)
+
+
+def apply_resets(voi, states, variables, roots_found):
+    reset_value_0 = states[1]+1.0 if roots_found[0] else states[1]
+    reset_value_1 = variables[3] if roots_found[1] else (variables[3] if gt_func(states[1], 2.0) else states[0]) if roots_found[2] else states[0]
+
+    states[1] = reset_value_0
+    states[0] = reset_value_1
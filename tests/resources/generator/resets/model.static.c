@@ -0,0 +1,64 @@
+/* The content of this file was generated using the static C profile of libCellML 0.2.0. */
+
+#include "model.h"
+
+#include <math.h>
+
+const char VERSION[] = "0.1.0";
+const char LIBCELLML_VERSION[] = "0.2.0";
+
+const VariableInfo VOI_INFO = {"t", "ms", "main"};
+
+const VariableInfo STATE_INFO[] = {
+    {"v", "mV", "main"},
+    {"count", "dimensionless", "main"}
+};
+
+const VariableInfoWithType VARIABLE_INFO[] = {
+    {"i_stim", "mV", "main", CONSTANT},
+    {"t_end", "ms", "main", CONSTANT},
+    {"tau", "ms", "main", CONSTANT},
+    {"v_reset", "mV", "main", CONSTANT},
+    {"v_th", "mV", "main", CONSTANT}
+};
+
+void initializeStatesAndConstants(ModelInstance *instance)
+{
+    instance->states[0] = 0.0;
+    instance->states[1] = 0.0;
+    instance->variables[0] = 1.5;
+    instance->variables[1] = 100.0;
+    instance->variables[2] = 10.0;
+    instance->variables[3] = 0.0;
+    instance->variables[4] = 1.0;
+}
+
+void computeComputedConstants(ModelInstance *instance)
+{
+}
+
+void computeRates(double voi, ModelInstance *instance, double *rates)
+{
+    rates[0] = (instance->variables[0]-instance->states[0])/instance->variables[2];
+    rates[1] = 0.0;
+}
+
+void computeVariables(double voi, ModelInstance *instance, double *rates)
+{
+}
+
+void computeRoots(double voi, ModelInstance *instance, double *roots)
+{
+    roots[0] = instance->states[0]-instance->variables[4];
+    roots[1] = instance->states[0]-instance->variables[4];
+    roots[2] = voi-(instance->variables[1]-1.0);
+}
+
+void applyResets(double voi, ModelInstance *instance, int *rootsFound)
+{
+    double resetValue0 = (rootsFound[0])?instance->states[1]+1.0:instance->states[1];
+    double resetValue1 = (rootsFound[1])?instance->variables[3]:(rootsFound[2])?((instance->states[1] > 2.0)?instance->variables[3]:instance->states[0]):instance->states[0];
+
+    instance->states[1] = resetValue0;
+    instance->states[0] = resetValue1;
+}
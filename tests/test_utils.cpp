@@ -138,3 +138,58 @@ libcellml::ModelPtr createModelTwoComponentsWithOneVariableEach(const std::strin
 
     return model;
 }
+
+libcellml::ModelPtr createModelWithImportedInstances(size_t instanceCount)
+{
+    // Create a cell model with an encapsulated channel, which are to be
+    // instantiated many times, each instance being connected to an electrode.
+
+    auto cellModel = libcellml::Model::create("cell");
+    auto mV = libcellml::Units::create("mV");
+    auto cell = libcellml::Component::create("cell");
+    auto channel = libcellml::Component::create("channel");
+    auto cellV = libcellml::Variable::create("V");
+    auto channelV = libcellml::Variable::create("V");
+
+    mV->addUnit("volt", "milli");
+    cellV->setUnits(mV);
+    cellV->setInterfaceType("public_and_private");
+    channelV->setUnits(mV);
+    channelV->setInterfaceType("public");
+    cellModel->addUnits(mV);
+    cell->addVariable(cellV);
+    channel->addVariable(channelV);
+    cell->addComponent(channel);
+    cellModel->addComponent(cell);
+    libcellml::Variable::addEquivalence(cellV, channelV);
+
+    auto model = libcellml::Model::create("tissue");
+    auto importSource = libcellml::ImportSource::create();
+
+    importSource->setUrl("cell.cellml");
+    importSource->setModel(cellModel);
+    model->addUnits(mV->clone());
+
+    for (size_t i = 0; i < instanceCount; ++i) {
+        auto instance = libcellml::Component::create("cell_" + std::to_string(i));
+        auto instanceV = libcellml::Variable::create("V");
+        auto electrode = libcellml::Component::create("electrode_" + std::to_string(i));
+        auto electrodeV = libcellml::Variable::create("V");
+
+        instance->setImportSource(importSource);
+        instance->setImportReference("cell");
+        instanceV->setUnits("mV");
+        instanceV->setInterfaceType("public");
+        instance->addVariable(instanceV);
+        electrodeV->setUnits("mV");
+        electrodeV->setInterfaceType("public");
+        electrode->addVariable(electrodeV);
+        model->addComponent(instance);
+        model->addComponent(electrode);
+        libcellml::Variable::addEquivalence(instanceV, electrodeV);
+    }
+
+    model->linkUnits();
+
+    return model;
+}
@@ -92,6 +92,7 @@ libcellml::ModelPtr TEST_EXPORT createModel(const std::string &name = "");
 libcellml::ModelPtr TEST_EXPORT createModelWithComponent(const std::string &name = "");
 libcellml::VariablePtr TEST_EXPORT createVariableWithUnits(const std::string &name, const std::string &units);
 libcellml::ModelPtr TEST_EXPORT createModelTwoComponentsWithOneVariableEach(const std::string &modelName = "", const std::string &c1Name = "", const std::string &c2Name = "", const std::string &v1Name = "", const std::string &v2Name = "");
+libcellml::ModelPtr TEST_EXPORT createModelWithImportedInstances(size_t instanceCount);
 
 #define EXPECT_EQ_ERRORS(errors, logger) \
     SCOPED_TRACE("Error occured here."); \
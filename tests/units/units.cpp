@@ -1812,3 +1812,75 @@ TEST(Units, isNotBaseUnitImportedTwice)
     EXPECT_FALSE(u_i2->isImport());
     EXPECT_FALSE(u_i0->isBaseUnit());
 }
+
+TEST(Units, sharedNamesReferencesAndPrefixes)
+{
+    // Names, references and prefixes are shared between entities, make sure
+    // that changing them for one entity does not affect the others.
+
+    libcellml::UnitsPtr u1 = libcellml::Units::create("my_units");
+    libcellml::UnitsPtr u2 = libcellml::Units::create("my_units");
+
+    u1->addUnit("metre", "milli", 2.0, 1.0, "u1");
+    u1->addUnit("second", "", -1.0);
+    u2->addUnit("metre", "milli", 1.0, 1.0, "u2");
+    u2->addUnit("second", "kilo", -1.0);
+
+    u2->setName("my_other_units");
+
+    EXPECT_EQ("my_units", u1->name());
+    EXPECT_EQ("my_other_units", u2->name());
+
+    u2->setName("my_units");
+    u2->removeUnit("metre");
+
+    EXPECT_EQ("my_units", u2->name());
+    EXPECT_EQ(size_t(2), u1->unitCount());
+    EXPECT_EQ(size_t(1), u2->unitCount());
+
+    std::string reference;
+    std::string prefix;
+    double exponent;
+    double multiplier;
+    std::string id;
+
+    u1->unitAttributes("metre", prefix, exponent, multiplier, id);
+
+    EXPECT_EQ("milli", prefix);
+    EXPECT_EQ(2.0, exponent);
+    EXPECT_EQ("u1", id);
+
+    u1->unitAttributes("second", prefix, exponent, multiplier, id);
+
+    EXPECT_EQ("", prefix);
+    EXPECT_EQ(-1.0, exponent);
+
+    u2->unitAttributes(0, reference, prefix, exponent, multiplier, id);
+
+    EXPECT_EQ("second", reference);
+    EXPECT_EQ("kilo", prefix);
+
+    EXPECT_FALSE(u1->removeUnit("unknown_units"));
+}
+
+TEST(Units, compareCyclicUnits)
+{
+    // Comparing cyclic units must terminate, with the cyclic references being
+    // treated as references to unknown units.
+
+    libcellml::ModelPtr model = libcellml::Model::create("model");
+    libcellml::UnitsPtr u1 = libcellml::Units::create("u1");
+    libcellml::UnitsPtr u2 = libcellml::Units::create("u2");
+    libcellml::UnitsPtr u3 = libcellml::Units::create("u3");
+
+    u1->addUnit("u2");
+    u2->addUnit("u1", "milli");
+    u3->addUnit("unknown_units");
+    model->addUnits(u1);
+    model->addUnits(u2);
+    model->addUnits(u3);
+
+    EXPECT_EQ(libcellml::Units::equivalent(u3, u3), libcellml::Units::equivalent(u1, u2));
+    EXPECT_EQ(0.0, libcellml::Units::scalingFactor(u1, u2));
+    EXPECT_EQ(libcellml::Units::scalingFactor(u3, u3), libcellml::Units::scalingFactor(u1, u1));
+}
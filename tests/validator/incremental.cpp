@@ -0,0 +1,307 @@
+/*
+Copyright libCellML Contributors
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+
+#include "test_utils.h"
+
+#include "gtest/gtest.h"
+
+#include <libcellml>
+
+#include <random>
+
+static std::vector<std::string> errorDescriptions(const libcellml::ValidatorPtr &validator)
+{
+    std::vector<std::string> res;
+
+    for (size_t i = 0; i < validator->errorCount(); ++i) {
+        auto error = validator->error(i);
+
+        res.push_back(error->description() + " [" + std::to_string(int(error->kind())) + "]");
+    }
+
+    return res;
+}
+
+static std::vector<libcellml::ComponentPtr> allComponents(const libcellml::ComponentEntityPtr &componentEntity)
+{
+    std::vector<libcellml::ComponentPtr> res;
+
+    for (size_t i = 0; i < componentEntity->componentCount(); ++i) {
+        auto component = componentEntity->component(i);
+        auto components = allComponents(component);
+
+        res.push_back(component);
+        res.insert(res.end(), components.begin(), components.end());
+    }
+
+    return res;
+}
+
+static std::vector<libcellml::VariablePtr> allVariables(const libcellml::ModelPtr &model)
+{
+    std::vector<libcellml::VariablePtr> res;
+
+    for (const auto &component : allComponents(model)) {
+        for (size_t i = 0; i < component->variableCount(); ++i) {
+            res.push_back(component->variable(i));
+        }
+    }
+
+    return res;
+}
+
+TEST(IncrementalValidation, settings)
+{
+    auto validator = libcellml::Validator::create();
+
+    EXPECT_FALSE(validator->isIncremental());
+
+    validator->setIncremental(true);
+
+    EXPECT_TRUE(validator->isIncremental());
+
+    validator->setIncremental(false);
+
+    EXPECT_FALSE(validator->isIncremental());
+}
+
+TEST(IncrementalValidation, unmodifiedComponentsAreNotValidatedAgain)
+{
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto validator = libcellml::Validator::create();
+    auto sodiumChannel = model->component("sodium_channel");
+    auto potassiumChannel = model->component("potassium_channel");
+
+    sodiumChannel->variable("g_Na")->setInitialValue("invalid");
+    potassiumChannel->variable("g_K")->setInitialValue("invalid");
+
+    validator->setIncremental(true);
+    validator->validateModel(model);
+
+    ASSERT_EQ(size_t(2), validator->errorCount());
+
+    auto sodiumChannelError = validator->error(0);
+    auto potassiumChannelError = validator->error(1);
+
+    EXPECT_EQ(sodiumChannel->variable("g_Na"), sodiumChannelError->variable());
+    EXPECT_EQ(potassiumChannel->variable("g_K"), potassiumChannelError->variable());
+
+    // Modifying the sodium channel only gets it validated again.
+
+    sodiumChannel->variable("g_Na")->setInitialValue("still_invalid");
+
+    validator->validateModel(model);
+
+    ASSERT_EQ(size_t(2), validator->errorCount());
+    EXPECT_NE(sodiumChannelError, validator->error(0));
+    EXPECT_EQ(potassiumChannelError, validator->error(1));
+
+    // Modifying the name of the model gets everything validated again.
+
+    potassiumChannelError = validator->error(1);
+
+    model->setName("renamed_model");
+
+    validator->validateModel(model);
+
+    ASSERT_EQ(size_t(2), validator->errorCount());
+    EXPECT_NE(potassiumChannelError, validator->error(1));
+
+    // As does validating another model.
+
+    potassiumChannelError = validator->error(1);
+
+    validator->validateModel(model->clone());
+
+    ASSERT_EQ(size_t(2), validator->errorCount());
+    EXPECT_NE(potassiumChannelError, validator->error(1));
+}
+
+TEST(IncrementalValidation, randomEdits)
+{
+    // Apply random edits to a model and check, after each of them, that an
+    // incremental validation reports the same errors as a full validation.
+
+    static const std::string VALID_MATH =
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n"
+        "  <apply>\n"
+        "    <eq/>\n"
+        "    <ci>V</ci>\n"
+        "    <cn cellml:units=\"millivolt\">1</cn>\n"
+        "  </apply>\n"
+        "</math>\n";
+    static const std::string INVALID_MATH =
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n"
+        "  <apply>\n"
+        "    <eq/>\n"
+        "    <ci>unknown</ci>\n"
+        "    <cn cellml:units=\"unknown_units\">1</cn>\n"
+        "    <bvar/>\n"
+        "  </apply>\n"
+        "</math>\n";
+
+    auto parser = libcellml::Parser::create();
+    auto model = parser->parseModel(fileContents("generator/hodgkin_huxley_squid_axon_model_1952/model.cellml"));
+    auto incrementalValidator = libcellml::Validator::create();
+    std::mt19937 generator(20201019);
+    size_t nonEmptyValidations = 0;
+
+    incrementalValidator->setIncremental(true);
+
+    auto pick = [&](size_t count) {
+        return std::uniform_int_distribution<size_t>(0, count - 1)(generator);
+    };
+
+    for (size_t step = 0; step < 400; ++step) {
+        auto components = allComponents(model);
+        auto variables = allVariables(model);
+        auto component = components[pick(components.size())];
+        auto variable = variables[pick(variables.size())];
+        auto otherVariable = variables[pick(variables.size())];
+        auto units = model->units(pick(model->unitsCount()));
+        auto edit = pick(16);
+
+        switch (edit) {
+        case 0: {
+            const std::vector<std::string> initialValues = {"1.5", "invalid", otherVariable->name(), ""};
+
+            variable->setInitialValue(initialValues[pick(initialValues.size())]);
+
+            break;
+        }
+        case 1: {
+            const std::vector<std::string> names = {"V", "1_invalid", "renamed", otherVariable->name()};
+
+            variable->setName(names[pick(names.size())]);
+
+            break;
+        }
+        case 2: {
+            const std::vector<std::string> names = {"membrane", "invalid name", "renamed", components[pick(components.size())]->name()};
+
+            component->setName(names[pick(names.size())]);
+
+            break;
+        }
+        case 3: {
+            const std::vector<std::string> maths = {"", VALID_MATH, INVALID_MATH, components[pick(components.size())]->math()};
+
+            component->setMath(maths[pick(maths.size())]);
+
+            break;
+        }
+        case 4:
+            libcellml::Variable::addEquivalence(variable, otherVariable);
+
+            break;
+        case 5:
+            libcellml::Variable::removeEquivalence(variable, variable->equivalentVariable(0));
+
+            break;
+        case 6: {
+            const std::vector<std::string> unitsNames = {"second", "invalid units", "unknown_units", model->units(pick(model->unitsCount()))->name()};
+
+            variable->setUnits(unitsNames[pick(unitsNames.size())]);
+
+            break;
+        }
+        case 7: {
+            const std::vector<std::string> references = {"second", "unknown_units", model->units(pick(model->unitsCount()))->name()};
+
+            units->addUnit(references[pick(references.size())], "milli", -1.0);
+
+            break;
+        }
+        case 8:
+            if (units->unitCount() > 0) {
+                units->removeUnit(pick(units->unitCount()));
+            }
+
+            break;
+        case 9: {
+            const std::vector<std::string> names = {"millivolt", "renamed_units", "second", "1_invalid"};
+
+            units->setName(names[pick(names.size())]);
+
+            break;
+        }
+        case 10: {
+            const std::vector<std::string> interfaceTypes = {"public", "public_and_private", "invalid", ""};
+
+            variable->setInterfaceType(interfaceTypes[pick(interfaceTypes.size())]);
+
+            break;
+        }
+        case 11: {
+            auto reset = libcellml::Reset::create();
+
+            if (pick(2) == 0) {
+                reset->setOrder(int(step));
+            }
+            reset->setVariable(variable);
+            reset->setTestVariable(otherVariable);
+            reset->setTestValue(VALID_MATH);
+            component->addReset(reset);
+
+            break;
+        }
+        case 12:
+            component->removeAllResets();
+
+            break;
+        case 13: {
+            // Move a variable to another component.
+
+            auto parent = std::dynamic_pointer_cast<libcellml::Component>(variable->parent());
+
+            if (parent->variableCount() > 1) {
+                parent->removeVariable(variable);
+                component->addVariable(variable);
+            }
+
+            break;
+        }
+        case 14:
+            if (pick(4) == 0) {
+                model->setName((model->name() == "model") ? "1_invalid" : "model");
+            }
+
+            break;
+        default:
+            incrementalValidator->setMathMLValidation((incrementalValidator->mathmlValidation() == libcellml::Validator::MathMLValidation::DTD) ?
+                                                          libcellml::Validator::MathMLValidation::NATIVE :
+                                                          libcellml::Validator::MathMLValidation::DTD);
+
+            break;
+        }
+
+        auto fullValidator = libcellml::Validator::create();
+
+        fullValidator->setMathMLValidation(incrementalValidator->mathmlValidation());
+        fullValidator->validateModel(model);
+        incrementalValidator->validateModel(model);
+
+        EXPECT_EQ(errorDescriptions(fullValidator), errorDescriptions(incrementalValidator)) << "Step " << step << ", edit " << edit << ".";
+
+        if (fullValidator->errorCount() > 0) {
+            ++nonEmptyValidations;
+        }
+    }
+
+    EXPECT_LT(size_t(100), nonEmptyValidations);
+}
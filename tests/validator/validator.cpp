@@ -556,8 +556,8 @@ TEST(Validator, invalidMathMLVariables)
         "Math has a 'nonsense' element that is not a supported MathML element.",
         "MathML ci element has the child text 'answer' which does not correspond with any variable names present in component 'componentName'.",
         "MathML ci element has the child text 'new_bvar' which does not correspond with any variable names present in component 'componentName'.",
-        "W3C MathML DTD error: No declaration for element nonsense.",
         "W3C MathML DTD error: Element nonsense is not declared in ci list of possible children.",
+        "W3C MathML DTD error: No declaration for element nonsense.",
     };
 
     libcellml::ValidatorPtr v = libcellml::Validator::create();
@@ -605,8 +605,8 @@ TEST(Validator, invalidSimpleMathmlCellMLUnits)
         "CellML identifiers must contain one or more basic Latin alphabetic characters.",
         "Component does not have a valid name attribute.",
         "MathML ci element has the child text 'B' which does not correspond with any variable names present in component ''.",
-        "W3C MathML DTD error: No declaration for attribute units of element ci.",
         "W3C MathML DTD error: Element apply content does not follow the DTD, expecting (csymbol | ci | cn | apply | reln | lambda | condition | declare | sep | semantics | annotation | annotation-xml | integers | reals | rationals | naturalnumbers | complexes | primes | exponentiale | imaginaryi | notanumber | true | false | emptyset | pi | eulergamma | infinity | interval | list | matrix | matrixrow | set | vector | piecewise | lowlimit | uplimit | bvar | degree | logbase | momentabout | domainofapplication | inverse | ident | domain | codomain | image | abs | conjugate | exp | factorial | arg | real | imaginary | floor | ceiling | not | ln | sin | cos | tan | sec | csc | cot | sinh | cosh | tanh | sech | csch | coth | arcsin | arccos | arctan | arccosh | arccot | arccoth | arccsc | arccsch | arcsec | arcsech | arcsinh | arctanh | determinant | transpose | card | quotient | divide | power | rem | implies | vectorproduct | scalarproduct | outerproduct | setdiff | fn | compose | plus | times | max | min | gcd | lcm | and | or | xor | union | intersect | cartesianproduct | mean | sdev | variance | median | mode | selector | root | minus | log | int | diff | partialdiff | divergence | grad | curl | laplacian | sum | product | limit | moment | exists | forall | neq | factorof | in | notin | notsubset | notprsubset | tendsto | eq | leq | lt | geq | gt | equivalent | approx | subset | prsubset | mi | mn | mo | mtext | ms | mspace | mrow | mfrac | msqrt | mroot | menclose | mstyle | merror | mpadded | mphantom | mfenced | msub | msup | msubsup | munder | mover | munderover | mmultiscripts | mtable | mtr | mlabeledtr | mtd | maligngroup | malignmark | maction)*, got (CDATA bvar ).",
+        "W3C MathML DTD error: No declaration for attribute units of element ci.",
     };
     libcellml::ValidatorPtr v = libcellml::Validator::create();
     libcellml::ModelPtr m = libcellml::Model::create();
@@ -1417,9 +1417,7 @@ TEST(Validator, validMathCnElementsMissingCellMLNamespace)
         "Math cn element with the value '3.44' does not have a valid cellml:units attribute.",
         "CellML identifiers must contain one or more basic Latin alphabetic characters.",
         "Math cn element with the value '-9.612' does not have a valid cellml:units attribute.",
-        "W3C MathML DTD error: Namespace prefix cellml for units on cn is not defined.",
         "W3C MathML DTD error: No declaration for attribute cellml:units of element cn.",
-        "W3C MathML DTD error: Namespace prefix cellml for units on cn is not defined.",
         "W3C MathML DTD error: No declaration for attribute cellml:units of element cn.",
     };
 
@@ -2207,6 +2205,66 @@ TEST(Validator, validateModelWithoutAndWithMath)
     EXPECT_EQ(size_t(0), validator->errorCount());
 }
 
+TEST(Validator, validateModelAfterModifyingMath)
+{
+    // Math is parsed once and reused until it gets modified, so make sure
+    // that validating a model takes into account the latest version of its
+    // math.
+
+    const std::string validMath =
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n"
+        "  <apply>\n"
+        "    <eq/>\n"
+        "    <ci>v</ci>\n"
+        "    <cn cellml:units=\"dimensionless\">1</cn>\n"
+        "  </apply>\n"
+        "</math>\n";
+    const std::string invalidMath =
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\">\n"
+        "  <apply>\n"
+        "    <eq/>\n"
+        "    <ci>w</ci>\n"
+        "    <ci>v</ci>\n"
+        "  </apply>\n"
+        "</math>\n";
+    const std::vector<std::string> expectedErrors = {
+        "MathML ci element has the child text 'w' which does not correspond with any variable names present in component 'component'.",
+    };
+
+    libcellml::ModelPtr model = libcellml::Model::create("model");
+    libcellml::ComponentPtr component = libcellml::Component::create("component");
+    libcellml::VariablePtr v = libcellml::Variable::create("v");
+    libcellml::ValidatorPtr validator = libcellml::Validator::create();
+
+    v->setUnits("dimensionless");
+    component->addVariable(v);
+    model->addComponent(component);
+
+    component->setMath(invalidMath);
+
+    validator->validateModel(model);
+    EXPECT_EQ_ERRORS(expectedErrors, validator);
+
+    validator->validateModel(model);
+    EXPECT_EQ_ERRORS(expectedErrors, validator);
+
+    component->setMath(validMath);
+
+    validator->validateModel(model);
+    EXPECT_EQ(size_t(0), validator->errorCount());
+
+    component->removeMath();
+    component->appendMath(invalidMath);
+
+    validator->validateModel(model);
+    EXPECT_EQ_ERRORS(expectedErrors, validator);
+
+    component->removeMath();
+
+    validator->validateModel(model);
+    EXPECT_EQ(size_t(0), validator->errorCount());
+}
+
 TEST(Validator, unitEquivalenceMultiplier)
 {
     libcellml::ValidatorPtr validator = libcellml::Validator::create();
@@ -2278,3 +2336,110 @@ TEST(Validator, unfoundUnitsInEncapsulatedComponents)
 
     EXPECT_EQ_ERRORS(expectedErrors, v);
 }
+
+TEST(Validator, mathmlValidation)
+{
+    libcellml::ValidatorPtr validator = libcellml::Validator::create();
+
+    EXPECT_EQ(libcellml::Validator::MathMLValidation::DTD, validator->mathmlValidation());
+
+    validator->setMathMLValidation(libcellml::Validator::MathMLValidation::NATIVE);
+
+    EXPECT_EQ(libcellml::Validator::MathMLValidation::NATIVE, validator->mathmlValidation());
+}
+
+TEST(Validator, nativeMathMLValidationOfValidModels)
+{
+    const std::vector<std::string> fileNames = {
+        "generator/fabbri_fantini_wilders_severi_human_san_model_2017/model.cellml",
+        "generator/garny_kohl_hunter_boyett_noble_rabbit_san_model_2003/model.cellml",
+        "generator/hodgkin_huxley_squid_axon_model_1952/model.cellml",
+        "generator/noble_model_1962/model.cellml",
+    };
+
+    libcellml::ParserPtr parser = libcellml::Parser::create();
+    libcellml::ValidatorPtr validator = libcellml::Validator::create();
+
+    validator->setMathMLValidation(libcellml::Validator::MathMLValidation::NATIVE);
+
+    for (const auto &fileName : fileNames) {
+        SCOPED_TRACE(fileName);
+
+        validator->validateModel(parser->parseModel(fileContents(fileName)));
+
+        EXPECT_EQ(size_t(0), validator->errorCount());
+    }
+}
+
+TEST(Validator, nativeMathMLValidation)
+{
+    const std::string math =
+        "<math xmlns=\"http://www.w3.org/1998/Math/MathML\" xmlns:cellml=\"http://www.cellml.org/cellml/2.0#\">\n"
+        "  <apply>\n"
+        "    <minus/>\n"
+        "    <ci>v</ci>\n"
+        "    <ci>v</ci>\n"
+        "    <ci>v</ci>\n"
+        "  </apply>\n"
+        "  <apply>\n"
+        "    <diff/>\n"
+        "    <ci>v</ci>\n"
+        "  </apply>\n"
+        "  <apply>\n"
+        "    <ci>v</ci>\n"
+        "  </apply>\n"
+        "  <piecewise>\n"
+        "    <otherwise>\n"
+        "      <ci>v</ci>\n"
+        "    </otherwise>\n"
+        "    <piece>\n"
+        "      <ci>v</ci>\n"
+        "    </piece>\n"
+        "  </piecewise>\n"
+        "  <apply>\n"
+        "    <plus/>\n"
+        "    <cn cellml:units=\"dimensionless\" type=\"integer\">1</cn>\n"
+        "    <cn cellml:units=\"dimensionless\" type=\"e-notation\">1.5</cn>\n"
+        "    <cn cellml:units=\"dimensionless\">1<sep/>2</cn>\n"
+        "    <bvar><ci>v</ci></bvar>\n"
+        "  </apply>\n"
+        "  <apply>\n"
+        "    <log/>\n"
+        "    <logbase><cn cellml:units=\"dimensionless\">10</cn><ci>v</ci></logbase>\n"
+        "    <ci>v</ci>\n"
+        "  </apply>\n"
+        "  <pi>3</pi>\n"
+        "</math>\n";
+    const std::vector<std::string> expectedErrors = {
+        "Math has a 'minus' element on line 3 which takes between 1 and 2 arguments but has 3.",
+        "Math has a 'diff' element on line 9 which requires a 'bvar' element.",
+        "Math has an 'apply' element on line 12 which does not start with an operator.",
+        "Math has a 'piece' element on line 19 which is not allowed here.",
+        "Math has a 'cn' element on line 25 which has an unsupported type 'integer'.",
+        "Math has a 'cn' element on line 26 which should contain exactly one 'sep' element.",
+        "Math has a 'cn' element on line 27 which should not contain a 'sep' element.",
+        "Math has a 'bvar' element on line 28 which is not allowed here.",
+        "Math has a 'logbase' element on line 32 which should contain exactly one expression.",
+        "Math has a 'pi' element on line 35 which contains the unexpected text '3'.",
+    };
+
+    libcellml::ModelPtr model = libcellml::Model::create("model");
+    libcellml::ComponentPtr component = libcellml::Component::create("component");
+    libcellml::VariablePtr v = libcellml::Variable::create("v");
+    libcellml::ValidatorPtr validator = libcellml::Validator::create();
+
+    v->setUnits("dimensionless");
+    component->addVariable(v);
+    component->setMath(math);
+    model->addComponent(component);
+
+    validator->setMathMLValidation(libcellml::Validator::MathMLValidation::NATIVE);
+    validator->validateModel(model);
+
+    EXPECT_EQ_ERRORS(expectedErrors, validator);
+
+    for (size_t i = 0; i < validator->errorCount(); ++i) {
+        EXPECT_EQ(libcellml::Error::Kind::MATHML, validator->error(i)->kind());
+        EXPECT_EQ(component, validator->error(i)->component());
+    }
+}